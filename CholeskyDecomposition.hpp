@@ -0,0 +1,354 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : CholeskyDecomposition.hpp
+// Description          : Template class for Cholesky decomposition of
+//                        symmetric positive definite matrices
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_CholeskyDecomposition_hpp
+#define INCLUDED_CholeskyDecomposition_hpp
+
+#include <math.h>
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+
+//========================================================================
+// class CholeskyDecomposition
+// -----------------------------------------------------------------------
+// \brief
+// Cholesky decomposition A = L * transpose(L) of a symmetric positive
+// definite matrix.
+//
+// The lower triangular factor is kept by the object. It can be used to
+// solve any number of linear systems, and it can be modified in
+// O(size^2) operations when the factorized matrix changes by a rank-1
+// term (update() and downdate()), which is much cheaper than factorizing
+// the modified matrix again. This is the typical situation for covariance
+// matrices in Kalman filters and Hessian approximations in quasi-Newton
+// methods.
+//
+// <b>Example Program:</b>
+// \include CholeskyDecomposition.t.cpp
+//========================================================================
+
+template<int size, class T = double>
+class CholeskyDecomposition
+{
+ public:
+  inline CholeskyDecomposition();
+   // The default constructor. The object holds no factorization
+   // until factorize() is called.
+
+  inline CholeskyDecomposition(const Matrix<size, size, T> &A);
+   // This constructor factorizes \a A. See factorize().
+
+  ~CholeskyDecomposition() {}
+   // The default destructor.
+
+  void factorize(const Matrix<size, size, T> &A);
+   // Computes and stores the factor L. Only the lower triangle of \a A
+   // is referenced. Throws QMathException_singular if \a A is not
+   // positive definite.
+
+  void update(const ColumnVector<size, T> &x);
+   // Modifies the stored factor to that of A + x * transpose(x).
+
+  void downdate(const ColumnVector<size, T> &x);
+   // Modifies the stored factor to that of A - x * transpose(x). Throws
+   // QMathException_singular, leaving the factor unchanged, if the
+   // result is not positive definite.
+
+  template<int nrhs>
+  Matrix<size, nrhs, T> solve(const Matrix<size, nrhs, T> &B) const;
+   //  return  The solution X of A * X = B using the stored factor.
+
+  inline ColumnVector<size, T> solve(const ColumnVector<size, T> &b) const;
+   //  return  The solution x of A * x = b using the stored factor.
+
+  void solve(const ColumnVector<size, T> *b, ColumnVector<size, T> *x, int count) const;
+   // Solves A * x[i] = b[i] for an array of right hand sides.
+   //  b      Array of \a count right hand sides.
+   //  x      Array of \a count solutions. May be the same array as \a b.
+   //  count  Number of systems.
+
+  Matrix<size, size, T> getL() const;
+   //  return  The lower triangular factor L.
+
+  T determinant() const;
+   //  return  The determinant of the factorized matrix.
+
+  // ========== END OF INTERFACE ==========
+
+ protected:
+  T d_l[size * size];
+  bool d_valid;
+
+  inline void checkValid() const;
+  void substitute(T *b, int nrhs) const;
+   // Forward and back substitution with L and transpose(L).
+};
+
+
+//========================================================================
+// End of declarations.
+//========================================================================
+
+
+//========================================================================
+// CholeskyDecomposition::CholeskyDecomposition
+//========================================================================
+template<int size, class T>
+CholeskyDecomposition<size, T>::CholeskyDecomposition()
+{
+ d_valid = false;
+}
+
+
+template<int size, class T>
+CholeskyDecomposition<size, T>::CholeskyDecomposition(const Matrix<size, size, T> &A)
+{
+ d_valid = false;
+ factorize(A);
+}
+
+
+//========================================================================
+// CholeskyDecomposition::checkValid
+//========================================================================
+template<int size, class T>
+void CholeskyDecomposition<size, T>::checkValid() const
+{
+ if(!d_valid)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_singular);
+  throw exception;
+ }
+}
+
+
+//========================================================================
+// CholeskyDecomposition::factorize
+//========================================================================
+template<int size, class T>
+void CholeskyDecomposition<size, T>::factorize(const Matrix<size, size, T> &A)
+{
+ const T *a = A.getElementsPointer();
+ d_valid = false;
+ for(int r = 0; r < size; ++r)
+ {
+  for(int c = 0; c <= r; ++c)
+  {
+   T s = a[r * size + c];
+   for(int k = 0; k < c; ++k)
+    s -= d_l[r * size + k] * d_l[c * size + k];
+   if(r == c)
+   {
+    if(s < NumericTraits<T>::epsilon())
+     checkValid();
+    d_l[r * size + r] = sqrt(s);
+   }
+   else
+    d_l[r * size + c] = s / d_l[c * size + c];
+  }
+  for(int c = r + 1; c < size; ++c)
+   d_l[r * size + c] = 0;
+ }
+ d_valid = true;
+}
+
+
+//========================================================================
+// CholeskyDecomposition::update
+//========================================================================
+template<int size, class T>
+void CholeskyDecomposition<size, T>::update(const ColumnVector<size, T> &x)
+{
+ checkValid();
+ T w[size];
+ const T *px = x.getElementsPointer();
+ for(int i = 0; i < size; ++i)
+  w[i] = px[i];
+
+ for(int k = 0; k < size; ++k)
+ {
+  T lkk = d_l[k * size + k];
+  T r = sqrt(lkk * lkk + w[k] * w[k]);
+  T c = r / lkk;
+  T s = w[k] / lkk;
+  d_l[k * size + k] = r;
+  for(int i = k + 1; i < size; ++i)
+  {
+   T lik = (d_l[i * size + k] + s * w[i]) / c;
+   d_l[i * size + k] = lik;
+   w[i] = c * w[i] - s * lik;
+  }
+ }
+}
+
+
+//========================================================================
+// CholeskyDecomposition::downdate
+//========================================================================
+template<int size, class T>
+void CholeskyDecomposition<size, T>::downdate(const ColumnVector<size, T> &x)
+{
+ checkValid();
+ T w[size];
+ T l[size * size];
+ const T *px = x.getElementsPointer();
+ for(int i = 0; i < size; ++i)
+  w[i] = px[i];
+ for(int i = 0; i < size * size; ++i)
+  l[i] = d_l[i];
+
+ for(int k = 0; k < size; ++k)
+ {
+  T lkk = l[k * size + k];
+  T r2 = lkk * lkk - w[k] * w[k];
+  if(r2 < NumericTraits<T>::epsilon())
+  {
+   static MathException exception;
+   exception.setErrorType(QMathException_singular);
+   throw exception;
+  }
+  T r = sqrt(r2);
+  T c = r / lkk;
+  T s = w[k] / lkk;
+  l[k * size + k] = r;
+  for(int i = k + 1; i < size; ++i)
+  {
+   T lik = (l[i * size + k] - s * w[i]) / c;
+   l[i * size + k] = lik;
+   w[i] = c * w[i] - s * lik;
+  }
+ }
+
+ for(int i = 0; i < size * size; ++i)
+  d_l[i] = l[i];
+}
+
+
+//========================================================================
+// CholeskyDecomposition::substitute
+//========================================================================
+template<int size, class T>
+void CholeskyDecomposition<size, T>::substitute(T *b, int nrhs) const
+{
+ int r, k, c;
+
+ // L y = b
+ for(r = 0; r < size; ++r)
+ {
+  for(k = 0; k < r; ++k)
+  {
+   T l = d_l[r * size + k];
+   for(c = 0; c < nrhs; ++c)
+    b[r * nrhs + c] -= l * b[k * nrhs + c];
+  }
+  T il = 1 / d_l[r * size + r];
+  for(c = 0; c < nrhs; ++c)
+   b[r * nrhs + c] *= il;
+ }
+
+ // transpose(L) x = y
+ for(r = size - 1; r >= 0; --r)
+ {
+  for(k = r + 1; k < size; ++k)
+  {
+   T l = d_l[k * size + r];
+   for(c = 0; c < nrhs; ++c)
+    b[r * nrhs + c] -= l * b[k * nrhs + c];
+  }
+  T il = 1 / d_l[r * size + r];
+  for(c = 0; c < nrhs; ++c)
+   b[r * nrhs + c] *= il;
+ }
+}
+
+
+//========================================================================
+// CholeskyDecomposition::solve
+//========================================================================
+template<int size, class T>
+template<int nrhs>
+Matrix<size, nrhs, T> CholeskyDecomposition<size, T>::solve(const Matrix<size, nrhs, T> &B) const
+{
+ checkValid();
+ Matrix<size, nrhs, T> X(B);
+ substitute(X.getElementsPointer(), nrhs);
+ return X;
+}
+
+
+template<int size, class T>
+ColumnVector<size, T> CholeskyDecomposition<size, T>::solve(const ColumnVector<size, T> &b) const
+{
+ checkValid();
+ ColumnVector<size, T> x(b);
+ substitute(x.getElementsPointer(), 1);
+ return x;
+}
+
+
+template<int size, class T>
+void CholeskyDecomposition<size, T>::solve(const ColumnVector<size, T> *b, ColumnVector<size, T> *x,
+                                           int count) const
+{
+ checkValid();
+ for(int i = 0; i < count; ++i)
+ {
+  if(x != b)
+   x[i] = b[i];
+  substitute(x[i].getElementsPointer(), 1);
+ }
+}
+
+
+//========================================================================
+// CholeskyDecomposition::getL
+//========================================================================
+template<int size, class T>
+Matrix<size, size, T> CholeskyDecomposition<size, T>::getL() const
+{
+ checkValid();
+ Matrix<size, size, T> L;
+ T *l = L.getElementsPointer();
+ for(int i = 0; i < size * size; ++i)
+  l[i] = d_l[i];
+ return L;
+}
+
+
+//========================================================================
+// CholeskyDecomposition::determinant
+//========================================================================
+template<int size, class T>
+T CholeskyDecomposition<size, T>::determinant() const
+{
+ checkValid();
+ T det = 1;
+ for(int i = 0; i < size; ++i)
+  det *= d_l[i * size + i];
+ return det * det;
+}
+
+
+#endif
@@ -1,301 +1,450 @@
-//======================================================================== 
-// Package		: QMath - Template Math Library
-// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
-// Compatibility	: GCC 2.95.3 and above, MSVS 2005
-// File                 : ColumnVector.hpp
-// Description          : Template class for column vectors
-//
-// Copyright (C) 2000 Vilas Chitrakaran
-// 
-// This program is free software; you can redistribute it and/or modify
-// it under the terms of the GNU Lesser General Public License as published 
-// by the Free Software Foundation; either version 2 of the License, or (at
-// your option) any later version.
-// 
-// This program is distributed in the hope that it will be useful, but
-// WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
-// 
-// You should have received a copy of the GNU General Public License
-// along with this program; if not, write to the Free Software
-// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
-//========================================================================  
- 
-
-#ifndef INCLUDED_ColumnVector_hpp
-#define INCLUDED_ColumnVector_hpp
-
-#include "Matrix.hpp"
-#include "VectorBase.hpp"
-
-
-//====================================================================
-// class ColumnVector
-// -------------------------------------------------------------------
-// \brief
-// A class for column vectors.
-//
-// The class \c ColumnVector is derived from the base classes \c Matrix
-// and \c VectorBase, and provides methods for operations such as 
-// cross product, dot product and element-by-element multiplication.
-//
-// <b>Example Program:</b>
-// \include Vector.t.cpp
-//========================================================================  
- 
-template<int size, class T = double>
-class ColumnVector : public Matrix<size, 1, T>, public VectorBase<T>
-{
- public:
-  inline ColumnVector() : Matrix<size, 1, T>(), VectorBase<T>() {}
-   // The default constructor. The elements are not initialized.
-	
-  inline ColumnVector(const ColumnVector<size, T> &v);
-   // Copy Constructor. 
-
-  inline ColumnVector(const Matrix<size,1,T> &m);
-   // The conversion constructor for conversion
-   // of a \c Matrix type of single column into
-   // type \c ColumnVector.
-		
-  virtual ~ColumnVector(){}
-   // The default destructor.
-	
-  virtual T *getElementsPointer() const { return (T *)(this->d_element); }
-   //  return A pointer to the first element in the vector.
-
-  inline virtual T getElement(int index) const;
-   //  return  The value at position specified by index 
-   //          (index = 1 is the first element).
-
-  inline virtual void setElement(int index, T value);
-   // Sets an element to a value at the specified position.
-   //  index  Position of the desired element.
-   //  value  The desired element is set to this value.
-
-  virtual bool isRowVector() const {return false;}
-   //  return  false
-
-  virtual int getNumElements() const {return size;}
-   //  return The number of elements in the vector.
-
-  inline T operator()(int index) const;
-  inline T &operator()(int index);
-   // Access or assign the element at the position specified by 
-   // index. For example: 
-   // \code 
-   // myVector(2)=12.65; 
-   // \endcode
-	
-  inline ColumnVector<size, T> &operator=(const ColumnVector<size, T> &v);
-   // Assignment between \c ColumnVector types of equal dimensions.
-
-  MatrixInitializer<T> operator=(const T &value);
-   // Initialize a vector object.
-   //  value  The value to which all elements in the vector are initialized.
-   // The initialization of the vector object can also
-   // be done as a comma seperated list. For example:
-   // \code 
-   // ColumnVector<3> myVector;
-   // myVector = 67.88, 45.89, 90; 
-   // \endcode
- private:
-};
-
-
-template<class T>
-ColumnVector<3,T> crossProduct(const ColumnVector<3,T> &v1, const ColumnVector<3,T> &v2);
- // Generates the cross product of two 3 dimensional column vectors. 
- //  v1, v2  The 3D column-vector arguments.
- //  return  The cross product.
-
-template<int size, class T>
-ColumnVector<size, T> elementProduct(const ColumnVector<size,T> &v1, const ColumnVector<size,T> &v2);
- // This function performs multiplication between two column vectors 
- // element-by-element.
- //  v1, v2  The column-vector arguments
- //  return  The product.
-
-template<int size, class T>
-T dotProduct(const ColumnVector<size,T> &v1, const ColumnVector<size,T> &v2);
- // Dot (inner) product between two column-vectors.
- //  v1, v2 The column-vector arguments.
- //  return  The scalar product.
-
-template<int size, class T>
-inline RowVector<size, T> transpose(const ColumnVector<size, T> &vector);
- //  return  The transpose of type \c RowVector.
-
-// ========== END OF INTERFACE ==========
-	
-
-
-//==============================================================
-// Definition of inlined functions.
-//==============================================================
-
-//======================================================================== 
-// ColumnVector::ColumnVector: Constructor of the ColumnVector class
-//======================================================================== 
-template<int size, class T>
-ColumnVector<size, T>::ColumnVector(const Matrix<size,1,T> &m)
- : Matrix<size,1,T>(m), VectorBase<T>()
-{
-}
-
-template<int size, class T>
-ColumnVector<size, T>::ColumnVector(const ColumnVector<size, T> &v)
- : Matrix<size,1,T>(v), VectorBase<T>()
-{
-}
-
-
-//======================================================================== 
-// ColumnVector::getElement
-//========================================================================  
-template<int size, class T>
-T ColumnVector<size, T>::getElement(int i) const
-{
- if( i > size || i < 1)
- {
-  static MathException exception;
-  exception.setErrorType(QMathException_illegalIndex);
-  throw exception;
- }
- return this->d_element[(i-1)];
-}
-
-
-//======================================================================== 
-// ColumnVector::setElement
-//========================================================================  
-template<int size, class T>
-void ColumnVector<size, T>::setElement(int i, T value)
-{
- if( i > size || i < 1)
- {
-  static MathException exception;
-  exception.setErrorType(QMathException_illegalIndex);
-  throw exception;
- }
- this->d_element[(i-1)] = value;
-}
-
-
-//======================================================================== 
-// ColumnVector::operator()
-//========================================================================  
-template<int size, class T>
-T ColumnVector<size, T>::operator()(int i) const
-{
- if( i > size || i < 1)
- {
-  static MathException exception;
-  exception.setErrorType(QMathException_illegalIndex);
-  throw exception;
- }
- return this->d_element[(i-1)];
-}
-
-template<int size, class T>
-T &ColumnVector<size, T>::operator()(int i)
-{
- if( i > size || i < 1)
- {
-  static MathException exception;
-  exception.setErrorType(QMathException_illegalIndex);
-  throw exception;
- }
- return this->d_element[(i-1)];
-}
-
-
-//======================================================================== 
-// crossProduct
-//========================================================================  
-template<class T>
-ColumnVector<3,T> crossProduct(const ColumnVector<3,T> &v1, 
-                               const ColumnVector<3,T> &v2)
-{
- ColumnVector<3, T> cp;
- cp(1) = v1(2)*v2(3) - v1(3)*v2(2);
- cp(2) = v1(3)*v2(1) - v1(1)*v2(3);
- cp(3) = v1(1)*v2(2) - v1(2)*v2(1);
- return (cp);
-}
-
-
-//======================================================================== 
-// elementProduct
-//========================================================================  
-template<int size, class T>
-ColumnVector<size, T> elementProduct(const ColumnVector<size,T> &v1, 
-                                     const ColumnVector<size,T> &v2)
-{
- ColumnVector<size, T> ep;
- for (int i = 1; i <= size; ++i)
-  ep(i) = v1(i)*v2(i);
- return (ep);
-}
-
-
-//======================================================================== 
-// dotProduct
-//========================================================================  
-template<int size, class T>
-T dotProduct(const ColumnVector<size,T> &v1, const ColumnVector<size,T> &v2)
-{ 
- T d = 0;
- for (int i = 1; i <= size; ++i)
-  d += v1(i)*v2(i);
- return (d);
-}
-
-
-//======================================================================== 
-// Transpose
-//========================================================================  
-template<int size, class T>
-RowVector<size, T> transpose(const ColumnVector<size, T> &v)
-{
- RowVector<size,T> row;
- for (int i = 1; i <= size; ++i)
-  row(i) = v(i);
- return row;
-}
-
-
-//======================================================================== 
-// ColumnVector::operator=
-//========================================================================  
-template<int size, class T>
-ColumnVector<size, T> &ColumnVector<size, T>::operator=(const ColumnVector<size, T> &v)
-{
- if( this == &v )
-  return *this;
-
- for(int i = 0; i < size; ++i)
-  this->d_element[i] = v.d_element[i];
- return *this;
-}
-
-
-template<int size, class T>
-MatrixInitializer<T> ColumnVector<size, T>::operator=(const T &value)
-{
- for (int i = 0; i < size; ++i)
- {
-  this->d_element[i] = value;
- }
- MatrixInitializer<T>  matrixInitialize(size, 1, this->d_element);
- return matrixInitialize;
-}
-
-
-#endif
-
-
-
-
-
-
+//======================================================================== 
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : ColumnVector.hpp
+// Description          : Template class for column vectors
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published 
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================  
+ 
+
+#ifndef INCLUDED_ColumnVector_hpp
+#define INCLUDED_ColumnVector_hpp
+
+#include "Matrix.hpp"
+#include "VectorBase.hpp"
+
+
+//====================================================================
+// class ColumnVector
+// -------------------------------------------------------------------
+// \brief
+// A class for column vectors.
+//
+// The class \c ColumnVector is derived from the base classes \c Matrix
+// and \c VectorBase, and provides methods for operations such as 
+// cross product, dot product and element-by-element multiplication.
+//
+// <b>Example Program:</b>
+// \include Vector.t.cpp
+//========================================================================  
+ 
+template<int size, class T = double>
+class ColumnVector : public Matrix<size, 1, T>, public VectorBase<T>
+{
+ public:
+  inline ColumnVector() : Matrix<size, 1, T>(), VectorBase<T>() {}
+   // The default constructor. The elements are not initialized.
+	
+  inline ColumnVector(const ColumnVector<size, T> &v);
+   // Copy Constructor. 
+
+  inline ColumnVector(const Matrix<size,1,T> &m);
+   // The conversion constructor for conversion
+   // of a \c Matrix type of single column into
+   // type \c ColumnVector.
+		
+  virtual ~ColumnVector(){}
+   // The default destructor.
+	
+  virtual T *getElementsPointer() const { return (T *)(this->d_element); }
+   //  return A pointer to the first element in the vector.
+
+  inline virtual T getElement(int index) const;
+   //  return  The value at position specified by index 
+   //          (index = 1 is the first element).
+
+  inline virtual void setElement(int index, T value);
+   // Sets an element to a value at the specified position.
+   //  index  Position of the desired element.
+   //  value  The desired element is set to this value.
+
+  virtual bool isRowVector() const {return false;}
+   //  return  false
+
+  virtual int getNumElements() const {return size;}
+   //  return The number of elements in the vector.
+
+  inline T squaredNorm() const;
+   //  return  The sum of the squares of the elements.
+
+  inline T norm() const;
+   //  return  The 2-norm of the vector.
+
+  template<int p> T lpNorm() const;
+   //  return  The p-norm (sum of |x(i)|^p)^(1/p) of the vector, for
+   //          p >= 1. For example: 
+   // \code 
+   // double l1 = myVector.lpNorm<1>(); 
+   // \endcode
+
+  inline T infNorm() const;
+   //  return  The infinity norm (largest absolute element) of the vector.
+
+  ColumnVector<size, T> &normalize();
+   // Scales the vector to unit 2-norm. Throws a divideByZero exception
+   // if the norm is less than NumericTraits<T>::epsilon().
+   //  return  Reference to this vector.
+
+  ColumnVector<size, T> normalized() const;
+   //  return  The vector scaled to unit 2-norm. See normalize().
+
+  ColumnVector<size, T> &fastNormalize();
+   // Same as normalize(), but scales by fastInverseSqrt() of the squared
+   // norm instead of dividing by the norm. The relative error of the
+   // result is documented in FastMath.hpp.
+   //  return  Reference to this vector.
+
+  inline T operator()(int index) const;
+  inline T &operator()(int index);
+   // Access or assign the element at the position specified by 
+   // index. For example: 
+   // \code 
+   // myVector(2)=12.65; 
+   // \endcode
+	
+  inline ColumnVector<size, T> &operator=(const ColumnVector<size, T> &v);
+   // Assignment between \c ColumnVector types of equal dimensions.
+
+  MatrixInitializer<T> operator=(const T &value);
+   // Initialize a vector object.
+   //  value  The value to which all elements in the vector are initialized.
+   // The initialization of the vector object can also
+   // be done as a comma seperated list. For example:
+   // \code 
+   // ColumnVector<3> myVector;
+   // myVector = 67.88, 45.89, 90; 
+   // \endcode
+ private:
+};
+
+
+template<class T>
+ColumnVector<3,T> crossProduct(const ColumnVector<3,T> &v1, const ColumnVector<3,T> &v2);
+ // Generates the cross product of two 3 dimensional column vectors. 
+ //  v1, v2  The 3D column-vector arguments.
+ //  return  The cross product.
+
+template<int size, class T>
+ColumnVector<size, T> elementProduct(const ColumnVector<size,T> &v1, const ColumnVector<size,T> &v2);
+ // This function performs multiplication between two column vectors 
+ // element-by-element.
+ //  v1, v2  The column-vector arguments
+ //  return  The product.
+
+template<int size, class T>
+T dotProduct(const ColumnVector<size,T> &v1, const ColumnVector<size,T> &v2);
+ // Dot (inner) product between two column-vectors.
+ //  v1, v2 The column-vector arguments.
+ //  return  The scalar product.
+
+template<int size, class T>
+inline RowVector<size, T> transpose(const ColumnVector<size, T> &vector);
+ //  return  The transpose of type \c RowVector.
+
+template<int size, class T>
+ColumnVector<size, T> solve(const Matrix<size, size, T> &A, const ColumnVector<size, T> &b);
+ // Solves the linear system A * x = b without forming the inverse of 
+ // \a A. See solve() for matrices.
+ //  return  The solution x.
+
+// ========== END OF INTERFACE ==========
+	
+
+
+//==============================================================
+// Definition of inlined functions.
+//==============================================================
+
+//======================================================================== 
+// ColumnVector::ColumnVector: Constructor of the ColumnVector class
+//======================================================================== 
+template<int size, class T>
+ColumnVector<size, T>::ColumnVector(const Matrix<size,1,T> &m)
+ : Matrix<size,1,T>(m), VectorBase<T>()
+{
+}
+
+template<int size, class T>
+ColumnVector<size, T>::ColumnVector(const ColumnVector<size, T> &v)
+ : Matrix<size,1,T>(v), VectorBase<T>()
+{
+}
+
+
+//======================================================================== 
+// ColumnVector::getElement
+//========================================================================  
+template<int size, class T>
+T ColumnVector<size, T>::getElement(int i) const
+{
+ if( i > size || i < 1)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+ return this->d_element[(i-1)];
+}
+
+
+//======================================================================== 
+// ColumnVector::setElement
+//========================================================================  
+template<int size, class T>
+void ColumnVector<size, T>::setElement(int i, T value)
+{
+ if( i > size || i < 1)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+ this->d_element[(i-1)] = value;
+}
+
+
+//======================================================================== 
+// ColumnVector::operator()
+//========================================================================  
+template<int size, class T>
+T ColumnVector<size, T>::operator()(int i) const
+{
+ if( i > size || i < 1)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+ return this->d_element[(i-1)];
+}
+
+template<int size, class T>
+T &ColumnVector<size, T>::operator()(int i)
+{
+ if( i > size || i < 1)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+ return this->d_element[(i-1)];
+}
+
+
+//======================================================================== 
+// ColumnVector::squaredNorm
+//========================================================================  
+template<int size, class T>
+T ColumnVector<size, T>::squaredNorm() const
+{
+ typename NumericTraits<T>::AccumulatorType acc = 0;
+ UnrolledDot<size, 1, 1>::dot(acc, this->d_element, this->d_element);
+ return (T)acc;
+}
+
+
+//======================================================================== 
+// ColumnVector::norm
+//========================================================================  
+template<int size, class T>
+T ColumnVector<size, T>::norm() const
+{
+ return UnrolledNorm<size, 2>::norm(this->d_element);
+}
+
+
+//======================================================================== 
+// ColumnVector::lpNorm
+//========================================================================  
+template<int size, class T>
+template<int p>
+T ColumnVector<size, T>::lpNorm() const
+{
+ return UnrolledNorm<size, p>::norm(this->d_element);
+}
+
+
+//======================================================================== 
+// ColumnVector::infNorm
+//========================================================================  
+template<int size, class T>
+T ColumnVector<size, T>::infNorm() const
+{
+ T m = 0;
+ UnrolledLoop<size>::absMax(m, this->d_element);
+ return m;
+}
+
+
+//======================================================================== 
+// ColumnVector::normalize
+//========================================================================  
+template<int size, class T>
+ColumnVector<size, T> &ColumnVector<size, T>::normalize()
+{
+ typedef typename NumericTraits<T>::AccumulatorType A;
+ A acc = 0;
+ UnrolledDot<size, 1, 1>::dot(acc, this->d_element, this->d_element);
+ acc = sqrt(acc);
+ if(acc < (A)NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ UnrolledLoop<size>::scale(this->d_element, (T)(1 / acc));
+ return *this;
+}
+
+
+//======================================================================== 
+// ColumnVector::normalized
+//========================================================================  
+template<int size, class T>
+ColumnVector<size, T> ColumnVector<size, T>::normalized() const
+{
+ ColumnVector<size, T> v(*this);
+ return v.normalize();
+}
+
+
+//======================================================================== 
+// ColumnVector::fastNormalize
+//========================================================================  
+template<int size, class T>
+ColumnVector<size, T> &ColumnVector<size, T>::fastNormalize()
+{
+ typedef typename NumericTraits<T>::AccumulatorType A;
+ const A eps = NumericTraits<T>::epsilon();
+ A acc = 0;
+ UnrolledDot<size, 1, 1>::dot(acc, this->d_element, this->d_element);
+ if(acc < eps * eps)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ UnrolledLoop<size>::scale(this->d_element, (T)fastInverseSqrt(acc));
+ return *this;
+}
+
+
+//======================================================================== 
+// crossProduct
+//========================================================================  
+template<class T>
+ColumnVector<3,T> crossProduct(const ColumnVector<3,T> &v1, 
+                               const ColumnVector<3,T> &v2)
+{
+ ColumnVector<3, T> cp;
+ cp(1) = v1(2)*v2(3) - v1(3)*v2(2);
+ cp(2) = v1(3)*v2(1) - v1(1)*v2(3);
+ cp(3) = v1(1)*v2(2) - v1(2)*v2(1);
+ return (cp);
+}
+
+
+//======================================================================== 
+// elementProduct
+//========================================================================  
+template<int size, class T>
+ColumnVector<size, T> elementProduct(const ColumnVector<size,T> &v1, 
+                                     const ColumnVector<size,T> &v2)
+{
+ ColumnVector<size, T> ep;
+ UnrolledLoop<size>::multiply(ep.getElementsPointer(), v1.getElementsPointer(), v2.getElementsPointer());
+ return (ep);
+}
+
+
+//======================================================================== 
+// dotProduct
+//========================================================================  
+template<int size, class T>
+T dotProduct(const ColumnVector<size,T> &v1, const ColumnVector<size,T> &v2)
+{ 
+ typename NumericTraits<T>::AccumulatorType d = 0;
+ UnrolledDot<size, 1, 1>::dot(d, v1.getElementsPointer(), v2.getElementsPointer());
+ return (T)d;
+}
+
+
+//======================================================================== 
+// Transpose
+//========================================================================  
+template<int size, class T>
+RowVector<size, T> transpose(const ColumnVector<size, T> &v)
+{
+ RowVector<size,T> row;
+ for (int i = 1; i <= size; ++i)
+  row(i) = v(i);
+ return row;
+}
+
+
+//======================================================================== 
+// solve
+//========================================================================  
+template<int size, class T>
+ColumnVector<size, T> solve(const Matrix<size, size, T> &A, const ColumnVector<size, T> &b)
+{
+ ColumnVector<size, T> x(b);
+ if( !solveInPlace<size, T>(A.getElementsPointer(), x.getElementsPointer(), 1) )
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_singular);
+  throw exception;
+ }
+ return x;
+}
+
+
+//======================================================================== 
+// ColumnVector::operator=
+//========================================================================  
+template<int size, class T>
+ColumnVector<size, T> &ColumnVector<size, T>::operator=(const ColumnVector<size, T> &v)
+{
+ if( this == &v )
+  return *this;
+
+ for(int i = 0; i < size; ++i)
+  this->d_element[i] = v.d_element[i];
+ return *this;
+}
+
+
+template<int size, class T>
+MatrixInitializer<T> ColumnVector<size, T>::operator=(const T &value)
+{
+ for (int i = 0; i < size; ++i)
+ {
+  this->d_element[i] = value;
+ }
+ MatrixInitializer<T>  matrixInitialize(size, 1, this->d_element);
+ return matrixInitialize;
+}
+
+
+#endif
+
+
+
+
+
+
@@ -1,241 +1,290 @@
-//======================================================================== 
-// Package		: QMath - Template Math Library
-// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
-// Compatibility	: GCC 2.95.3 and above, MSVS 2005
-// File                 : Differentiator.hpp
-// Description          : Template class for numerical differentiation
-//                        using backward difference
-//
-// Copyright (C) 2000 Vilas Chitrakaran
-// 
-// This program is free software; you can redistribute it and/or modify
-// it under the terms of the GNU Lesser General Public License as published 
-// by the Free Software Foundation; either version 2 of the License, or (at
-// your option) any later version.
-// 
-// This program is distributed in the hope that it will be useful, but
-// WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
-// 
-// You should have received a copy of the GNU General Public License
-// along with this program; if not, write to the Free Software
-// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
-//========================================================================  
-
-#ifndef INCLUDED_Differentiator_hpp
-#define INCLUDED_Differentiator_hpp
-
-#include "LowpassFilter.hpp"
-#include <math.h>
-#ifndef M_PI
- #define M_PI 3.14159265358979323846
-#endif
-
-//====================================================================
-// class Differentiator
-// -------------------------------------------------------------------
-// \brief
-// This is the base class for differentiators.
-//
-// This class implements numerical differentation using backward 
-// difference followed by low-pass filtering. 
-//
-// The Differentiator performs numerical differentiation of a signal 
-// using backward difference, followed by smoothening of the 
-// differentiated signal by a 2nd order butterworth low pass filter. 
-// The filtering is usually required due to the noisy nature of the 
-// result of numerical differentiation. Unfortunately low pass filter 
-// also introduces lag and innacuracy to the result. Filtering action 
-// should be disabled using disableFilter() if your input signal is 
-// sufficiently smooth.
-//
-// A derived class from Differentiator can override the differenting 
-// algorithm provided.The class \c Differentiator can be used with many 
-// data types (double, int, RowVector, ColumnVector, Matrix, etc).
-// 
-// <b>Example Program:</b>
-// \include Differentiator.t.cpp
-//========================================================================  
- 
-template<class T = double>
-class Differentiator
-{
- public:
-  inline Differentiator(double period = 0.001);
-   // The Constructor initializes. The low pass filter is
-   // enabled by default, the cut-off frequency is set to half the
-   // sampling frequency and damping ratio of the
-   // low-pass filter in the differentiator is set to 1. 
-   //  period  The sampling period of the 
-   //          differentiator in seconds.
-	
-  virtual ~Differentiator (){}
-   // The default destructor.
-
-  inline void setSamplingPeriod(double period);
-   // Sets the sampling period of the differentiator 
-
-  inline void setCutOffFrequencyHz(double f);
-   // Differentiation is followed by a low pass filtering process.
-   // This function sets the cut-off frequency of the filter in \a hertz. 
-
-  inline void setCutOffFrequencyRad(double cutOffFrequencyRad);
-   // Differentiation is followed by a low pass filtering process.
-   // This function sets the cut-off frequency of the filter in \a rad/sec. 
-
-  inline void setDampingRatio(double d);
-   // Sets the damping factor of the butterworth filter.
-
-  void disableFilter();
-   // Disable the low pass filtering after the 
-   // differentiation. (Low pass filter is enabled
-   // by default.)
-
-  void enableFilter();
-   // Enable the low pass filtering after the 
-   // differentiation.
-
-  void reset();
-   // Resets the differentiator output to zero.
-
-  virtual T differentiate(const T &input);
-   // This function implements the numerical 
-   // method for differentiation. The user can derive
-   // a different method of differentiation in a 
-   // derived class. The differentiator
-   // output in the first cycle is smoothened to zero.
-   //  input  The current value of the 
-   //         signal being differentiated.
-		
- // ========== END OF INTERFACE ==========
- 
- protected:
-  double d_samplingPeriod;
-  T d_previousInput;
-  T d_currentDifferential;
-  LowpassFilter<T> d_lowPassFilter;
-  bool d_initialize;
-  bool d_useFilter;
-};
-
-
-
-//==============================================================
-// End of declarations.
-//==============================================================
-
-
-//======================================================================== 
-// Differentiator::Differentiator: Constructor of the Differentiator class
-//========================================================================  
-template<class T>
-Differentiator<T>::Differentiator(double samplingPeriod)
-{
- setSamplingPeriod(samplingPeriod);
- setDampingRatio(1);
- setCutOffFrequencyHz(1.0/(2.0*samplingPeriod));
- d_previousInput = 0;
- d_initialize = true;
- d_useFilter = true;
-}
-
-
-//======================================================================== 
-// Differentiator::setSamplingPeriod
-//========================================================================  
-template<class T>
-void Differentiator<T>::setSamplingPeriod(double p)
-{
- d_samplingPeriod = p; 
- d_lowPassFilter.setSamplingPeriod(d_samplingPeriod);
-}
-
-
-//======================================================================== 
-// Differentiator::setDampingRatio
-//========================================================================  
-template<class T>
-void Differentiator<T>::setDampingRatio(double d) 
-{
- d_lowPassFilter.setDampingRatio(d);
-}
-
-
-//======================================================================== 
-// Differentiator::disableFilter
-//========================================================================  
-template<class T>
-void Differentiator<T>::disableFilter()
-{
- d_useFilter = false;
-}
-
-
-//======================================================================== 
-// Differentiator::enableFilter
-//========================================================================  
-template<class T>
-void Differentiator<T>::enableFilter()
-{
- d_useFilter = true;
-}
-
-
-//======================================================================== 
-// Differentiator::setCutOffFrequencyHz
-//========================================================================  
-template<class T>
-void Differentiator<T>::setCutOffFrequencyHz(double cutOffFrequencyHz)
-{
- d_lowPassFilter.setCutOffFrequencyHz(cutOffFrequencyHz);
-}
-
-
-//======================================================================== 
-// Differentiator::setCutOffFrequencyRad
-//========================================================================  
-template<class T>
-void Differentiator<T>::setCutOffFrequencyRad(double cutOffFrequencyRad)
-{
- d_lowPassFilter.setCutOffFrequencyRad(cutOffFrequencyRad);
-}
-
-
-//======================================================================== 
-// Differentiator::reset
-//========================================================================  
-template<class T>
-void Differentiator<T>::reset()
-{
- d_initialize = true;
-}
-
-
-//======================================================================== 
-// Differentiator::differentiate
-//========================================================================  
-template<class T>
-T Differentiator<T>::differentiate(const T &currentInput)
-{
- if (d_initialize)
- {
-  d_previousInput = currentInput;
-  d_lowPassFilter.setAutoInit();
-  d_initialize = false;
- }
-	
- T filteredOutput;
-
- d_currentDifferential = (currentInput - d_previousInput) * (1/d_samplingPeriod) ;
- d_previousInput = currentInput;
-
- if(d_useFilter)
-  filteredOutput = d_lowPassFilter.filter(d_currentDifferential);
- else
-  filteredOutput = d_currentDifferential;
- 
- return filteredOutput;
-}
-
-
-#endif
+//======================================================================== 
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Differentiator.hpp
+// Description          : Template class for numerical differentiation
+//                        using backward difference
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published 
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================  
+
+#ifndef INCLUDED_Differentiator_hpp
+#define INCLUDED_Differentiator_hpp
+
+#include "LowpassFilter.hpp"
+#include <math.h>
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+//====================================================================
+// class Differentiator
+// -------------------------------------------------------------------
+// \brief
+// This is the base class for differentiators.
+//
+// This class implements numerical differentation using backward 
+// difference followed by low-pass filtering. 
+//
+// The Differentiator performs numerical differentiation of a signal 
+// using backward difference, followed by smoothening of the 
+// differentiated signal by a 2nd order butterworth low pass filter. 
+// The filtering is usually required due to the noisy nature of the 
+// result of numerical differentiation. Unfortunately low pass filter 
+// also introduces lag and innacuracy to the result. Filtering action 
+// should be disabled using disableFilter() if your input signal is 
+// sufficiently smooth.
+//
+// A derived class from Differentiator can override the differenting 
+// algorithm provided.The class \c Differentiator can be used with many 
+// data types (double, int, RowVector, ColumnVector, Matrix, FixedPoint, 
+// etc).
+//
+// The reciprocal 1/p of the sampling period is stored as
+// NumericTraits<T>::CoefficientType. When it is too large for that type
+// (1000 for the default period, while fixed-point coefficients range
+// over +/-128), it is stored divided by a power of two 2^(n s) instead,
+// and the difference of the inputs is first multiplied n times by 2^s,
+// the largest power of two that the type holds. These products are
+// exact, so that the result is rounded once, as with a single
+// coefficient.
+// 
+// <b>Example Program:</b>
+// \include Differentiator.t.cpp
+//========================================================================  
+ 
+template<class T = double>
+class Differentiator
+{
+ public:
+  inline Differentiator(double period = 0.001);
+   // The Constructor initializes. The low pass filter is
+   // enabled by default, the cut-off frequency is set to half the
+   // sampling frequency and damping ratio of the
+   // low-pass filter in the differentiator is set to 1. 
+   //  period  The sampling period of the 
+   //          differentiator in seconds.
+	
+  virtual ~Differentiator (){}
+   // The default destructor.
+
+  inline void setSamplingPeriod(double period);
+   // Sets the sampling period of the differentiator 
+
+  inline void setCutOffFrequencyHz(double f);
+   // Differentiation is followed by a low pass filtering process.
+   // This function sets the cut-off frequency of the filter in \a hertz. 
+
+  inline void setCutOffFrequencyRad(double cutOffFrequencyRad);
+   // Differentiation is followed by a low pass filtering process.
+   // This function sets the cut-off frequency of the filter in \a rad/sec. 
+
+  inline void setDampingRatio(double d);
+   // Sets the damping factor of the butterworth filter.
+
+  void disableFilter();
+   // Disable the low pass filtering after the 
+   // differentiation. (Low pass filter is enabled
+   // by default.)
+
+  void enableFilter();
+   // Enable the low pass filtering after the 
+   // differentiation.
+
+  void reset();
+   // Resets the differentiator output to zero.
+
+  virtual T differentiate(const T &input);
+   // This function implements the numerical 
+   // method for differentiation. The user can derive
+   // a different method of differentiation in a 
+   // derived class. The differentiator
+   // output in the first cycle is smoothened to zero.
+   //  input  The current value of the 
+   //         signal being differentiated.
+		
+ // ========== END OF INTERFACE ==========
+ 
+ protected:
+  double d_samplingPeriod;
+  typename NumericTraits<T>::CoefficientType d_inverseSamplingPeriod; // 1/p over 2^(n s)
+  typename NumericTraits<T>::CoefficientType d_periodScale;           // 2^s
+  int d_periodScaleCount;                                             // n
+  T d_previousInput;
+  T d_currentDifferential;
+  LowpassFilter<T> d_lowPassFilter;
+  bool d_initialize;
+  bool d_useFilter;
+
+ private:
+  static inline bool fitsCoefficient(int e);
+};
+
+
+
+//==============================================================
+// End of declarations.
+//==============================================================
+
+
+//======================================================================== 
+// Differentiator::Differentiator: Constructor of the Differentiator class
+//========================================================================  
+template<class T>
+Differentiator<T>::Differentiator(double samplingPeriod)
+{
+ setSamplingPeriod(samplingPeriod);
+ setDampingRatio(1);
+ setCutOffFrequencyHz(1.0/(2.0*samplingPeriod));
+ d_previousInput = 0;
+ d_initialize = true;
+ d_useFilter = true;
+}
+
+
+//======================================================================== 
+// Differentiator::setSamplingPeriod
+//========================================================================  
+template<class T>
+void Differentiator<T>::setSamplingPeriod(double p)
+{
+ // 1/p = f 2^k with 0.5 <= f < 1. If 2^k does not fit, s is the
+ // largest exponent such that 2^s does, and n = ceil((k - s)/s) leaves
+ // f 2^(k - n s) < 2^s.
+ int k, s = 0, n = 0;
+ double f = frexp(1 / p, &k);
+ if( (k > 0) && !fitsCoefficient(k) )
+ {
+  while( (s + 1 < k) && fitsCoefficient(s + 1) )
+   ++s;
+  if(s > 0)
+   n = (k - 1) / s;
+ }
+ d_samplingPeriod = p; 
+ d_inverseSamplingPeriod = ldexp(f, k - n * s);
+ d_periodScale = ldexp(1.0, s);
+ d_periodScaleCount = n;
+ d_lowPassFilter.setSamplingPeriod(d_samplingPeriod);
+}
+
+
+//======================================================================== 
+// Differentiator::fitsCoefficient
+//   Whether 2^e is represented in CoefficientType: a saturated or
+//   infinite value is not the sum of two halves.
+//========================================================================  
+template<class T>
+bool Differentiator<T>::fitsCoefficient(int e)
+{
+ typedef typename NumericTraits<T>::CoefficientType C;
+ C whole = ldexp(1.0, e), half = ldexp(1.0, e - 1);
+ return (whole - half == half);
+}
+
+
+//======================================================================== 
+// Differentiator::setDampingRatio
+//========================================================================  
+template<class T>
+void Differentiator<T>::setDampingRatio(double d) 
+{
+ d_lowPassFilter.setDampingRatio(d);
+}
+
+
+//======================================================================== 
+// Differentiator::disableFilter
+//========================================================================  
+template<class T>
+void Differentiator<T>::disableFilter()
+{
+ d_useFilter = false;
+}
+
+
+//======================================================================== 
+// Differentiator::enableFilter
+//========================================================================  
+template<class T>
+void Differentiator<T>::enableFilter()
+{
+ d_useFilter = true;
+}
+
+
+//======================================================================== 
+// Differentiator::setCutOffFrequencyHz
+//========================================================================  
+template<class T>
+void Differentiator<T>::setCutOffFrequencyHz(double cutOffFrequencyHz)
+{
+ d_lowPassFilter.setCutOffFrequencyHz(cutOffFrequencyHz);
+}
+
+
+//======================================================================== 
+// Differentiator::setCutOffFrequencyRad
+//========================================================================  
+template<class T>
+void Differentiator<T>::setCutOffFrequencyRad(double cutOffFrequencyRad)
+{
+ d_lowPassFilter.setCutOffFrequencyRad(cutOffFrequencyRad);
+}
+
+
+//======================================================================== 
+// Differentiator::reset
+//========================================================================  
+template<class T>
+void Differentiator<T>::reset()
+{
+ d_initialize = true;
+}
+
+
+//======================================================================== 
+// Differentiator::differentiate
+//========================================================================  
+template<class T>
+T Differentiator<T>::differentiate(const T &currentInput)
+{
+ if (d_initialize)
+ {
+  d_previousInput = currentInput;
+  d_lowPassFilter.setAutoInit();
+  d_initialize = false;
+ }
+	
+ T filteredOutput;
+
+ typedef typename NumericTraits<T>::AccumulatorType A;
+ A difference = (A)currentInput - (A)d_previousInput;
+ for(int i = 0; i < d_periodScaleCount; ++i)
+  difference = d_periodScale * difference;
+ d_currentDifferential = d_inverseSamplingPeriod * difference;
+ d_previousInput = currentInput;
+
+ if(d_useFilter)
+  filteredOutput = d_lowPassFilter.filter(d_currentDifferential);
+ else
+  filteredOutput = d_currentDifferential;
+ 
+ return filteredOutput;
+}
+
+
+#endif
@@ -0,0 +1,510 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Elementwise.hpp
+// Description          : Reductions and element-by-element functions
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_Elementwise_hpp
+#define INCLUDED_Elementwise_hpp
+
+#include "Simd.hpp"
+#include "FastMath.hpp"
+#include "ColumnVector.hpp"
+#include "RowVector.hpp"
+
+//========================================================================
+// Reductions and element-by-element functions
+// -----------------------------------------------------------------------
+// \brief
+// Sum, mean, smallest and largest element and their positions, and the
+// element-by-element absolute value, clamping, sine, cosine and
+// exponential.
+//
+// Every function is provided for a \c Matrix, which includes
+// \c ColumnVector, \c RowVector and \c Transform, and for a range of
+// \a count consecutive elements given by a pointer. The latter serves
+// as a view: the elements of a \c Vec3, a column of component arrays
+// as used in VectorBatch.hpp, or any part of the elements of a matrix
+// (see getElementsPointer()).
+//
+// The elements are processed four at a time with \c Simd4. Sums are
+// therefore added in a different order than in a loop from the first
+// to the last element, and are accumulated in
+// NumericTraits<T>::AccumulatorType. Sine, cosine and exponential are
+// the approximations fastSin(), fastCos() and fastExp() of FastMath.hpp
+// for float and double, whose accuracy is documented there, and the
+// functions of the standard library for other types. The results of the
+// element-by-element functions may be written over their argument.
+// Ranges must not be empty, and the results for elements that are not
+// numbers (NaN) are undefined.
+//
+// <b>Example Program:</b>
+// \include Elementwise.t.cpp
+//========================================================================
+
+template<class T>
+T elementSum(const T *a, int count);
+template<int nr, int nc, class T>
+inline T elementSum(const Matrix<nr, nc, T> &m);
+ //  return  The sum of the elements.
+
+template<class T>
+T elementMean(const T *a, int count);
+template<int nr, int nc, class T>
+inline T elementMean(const Matrix<nr, nc, T> &m);
+ //  return  The arithmetic mean of the elements.
+
+template<class T>
+T elementMin(const T *a, int count);
+template<int nr, int nc, class T>
+inline T elementMin(const Matrix<nr, nc, T> &m);
+template<class T>
+T elementMax(const T *a, int count);
+template<int nr, int nc, class T>
+inline T elementMax(const Matrix<nr, nc, T> &m);
+ //  return  The smallest or the largest element.
+
+template<class T>
+int elementMinIndex(const T *a, int count);
+template<class T>
+int elementMaxIndex(const T *a, int count);
+ //  return  The position of the first occurrence of the smallest or
+ //          the largest element, from 0 to count - 1.
+
+template<int nr, int nc, class T>
+inline void elementMinIndex(const Matrix<nr, nc, T> &m, int &row, int &column);
+template<int nr, int nc, class T>
+inline void elementMaxIndex(const Matrix<nr, nc, T> &m, int &row, int &column);
+ // Finds the first occurrence, in row-major order, of the smallest or
+ // the largest element of a matrix.
+ //  row, column  Set to the position of the element (starting at 1).
+
+template<int n, class T>
+inline int elementMinIndex(const ColumnVector<n, T> &v);
+template<int n, class T>
+inline int elementMaxIndex(const ColumnVector<n, T> &v);
+template<int n, class T>
+inline int elementMinIndex(const RowVector<n, T> &v);
+template<int n, class T>
+inline int elementMaxIndex(const RowVector<n, T> &v);
+ //  return  The position of the first occurrence of the smallest or
+ //          the largest element of a vector (starting at 1).
+
+template<class T>
+void elementAbs(const T *a, T *b, int count);
+template<int nr, int nc, class T>
+inline Matrix<nr, nc, T> elementAbs(const Matrix<nr, nc, T> &m);
+ // Absolute values, b[i] = |a[i]|.
+
+template<class T>
+void elementClamp(const T *a, const typename NumericTraits<T>::ScalarType &low,
+                  const typename NumericTraits<T>::ScalarType &high, T *b, int count);
+template<int nr, int nc, class T>
+inline Matrix<nr, nc, T> elementClamp(const Matrix<nr, nc, T> &m,
+                                      const typename NumericTraits<T>::ScalarType &low,
+                                      const typename NumericTraits<T>::ScalarType &high);
+ // Limits the elements to [low, high], b[i] = min(max(a[i], low), high).
+ // Example:
+ // \code
+ // ColumnVector<6> torque;
+ // torque = elementClamp(torque, -10, 10);
+ // \endcode
+
+template<class T>
+void elementSin(const T *a, T *b, int count);
+template<int nr, int nc, class T>
+inline Matrix<nr, nc, T> elementSin(const Matrix<nr, nc, T> &m);
+template<class T>
+void elementCos(const T *a, T *b, int count);
+template<int nr, int nc, class T>
+inline Matrix<nr, nc, T> elementCos(const Matrix<nr, nc, T> &m);
+template<class T>
+void elementExp(const T *a, T *b, int count);
+template<int nr, int nc, class T>
+inline Matrix<nr, nc, T> elementExp(const Matrix<nr, nc, T> &m);
+ // Sine, cosine and exponential of each element, b[i] = f(a[i]).
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// ElementLoad
+//   Internal. Loads four elements of type T as lanes of type A, the
+//   accumulator type of elementSum(). It returns Simd4 from scalar
+//   arguments, so it is declared in the namespace of Simd4 (see
+//   Simd.hpp).
+//========================================================================
+namespace QMATH_SIMD_NAMESPACE {
+
+template<class A, class T>
+class ElementLoad
+{
+ public:
+  static inline Simd4<A> load(const T *p)
+  { return Simd4<A>::set((A)p[0], (A)p[1], (A)p[2], (A)p[3]); }
+};
+
+template<class T>
+class ElementLoad<T, T>
+{
+ public:
+  static inline Simd4<T> load(const T *p) { return Simd4<T>::load(p); }
+};
+
+} // namespace QMATH_SIMD_NAMESPACE
+
+
+//========================================================================
+// elementMap, ElementAbs, ElementClamp, ElementSin, ElementCos,
+// ElementExp
+//   Internal. elementMap applies the functor f, one of the classes
+//   below, which maps a Simd4<T> to a Simd4<T>, to count elements. The
+//   last incomplete group of four is copied into a zero-padded array
+//   and processed the same way.
+//========================================================================
+template<class T, class F>
+void elementMap(const T *a, T *b, int count, const F &f)
+{
+ int i;
+ for(i = 0; i + 8 <= count; i += 8)
+ {
+  Simd4<T> x0 = f(Simd4<T>::load(a + i));
+  Simd4<T> x1 = f(Simd4<T>::load(a + i + 4));
+  x0.store(b + i);
+  x1.store(b + i + 4);
+ }
+ if(i + 4 <= count)
+ {
+  f(Simd4<T>::load(a + i)).store(b + i);
+  i += 4;
+ }
+ if(i < count)
+ {
+  T t[4];
+  int j, m = count - i;
+  for(j = 0; j < 4; ++j)
+   t[j] = (j < m) ? a[i + j] : 0;
+  f(Simd4<T>::load(t)).store(t);
+  for(j = 0; j < m; ++j)
+   b[i + j] = t[j];
+ }
+}
+
+template<class T>
+class ElementAbs
+{
+ public:
+  inline Simd4<T> operator()(const Simd4<T> &x) const { return x.abs(); }
+};
+
+namespace QMATH_SIMD_NAMESPACE {  // the layout depends on Simd4
+
+template<class T>
+class ElementClamp
+{
+ public:
+  ElementClamp(const T &low, const T &high)
+   : d_low(Simd4<T>::broadcast(low)), d_high(Simd4<T>::broadcast(high)) {}
+  inline Simd4<T> operator()(const Simd4<T> &x) const
+  { return x.maximum(d_low).minimum(d_high); }
+ private:
+  Simd4<T> d_low, d_high;
+};
+
+} // namespace QMATH_SIMD_NAMESPACE
+
+template<class T>
+class ElementSin
+{
+ public:
+  inline Simd4<T> operator()(const Simd4<T> &x) const { return fastSin(x); }
+};
+
+template<class T>
+class ElementCos
+{
+ public:
+  inline Simd4<T> operator()(const Simd4<T> &x) const { return fastCos(x); }
+};
+
+template<class T>
+class ElementExp
+{
+ public:
+  inline Simd4<T> operator()(const Simd4<T> &x) const { return fastExp(x); }
+};
+
+
+//========================================================================
+// elementSum, elementMean
+//========================================================================
+template<class T>
+T elementSum(const T *a, int count)
+{
+ typedef typename NumericTraits<T>::AccumulatorType A;
+ typedef Simd4<A> S;
+ S s0 = S::broadcast(0), s1 = S::broadcast(0);
+ A tail = 0;
+ int i;
+ for(i = 0; i + 8 <= count; i += 8)
+ {
+  s0 = s0 + ElementLoad<A, T>::load(a + i);
+  s1 = s1 + ElementLoad<A, T>::load(a + i + 4);
+ }
+ if(i + 4 <= count)
+ {
+  s0 = s0 + ElementLoad<A, T>::load(a + i);
+  i += 4;
+ }
+ for(; i < count; ++i)
+  tail += (A)a[i];
+ return (T)((s0 + s1).sum() + tail);
+}
+
+template<int nr, int nc, class T>
+T elementSum(const Matrix<nr, nc, T> &m)
+{
+ return elementSum(m.Matrix<nr, nc, T>::getElementsPointer(), nr * nc);
+}
+
+template<class T>
+T elementMean(const T *a, int count)
+{
+ return elementSum(a, count) / (T)count;
+}
+
+template<int nr, int nc, class T>
+T elementMean(const Matrix<nr, nc, T> &m)
+{
+ return elementSum(m.Matrix<nr, nc, T>::getElementsPointer(), nr * nc) / (T)(nr * nc);
+}
+
+
+//========================================================================
+// elementMin, elementMax
+//========================================================================
+template<class T>
+T elementMin(const T *a, int count)
+{
+ T r = a[0];
+ int i = 0;
+ if(count >= 4)
+ {
+  Simd4<T> m = Simd4<T>::load(a);
+  for(i = 4; i + 4 <= count; i += 4)
+   m = m.minimum(Simd4<T>::load(a + i));
+  T t[4];
+  m.store(t);
+  r = t[0];
+  for(int j = 1; j < 4; ++j)
+   r = (t[j] < r) ? t[j] : r;
+ }
+ for(; i < count; ++i)
+  r = (a[i] < r) ? a[i] : r;
+ return r;
+}
+
+template<int nr, int nc, class T>
+T elementMin(const Matrix<nr, nc, T> &m)
+{
+ return elementMin(m.Matrix<nr, nc, T>::getElementsPointer(), nr * nc);
+}
+
+template<class T>
+T elementMax(const T *a, int count)
+{
+ T r = a[0];
+ int i = 0;
+ if(count >= 4)
+ {
+  Simd4<T> m = Simd4<T>::load(a);
+  for(i = 4; i + 4 <= count; i += 4)
+   m = m.maximum(Simd4<T>::load(a + i));
+  T t[4];
+  m.store(t);
+  r = t[0];
+  for(int j = 1; j < 4; ++j)
+   r = (r < t[j]) ? t[j] : r;
+ }
+ for(; i < count; ++i)
+  r = (r < a[i]) ? a[i] : r;
+ return r;
+}
+
+template<int nr, int nc, class T>
+T elementMax(const Matrix<nr, nc, T> &m)
+{
+ return elementMax(m.Matrix<nr, nc, T>::getElementsPointer(), nr * nc);
+}
+
+
+//========================================================================
+// elementMinIndex, elementMaxIndex
+//   The extreme value is found with SIMD first; the search for its
+//   position then usually stops early.
+//========================================================================
+template<class T>
+int elementMinIndex(const T *a, int count)
+{
+ T m = elementMin(a, count);
+ int i = 0;
+ while(i < count - 1 && !(a[i] == m))
+  ++i;
+ return i;
+}
+
+template<class T>
+int elementMaxIndex(const T *a, int count)
+{
+ T m = elementMax(a, count);
+ int i = 0;
+ while(i < count - 1 && !(a[i] == m))
+  ++i;
+ return i;
+}
+
+template<int nr, int nc, class T>
+void elementMinIndex(const Matrix<nr, nc, T> &m, int &row, int &column)
+{
+ int i = elementMinIndex(m.Matrix<nr, nc, T>::getElementsPointer(), nr * nc);
+ row = i / nc + 1;
+ column = i % nc + 1;
+}
+
+template<int nr, int nc, class T>
+void elementMaxIndex(const Matrix<nr, nc, T> &m, int &row, int &column)
+{
+ int i = elementMaxIndex(m.Matrix<nr, nc, T>::getElementsPointer(), nr * nc);
+ row = i / nc + 1;
+ column = i % nc + 1;
+}
+
+template<int n, class T>
+int elementMinIndex(const ColumnVector<n, T> &v)
+{
+ return elementMinIndex(v.Matrix<n, 1, T>::getElementsPointer(), n) + 1;
+}
+
+template<int n, class T>
+int elementMaxIndex(const ColumnVector<n, T> &v)
+{
+ return elementMaxIndex(v.Matrix<n, 1, T>::getElementsPointer(), n) + 1;
+}
+
+template<int n, class T>
+int elementMinIndex(const RowVector<n, T> &v)
+{
+ return elementMinIndex(v.Matrix<1, n, T>::getElementsPointer(), n) + 1;
+}
+
+template<int n, class T>
+int elementMaxIndex(const RowVector<n, T> &v)
+{
+ return elementMaxIndex(v.Matrix<1, n, T>::getElementsPointer(), n) + 1;
+}
+
+
+//========================================================================
+// elementAbs, elementClamp
+//========================================================================
+template<class T>
+void elementAbs(const T *a, T *b, int count)
+{
+ elementMap(a, b, count, ElementAbs<T>());
+}
+
+template<int nr, int nc, class T>
+Matrix<nr, nc, T> elementAbs(const Matrix<nr, nc, T> &m)
+{
+ Matrix<nr, nc, T> r;
+ elementMap(m.Matrix<nr, nc, T>::getElementsPointer(),
+            r.Matrix<nr, nc, T>::getElementsPointer(), nr * nc, ElementAbs<T>());
+ return r;
+}
+
+template<class T>
+void elementClamp(const T *a, const typename NumericTraits<T>::ScalarType &low,
+                  const typename NumericTraits<T>::ScalarType &high, T *b, int count)
+{
+ elementMap(a, b, count, ElementClamp<T>(low, high));
+}
+
+template<int nr, int nc, class T>
+Matrix<nr, nc, T> elementClamp(const Matrix<nr, nc, T> &m,
+                               const typename NumericTraits<T>::ScalarType &low,
+                               const typename NumericTraits<T>::ScalarType &high)
+{
+ Matrix<nr, nc, T> r;
+ elementMap(m.Matrix<nr, nc, T>::getElementsPointer(),
+            r.Matrix<nr, nc, T>::getElementsPointer(), nr * nc, ElementClamp<T>(low, high));
+ return r;
+}
+
+
+//========================================================================
+// elementSin, elementCos, elementExp
+//========================================================================
+template<class T>
+void elementSin(const T *a, T *b, int count)
+{
+ elementMap(a, b, count, ElementSin<T>());
+}
+
+template<int nr, int nc, class T>
+Matrix<nr, nc, T> elementSin(const Matrix<nr, nc, T> &m)
+{
+ Matrix<nr, nc, T> r;
+ elementMap(m.Matrix<nr, nc, T>::getElementsPointer(),
+            r.Matrix<nr, nc, T>::getElementsPointer(), nr * nc, ElementSin<T>());
+ return r;
+}
+
+template<class T>
+void elementCos(const T *a, T *b, int count)
+{
+ elementMap(a, b, count, ElementCos<T>());
+}
+
+template<int nr, int nc, class T>
+Matrix<nr, nc, T> elementCos(const Matrix<nr, nc, T> &m)
+{
+ Matrix<nr, nc, T> r;
+ elementMap(m.Matrix<nr, nc, T>::getElementsPointer(),
+            r.Matrix<nr, nc, T>::getElementsPointer(), nr * nc, ElementCos<T>());
+ return r;
+}
+
+template<class T>
+void elementExp(const T *a, T *b, int count)
+{
+ elementMap(a, b, count, ElementExp<T>());
+}
+
+template<int nr, int nc, class T>
+Matrix<nr, nc, T> elementExp(const Matrix<nr, nc, T> &m)
+{
+ Matrix<nr, nc, T> r;
+ elementMap(m.Matrix<nr, nc, T>::getElementsPointer(),
+            r.Matrix<nr, nc, T>::getElementsPointer(), nr * nc, ElementExp<T>());
+ return r;
+}
+
+
+#endif
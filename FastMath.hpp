@@ -0,0 +1,580 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FastMath.hpp
+// Description          : Fast approximations of elementary functions
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_FastMath_hpp
+#define INCLUDED_FastMath_hpp
+
+#include <math.h>
+#include "Simd.hpp"
+
+#if defined(__GLIBC__) && defined(_GNU_SOURCE)
+#define QMATH_SINCOS
+#endif
+ // Defined where the C library has sincos() and sincosf().
+
+//========================================================================
+/*! \enum _QMathTrig
+    \brief Evaluation of trigonometric functions */
+//========================================================================
+typedef enum _QMathTrig
+{
+ QMathTrig_exact = 0x00,  //!< The functions of the C library.
+ QMathTrig_fast  = 0x01   //!< The Simd4 approximations of this file, four values at a time.
+}QMathTrig_t;
+
+#ifdef QMATH_FAST_TRIG
+#define QMATH_TRIG QMathTrig_fast
+#else
+#define QMATH_TRIG QMathTrig_exact
+#endif
+ // The default of the functions that take a QMathTrig_t argument, such
+ // as rpyRotation() and Transform::getRollPitchYaw(). Define
+ // QMATH_FAST_TRIG when compiling to make the approximations the
+ // default for a whole program; pass the argument to choose per call.
+
+//========================================================================
+// Fast approximations
+// -----------------------------------------------------------------------
+// \brief
+// Approximations of elementary functions that trade a documented loss
+// of accuracy for speed. The accuracy of each function is given as the
+// largest error over the stated range of arguments.
+//
+// The functions of \c Simd4 arguments compute four values at a time.
+// For float and double they reduce the argument to a small interval
+// and evaluate a polynomial, using only the arithmetic of \c Simd4, so
+// that they are branch free and run in SIMD registers. For other types
+// they call the functions of the standard library for each value.
+//
+// <b>Example Program:</b>
+// \include FastMath.t.cpp
+//========================================================================
+
+inline float fastInverseSqrt(float x);
+ // Approximates 1 / sqrt(x) for x > 0. With SSE this is the rsqrtss
+ // estimate refined by one Newton-Raphson step, otherwise a bit-level
+ // initial guess refined by two Newton-Raphson steps.
+ //  return  1 / sqrt(x) with a relative error below 5e-6 (below 5e-7
+ //          with SSE). The result for x <= 0 is undefined.
+
+inline double fastInverseSqrt(double x);
+ // Approximates 1 / sqrt(x) for x > 0 by refining a single precision
+ // estimate with two Newton-Raphson steps in double precision. With
+ // SSE the exact 1 / sqrt(x) is returned instead: processors with SSE2
+ // pipeline double precision square roots and divisions, and computing
+ // them is faster than the refinement.
+ //  return  1 / sqrt(x) with a relative error below 1e-15 for
+ //          arguments within the range of normal floats. The result for
+ //          other arguments is undefined.
+
+template<class T>
+inline T fastInverseSqrt(const T &x);
+ // For other types (long double, FixedPoint) this is 1 / sqrt(x).
+
+inline void sinCos(float x, float &s, float &c);
+inline void sinCos(double x, double &s, double &c);
+template<class T>
+inline void sinCos(const T &x, T &s, T &c);
+ // Computes s = sin(x) and c = cos(x). Not an approximation: where the
+ // C library has sincos() (QMATH_SINCOS), both are computed in one call
+ // that shares the argument reduction, otherwise sin() and cos() are
+ // called.
+
+inline Simd4<float> fastSin(const Simd4<float> &x);
+inline Simd4<float> fastCos(const Simd4<float> &x);
+inline Simd4<double> fastSin(const Simd4<double> &x);
+inline Simd4<double> fastCos(const Simd4<double> &x);
+ // Approximate sine and cosine of the four lanes of x.
+ //  return  sin(x) and cos(x) with an absolute error below 1e-15 for
+ //          double and |x| <= 1e5, and below 5e-7 for float and
+ //          |x| <= 8192. The error grows with |x| beyond that range.
+
+inline void fastSinCos(const Simd4<float> &x, Simd4<float> &s, Simd4<float> &c);
+inline void fastSinCos(const Simd4<double> &x, Simd4<double> &s, Simd4<double> &c);
+ // Computes s = fastSin(x) and c = fastCos(x) with one argument
+ // reduction and both polynomials. Same accuracy as fastSin().
+
+inline Simd4<float> fastAtan2(const Simd4<float> &y, const Simd4<float> &x);
+inline Simd4<double> fastAtan2(const Simd4<double> &y, const Simd4<double> &x);
+ // Approximate atan2(y, x) of the four lanes, for finite arguments.
+ // The result is 0 when both arguments are zero, and pi (not -pi) for
+ // y = -0 and x < 0.
+ //  return  The angle in [-pi, pi] with an absolute error below 5e-16
+ //          for double and 4e-7 for float.
+
+inline Simd4<float> fastAsin(const Simd4<float> &x);
+inline Simd4<double> fastAsin(const Simd4<double> &x);
+ // Approximate asin(x) of the four lanes for |x| <= 1, computed as
+ // fastAtan2(x, sqrt((1 - x)(1 + x))).
+ //  return  The angle in [-pi/2, pi/2] with an absolute error below
+ //          5e-16 for double and 3e-7 for float.
+
+inline Simd4<float> fastExp(const Simd4<float> &x);
+inline Simd4<double> fastExp(const Simd4<double> &x);
+ // Approximate exponential of the four lanes of x. Arguments are
+ // clamped to [-87, 88] for float and to [-708, 709] for double, so
+ // that the result is a normal number.
+ //  return  exp(x) with a relative error below 5e-16 for double and
+ //          below 3e-7 for float within these ranges.
+
+template<class T>
+inline Simd4<T> fastSin(const Simd4<T> &x);
+template<class T>
+inline Simd4<T> fastCos(const Simd4<T> &x);
+template<class T>
+inline Simd4<T> fastExp(const Simd4<T> &x);
+template<class T>
+inline void fastSinCos(const Simd4<T> &x, Simd4<T> &s, Simd4<T> &c);
+template<class T>
+inline Simd4<T> fastAtan2(const Simd4<T> &y, const Simd4<T> &x);
+template<class T>
+inline Simd4<T> fastAsin(const Simd4<T> &x);
+ // For other types these call sin(), cos(), exp(), atan2() and asin()
+ // for each lane.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// fastInverseSqrt
+//========================================================================
+float fastInverseSqrt(float x)
+{
+#ifdef QMATH_SSE
+ float y;
+ _mm_store_ss(&y, _mm_rsqrt_ss(_mm_set_ss(x)));
+ return y * (1.5f - 0.5f * x * y * y);
+#else
+ union { float f; int i; } u;
+ u.f = x;
+ u.i = 0x5f375a86 - (u.i >> 1);
+ float y = u.f;
+ y = y * (1.5f - 0.5f * x * y * y);
+ return y * (1.5f - 0.5f * x * y * y);
+#endif
+}
+
+double fastInverseSqrt(double x)
+{
+#ifdef QMATH_SSE
+ return 1 / sqrt(x);
+#else
+ double y = fastInverseSqrt((float)x);
+ y = y * (1.5 - 0.5 * x * y * y);
+ return y * (1.5 - 0.5 * x * y * y);
+#endif
+}
+
+template<class T>
+T fastInverseSqrt(const T &x)
+{
+ return (T)1 / sqrt(x);
+}
+
+
+//========================================================================
+// sinCos
+//========================================================================
+void sinCos(float x, float &s, float &c)
+{
+#ifdef QMATH_SINCOS
+ ::sincosf(x, &s, &c);
+#else
+ s = sinf(x);
+ c = cosf(x);
+#endif
+}
+
+void sinCos(double x, double &s, double &c)
+{
+#ifdef QMATH_SINCOS
+ ::sincos(x, &s, &c);
+#else
+ s = sin(x);
+ c = cos(x);
+#endif
+}
+
+template<class T>
+void sinCos(const T &x, T &s, T &c)
+{
+ s = sin(x);
+ c = cos(x);
+}
+
+
+//========================================================================
+// FastMathConstants
+//   Internal. Reduction constants and polynomial coefficients of the
+//   Simd4 approximations. pio2a + pio2b + pio2c and ln2a + ln2b split
+//   pi/2 and ln(2) so that k * pio2a and k * ln2a are exact for the
+//   integers k that occur. The polynomials approximate sin(r) / r - 1
+//   and cos(r) - 1 + r^2/2 in powers of z = r^2 for |r| <= pi/4 (minimax
+//   coefficients from Cephes), exp(r) for |r| <= ln(2)/2 (Taylor
+//   coefficients), and atan(t) / t - 1 = z P(z) / Q(z) for
+//   |t| <= tan(pi/8) (Cephes; Q is 1 for float). Coefficients are
+//   listed from the highest power.
+//========================================================================
+template<class T> class FastMathConstants;
+
+template<>
+class FastMathConstants<float>
+{
+ public:
+  enum { sinTerms = 3, cosTerms = 3, expTerms = 8, atanPTerms = 4, atanQTerms = 1 };
+  static inline float twoOverPi() { return 0.636619772367581f; }
+  static inline float pio2a() { return 1.5703125f; }
+  static inline float pio2b() { return 4.837512969970703125e-4f; }
+  static inline float pio2c() { return 7.54978995489188216e-8f; }
+  static inline float log2e() { return 1.44269504088896341f; }
+  static inline float ln2a() { return 0.693359375f; }
+  static inline float ln2b() { return -2.12194440e-4f; }
+  static inline float expMin() { return -87.0f; }
+  static inline float expMax() { return 88.0f; }
+  static inline const float *sinPoly()
+  { static const float c[] = { -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f }; return c; }
+  static inline const float *cosPoly()
+  { static const float c[] = { 2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f }; return c; }
+  static inline const float *expPoly()
+  {
+   static const float c[] = { 1.0f / 5040, 1.0f / 720, 1.0f / 120, 1.0f / 24,
+                              1.0f / 6, 0.5f, 1.0f, 1.0f };
+   return c;
+  }
+  static inline const float *atanP()
+  { static const float c[] = { 8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f, -3.33329491539e-1f }; return c; }
+  static inline const float *atanQ()
+  { static const float c[] = { 1.0f }; return c; }
+};
+
+template<>
+class FastMathConstants<double>
+{
+ public:
+  enum { sinTerms = 6, cosTerms = 6, expTerms = 13, atanPTerms = 5, atanQTerms = 6 };
+  static inline double twoOverPi() { return 0.636619772367581343076; }
+  static inline double pio2a() { return 1.57079632673412561417; }
+  static inline double pio2b() { return 6.07710050630396597660e-11; }
+  static inline double pio2c() { return 2.02226624871116645580e-21; }
+  static inline double log2e() { return 1.44269504088896340736; }
+  static inline double ln2a() { return 6.93147180369123816490e-1; }
+  static inline double ln2b() { return 1.90821492927058770002e-10; }
+  static inline double expMin() { return -708.0; }
+  static inline double expMax() { return 709.0; }
+  static inline const double *sinPoly()
+  {
+   static const double c[] = { 1.58962301576546568060e-10, -2.50507477628578072866e-8,
+                               2.75573136213857245213e-6, -1.98412698295895385996e-4,
+                               8.33333333332211858878e-3, -1.66666666666666307295e-1 };
+   return c;
+  }
+  static inline const double *cosPoly()
+  {
+   static const double c[] = { -1.13585365213876817300e-11, 2.08757008419747316778e-9,
+                               -2.75573141792967388112e-7, 2.48015872888517045348e-5,
+                               -1.38888888888730564116e-3, 4.16666666666665929218e-2 };
+   return c;
+  }
+  static inline const double *expPoly()
+  {
+   static const double c[] = { 1.0 / 479001600, 1.0 / 39916800, 1.0 / 3628800,
+                               1.0 / 362880, 1.0 / 40320, 1.0 / 5040, 1.0 / 720,
+                               1.0 / 120, 1.0 / 24, 1.0 / 6, 0.5, 1.0, 1.0 };
+   return c;
+  }
+  static inline const double *atanP()
+  {
+   static const double c[] = { -8.750608600031904122785e-1, -1.615753718733365076637e1,
+                               -7.500855792314704667340e1, -1.228866684490136173410e2,
+                               -6.485021904942025371773e1 };
+   return c;
+  }
+  static inline const double *atanQ()
+  {
+   static const double c[] = { 1.0, 2.485846490142306297962e1, 1.650270098316988542046e2,
+                               4.328810604912902668951e2, 4.853903996359136964868e2,
+                               1.945506571482613964425e2 };
+   return c;
+  }
+};
+
+
+//========================================================================
+// FastPolynomial, fastSinQuadrant
+//   Internal. FastPolynomial<n>::evaluate() computes
+//   c[0] z^(n-1) + ... + c[n-1] by Horner's rule, expanded at compile
+//   time. fastSinQuadrant computes sin(x + offset * pi/2): x is
+//   reduced to r = x - k pi/2 with |r| <= pi/4, and the quadrant
+//   q = (k + offset) mod 4 selects +-sin(r) or +-cos(r). The selection
+//   multiplies by 0 or 1 rather than branching, which is exact.
+//========================================================================
+template<int n>
+class FastPolynomial
+{
+ public:
+  template<class T>
+  static inline Simd4<T> evaluate(const Simd4<T> &z, const T *c)
+  { return FastPolynomial<n - 1>::evaluate(z, c) * z + Simd4<T>::broadcast(c[n - 1]); }
+};
+
+template<>
+class FastPolynomial<1>
+{
+ public:
+  template<class T>
+  static inline Simd4<T> evaluate(const Simd4<T> &, const T *c)
+  { return Simd4<T>::broadcast(c[0]); }
+};
+
+template<class T>
+inline Simd4<T> fastSinQuadrant(const Simd4<T> &x, const T &offset)
+{
+ typedef Simd4<T> S;
+ typedef FastMathConstants<T> K;
+ const S one = S::broadcast(1);
+ const S two = S::broadcast(2);
+
+ S k = (x * S::broadcast(K::twoOverPi())).round();
+ S r = ((x - k * S::broadcast(K::pio2a())) - k * S::broadcast(K::pio2b()))
+       - k * S::broadcast(K::pio2c());
+ S q = k + S::broadcast(offset);
+ q = q - S::broadcast(4) * (q * S::broadcast(0.25) - S::broadcast(0.375)).round();
+ S h = (q * S::broadcast(0.5) - S::broadcast(0.25)).round();  // 1 in quadrants 2, 3
+ S odd = q - two * h;                                         // 1 in quadrants 1, 3
+
+ S z = r * r;
+ S sn = r + r * z * FastPolynomial<K::sinTerms>::evaluate(z, K::sinPoly());
+ S cs = one - S::broadcast(0.5) * z + z * z * FastPolynomial<K::cosTerms>::evaluate(z, K::cosPoly());
+ return (odd * cs + (one - odd) * sn) * (one - two * h);
+}
+
+
+//========================================================================
+// fastSin, fastCos
+//========================================================================
+Simd4<float> fastSin(const Simd4<float> &x)
+{
+ return fastSinQuadrant(x, 0.0f);
+}
+
+Simd4<float> fastCos(const Simd4<float> &x)
+{
+ return fastSinQuadrant(x, 1.0f);
+}
+
+Simd4<double> fastSin(const Simd4<double> &x)
+{
+ return fastSinQuadrant(x, 0.0);
+}
+
+Simd4<double> fastCos(const Simd4<double> &x)
+{
+ return fastSinQuadrant(x, 1.0);
+}
+
+template<class T>
+Simd4<T> fastSin(const Simd4<T> &x)
+{
+ T v[4];
+ x.store(v);
+ for(int i = 0; i < 4; ++i)
+  v[i] = sin(v[i]);
+ return Simd4<T>::load(v);
+}
+
+template<class T>
+Simd4<T> fastCos(const Simd4<T> &x)
+{
+ T v[4];
+ x.store(v);
+ for(int i = 0; i < 4; ++i)
+  v[i] = cos(v[i]);
+ return Simd4<T>::load(v);
+}
+
+
+//========================================================================
+// fastSinCos
+//   As fastSinQuadrant, with the quadrant of the cosine one after that
+//   of the sine.
+//========================================================================
+template<class T>
+inline void fastSinCosReduced(const Simd4<T> &x, Simd4<T> &s, Simd4<T> &c)
+{
+ typedef Simd4<T> S;
+ typedef FastMathConstants<T> K;
+ const S one = S::broadcast(1);
+ const S two = S::broadcast(2);
+ const S four = S::broadcast(4);
+ const S half = S::broadcast(0.5);
+
+ S k = (x * S::broadcast(K::twoOverPi())).round();
+ S r = ((x - k * S::broadcast(K::pio2a())) - k * S::broadcast(K::pio2b()))
+       - k * S::broadcast(K::pio2c());
+ S qs = k - four * (k * S::broadcast(0.25) - S::broadcast(0.375)).round();
+ S qc = qs + one;
+ qc = qc - four * qc.greater(S::broadcast(3.5));
+ S hs = (qs * half - S::broadcast(0.25)).round(), hc = (qc * half - S::broadcast(0.25)).round();
+ S odd = qs - two * hs;                                       // 1 in quadrants 1, 3 of the sine
+
+ S z = r * r;
+ S sn = r + r * z * FastPolynomial<K::sinTerms>::evaluate(z, K::sinPoly());
+ S cs = one - half * z + z * z * FastPolynomial<K::cosTerms>::evaluate(z, K::cosPoly());
+ S d = odd * (cs - sn);
+ s = (sn + d) * (one - two * hs);
+ c = (cs - d) * (one - two * hc);
+}
+
+void fastSinCos(const Simd4<float> &x, Simd4<float> &s, Simd4<float> &c)
+{
+ fastSinCosReduced(x, s, c);
+}
+
+void fastSinCos(const Simd4<double> &x, Simd4<double> &s, Simd4<double> &c)
+{
+ fastSinCosReduced(x, s, c);
+}
+
+template<class T>
+void fastSinCos(const Simd4<T> &x, Simd4<T> &s, Simd4<T> &c)
+{
+ s = fastSin(x);
+ c = fastCos(x);
+}
+
+
+//========================================================================
+// fastAtan2, fastAsin
+//   With a = min(|x|, |y|) and b = max(|x|, |y|), atan(a / b) is
+//   computed as atan(t) for t = a / b, or as pi/4 + atan(t) for
+//   t = (a - b) / (a + b) when a / b > tan(pi/8), so that
+//   |t| <= tan(pi/8). The octant is then restored by reflections,
+//   selected by multiplying with 0 or 1 as in fastSinQuadrant.
+//========================================================================
+template<class T>
+inline Simd4<T> fastAtan2Reduced(const Simd4<T> &y, const Simd4<T> &x)
+{
+ typedef Simd4<T> S;
+ typedef FastMathConstants<T> K;
+ const S zero = S::broadcast(0);
+ const S one = S::broadcast(1);
+ const S two = S::broadcast(2);
+ const S pi = S::broadcast((T)3.14159265358979323846);
+
+ S ax = x.abs(), ay = y.abs();
+ S a = ax.minimum(ay), b = ax.maximum(ay);
+ S g = a.greater(b * S::broadcast((T)0.41421356237309504880));
+ S den = b + g * a;
+ den = den + (one - den.greater(zero));                       // 1 when both are zero
+ S t = (a - g * b) / den;
+ S z = t * t;
+ S p = z * FastPolynomial<K::atanPTerms>::evaluate(z, K::atanP());
+ if(K::atanQTerms > 1)
+  p = p / FastPolynomial<K::atanQTerms>::evaluate(z, K::atanQ());
+ S r = t + t * p + g * S::broadcast((T)0.78539816339744830962);
+ r = r + ay.greater(ax) * (S::broadcast((T)1.57079632679489661923) - two * r);
+ r = r + zero.greater(x) * (pi - two * r);
+ return r * (one - two * zero.greater(y));
+}
+
+Simd4<float> fastAtan2(const Simd4<float> &y, const Simd4<float> &x)
+{
+ return fastAtan2Reduced(y, x);
+}
+
+Simd4<double> fastAtan2(const Simd4<double> &y, const Simd4<double> &x)
+{
+ return fastAtan2Reduced(y, x);
+}
+
+Simd4<float> fastAsin(const Simd4<float> &x)
+{
+ const Simd4<float> one = Simd4<float>::broadcast(1);
+ return fastAtan2Reduced(x, ((one - x) * (one + x)).sqrt());
+}
+
+Simd4<double> fastAsin(const Simd4<double> &x)
+{
+ const Simd4<double> one = Simd4<double>::broadcast(1);
+ return fastAtan2Reduced(x, ((one - x) * (one + x)).sqrt());
+}
+
+template<class T>
+Simd4<T> fastAtan2(const Simd4<T> &y, const Simd4<T> &x)
+{
+ T u[4], v[4];
+ y.store(u);
+ x.store(v);
+ for(int i = 0; i < 4; ++i)
+  v[i] = atan2(u[i], v[i]);
+ return Simd4<T>::load(v);
+}
+
+template<class T>
+Simd4<T> fastAsin(const Simd4<T> &x)
+{
+ T v[4];
+ x.store(v);
+ for(int i = 0; i < 4; ++i)
+  v[i] = asin(v[i]);
+ return Simd4<T>::load(v);
+}
+
+
+//========================================================================
+// fastExp
+//   exp(x) = 2^k exp(r) with k = round(x / ln(2)) and |r| <= ln(2)/2.
+//========================================================================
+template<class T>
+inline Simd4<T> fastExpReduced(const Simd4<T> &x)
+{
+ typedef Simd4<T> S;
+ typedef FastMathConstants<T> K;
+ S y = x.maximum(S::broadcast(K::expMin())).minimum(S::broadcast(K::expMax()));
+ S k = (y * S::broadcast(K::log2e())).round();
+ S r = (y - k * S::broadcast(K::ln2a())) - k * S::broadcast(K::ln2b());
+ return FastPolynomial<K::expTerms>::evaluate(r, K::expPoly()) * k.pow2();
+}
+
+Simd4<float> fastExp(const Simd4<float> &x)
+{
+ return fastExpReduced(x);
+}
+
+Simd4<double> fastExp(const Simd4<double> &x)
+{
+ return fastExpReduced(x);
+}
+
+template<class T>
+Simd4<T> fastExp(const Simd4<T> &x)
+{
+ T v[4];
+ x.store(v);
+ for(int i = 0; i < 4; ++i)
+  v[i] = exp(v[i]);
+ return Simd4<T>::load(v);
+}
+
+
+#endif
@@ -0,0 +1,464 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FixedPoint.hpp
+// Description          : Saturating fixed-point (Q-format) scalar type
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_FixedPoint_hpp
+#define INCLUDED_FixedPoint_hpp
+
+#include <iostream>
+#include <limits>
+#include "NumericTraits.hpp"
+
+#ifndef QMATH_FIXED_COEFFICIENT_BITS
+#define QMATH_FIXED_COEFFICIENT_BITS 24
+#endif
+ // Number of fractional bits of the coefficients that filters,
+ // integrators and differentiators precompute for fixed-point data.
+ // Coefficients are stored in 32 bits, so the default of 24 leaves a
+ // range of +/-128. Define a smaller value before including this file
+ // if larger coefficients are needed. (Differentiator splits the
+ // reciprocal of its sampling period into a coefficient in range and
+ // exact products by powers of two.)
+
+template<class A, class B, bool aIsWider = (sizeof(A) >= sizeof(B))>
+class FixedPointWider
+{
+ public:
+  typedef A Type;
+};
+
+template<class A, class B>
+class FixedPointWider<A, B, false>
+{
+ public:
+  typedef B Type;
+};
+
+
+//========================================================================
+// class FixedPoint
+// -----------------------------------------------------------------------
+// \brief
+// A saturating fixed-point number with F fractional bits.
+//
+// The value is stored as an integer of type S scaled by 2^F. Products
+// and quotients are computed in the wider integer type W, rounded, and
+// saturated to the range of S, so that an overflow clips to the largest
+// representable magnitude instead of wrapping around. Sums saturate in
+// the same way. Conversions from double take place only when a value
+// is constructed, which means that the type can be used as T in Matrix,
+// LowpassFilter, HighpassFilter, Integrator and Differentiator on
+// processors without a floating point unit: the filter coefficients are
+// computed in double when the filter is configured, and stored in
+// NumericTraits<FixedPoint>::CoefficientType.
+//
+// The common formats are provided as typedefs:
+// - Q15: 16 bit storage, range [-1, 1), resolution 2^-15.
+// - Q31: 32 bit storage, range [-1, 1), resolution 2^-31.
+// Other formats are obtained with the template parameters, for instance
+// FixedPoint<16> for 16.16 numbers in an int.
+//
+// A product of two different formats has the format of the right-hand
+// operand, which is the natural choice for coefficient * sample.
+//
+// <b>Example Program:</b>
+// \include FixedPoint.t.cpp
+//========================================================================
+
+template<int F, class S = int, class W = long long>
+class FixedPoint
+{
+ public:
+  inline FixedPoint() : d_raw(0) {}
+   // The default constructor. The value is zero.
+
+  inline FixedPoint(int i);
+   // Conversion from an integer, saturated to the range of the format.
+
+  inline FixedPoint(double d);
+   // Conversion from a floating point number, rounded to the nearest
+   // representable value and saturated to the range of the format.
+
+  template<int F2, class S2, class W2>
+  inline FixedPoint(const FixedPoint<F2, S2, W2> &x);
+   // Conversion from another fixed-point format, rounded and saturated.
+
+  ~FixedPoint() {}
+   // The default destructor.
+
+  template<class V>
+  static inline FixedPoint fromRaw(V raw);
+   //  return  The number whose scaled integer representation is \a raw,
+   //          saturated to the range of S.
+
+  inline S getRaw() const { return d_raw; }
+   //  return  The scaled integer representation (value * 2^F).
+
+  inline double toDouble() const;
+   //  return  The value as a double.
+
+  inline int toInt() const;
+   //  return  The value rounded towards minus infinity.
+
+  static inline FixedPoint maxValue();
+   //  return  The largest representable value.
+
+  static inline FixedPoint minValue();
+   //  return  The smallest (most negative) representable value.
+
+  static inline FixedPoint resolution();
+   //  return  The smallest positive value, 2^-F.
+
+  inline FixedPoint &operator+=(const FixedPoint &x);
+  inline FixedPoint &operator-=(const FixedPoint &x);
+  inline FixedPoint &operator*=(const FixedPoint &x);
+  inline FixedPoint &operator/=(const FixedPoint &x);
+   // Saturating arithmetic. Division by zero saturates to the largest
+   // magnitude with the sign of the dividend.
+
+  inline FixedPoint operator-() const;
+   //  return  The negated value (saturated for the most negative value).
+
+  friend inline FixedPoint operator+(const FixedPoint &a, const FixedPoint &b) { FixedPoint r(a); return r += b; }
+  friend inline FixedPoint operator-(const FixedPoint &a, const FixedPoint &b) { FixedPoint r(a); return r -= b; }
+  friend inline FixedPoint operator*(const FixedPoint &a, const FixedPoint &b) { FixedPoint r(a); return r *= b; }
+  friend inline FixedPoint operator/(const FixedPoint &a, const FixedPoint &b) { FixedPoint r(a); return r /= b; }
+  friend inline bool operator==(const FixedPoint &a, const FixedPoint &b) { return a.d_raw == b.d_raw; }
+  friend inline bool operator!=(const FixedPoint &a, const FixedPoint &b) { return a.d_raw != b.d_raw; }
+  friend inline bool operator<(const FixedPoint &a, const FixedPoint &b) { return a.d_raw < b.d_raw; }
+  friend inline bool operator<=(const FixedPoint &a, const FixedPoint &b) { return a.d_raw <= b.d_raw; }
+  friend inline bool operator>(const FixedPoint &a, const FixedPoint &b) { return a.d_raw > b.d_raw; }
+  friend inline bool operator>=(const FixedPoint &a, const FixedPoint &b) { return a.d_raw >= b.d_raw; }
+   // Arithmetic and comparison between numbers of the same format.
+   // Integer and floating point operands are converted to the format
+   // first.
+
+  // ========== END OF INTERFACE ==========
+
+ protected:
+  S d_raw;
+};
+
+
+typedef FixedPoint<15, short, int> Q15;
+ // 16 bit fixed-point number in [-1, 1).
+
+typedef FixedPoint<31, int, long long> Q31;
+ // 32 bit fixed-point number in [-1, 1).
+
+
+template<int F1, class S1, class W1, int F2, class S2, class W2>
+inline FixedPoint<F2, S2, W2> operator*(const FixedPoint<F1, S1, W1> &a, const FixedPoint<F2, S2, W2> &b);
+ // Product of two numbers of different formats.
+ //  return  a * b in the format of \a b.
+
+template<int F, class S, class W>
+inline FixedPoint<F, S, W> fabs(const FixedPoint<F, S, W> &x);
+ //  return  The absolute value of \a x.
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> sqrt(const FixedPoint<F, S, W> &x);
+ //  return  The square root of \a x, computed with integer
+ //          arithmetic. Zero for negative \a x.
+
+template<int F, class S, class W>
+std::ostream &operator<<(std::ostream &out, const FixedPoint<F, S, W> &x);
+ // Prints the value as a floating point number.
+
+template<int F, class S, class W>
+std::istream &operator>>(std::istream &in, FixedPoint<F, S, W> &x);
+ // Reads a floating point number.
+
+
+//========================================================================
+// class NumericTraits<FixedPoint>
+// -----------------------------------------------------------------------
+// Sums of products are accumulated with the same number of fractional
+// bits in the wide type W, so that intermediate results in filters and
+// matrix products do not saturate. The singularity threshold is one
+// unit in the last place.
+//========================================================================
+template<int F, class S, class W>
+class NumericTraits<FixedPoint<F, S, W> >
+{
+ public:
+  typedef FixedPoint<F, W, W> AccumulatorType;
+  typedef FixedPoint<F, S, W> ScalarType;
+  typedef FixedPoint<QMATH_FIXED_COEFFICIENT_BITS, int, long long> CoefficientType;
+  static inline FixedPoint<F, S, W> epsilon() { return FixedPoint<F, S, W>::resolution(); }
+};
+
+
+//========================================================================
+// End of declarations.
+//========================================================================
+
+
+//========================================================================
+// FixedPoint::FixedPoint
+//========================================================================
+template<int F, class S, class W>
+FixedPoint<F, S, W>::FixedPoint(int i)
+{
+ const W one = (W)1 << F;
+ if( (W)i > (W)std::numeric_limits<S>::max() / one )
+  d_raw = std::numeric_limits<S>::max();
+ else if( (W)i < (W)std::numeric_limits<S>::min() / one )
+  d_raw = std::numeric_limits<S>::min();
+ else
+  d_raw = (S)((W)i * one);
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W>::FixedPoint(double d)
+{
+ double v = d * (double)((W)1 << F);
+ v += (v < 0) ? -0.5 : 0.5;
+ if( v >= (double)std::numeric_limits<S>::max() )
+  d_raw = std::numeric_limits<S>::max();
+ else if( v <= (double)std::numeric_limits<S>::min() )
+  d_raw = std::numeric_limits<S>::min();
+ else
+  d_raw = (S)v;
+}
+
+
+template<int F, class S, class W>
+template<int F2, class S2, class W2>
+FixedPoint<F, S, W>::FixedPoint(const FixedPoint<F2, S2, W2> &x)
+{
+ typedef typename FixedPointWider<W, W2>::Type V;
+ V v = (V)x.getRaw();
+ if( F >= F2 )
+ {
+  const int shift = (F >= F2) ? (F - F2) : 0;
+  const V scale = (V)1 << shift;
+  if( v > (V)std::numeric_limits<S>::max() / scale )
+   v = (V)std::numeric_limits<S>::max();
+  else if( v < (V)std::numeric_limits<S>::min() / scale )
+   v = (V)std::numeric_limits<S>::min();
+  else
+   v *= scale;
+ }
+ else
+ {
+  const int shift = (F2 > F) ? (F2 - F) : 0;
+  v = (v + ((V)1 << ((shift > 0) ? (shift - 1) : 0))) >> shift;
+ }
+ *this = fromRaw(v);
+}
+
+
+//========================================================================
+// FixedPoint::fromRaw
+//========================================================================
+template<int F, class S, class W>
+template<class V>
+FixedPoint<F, S, W> FixedPoint<F, S, W>::fromRaw(V raw)
+{
+ typedef typename FixedPointWider<V, S>::Type U;
+ FixedPoint x;
+ if( (U)raw > (U)std::numeric_limits<S>::max() )
+  x.d_raw = std::numeric_limits<S>::max();
+ else if( (U)raw < (U)std::numeric_limits<S>::min() )
+  x.d_raw = std::numeric_limits<S>::min();
+ else
+  x.d_raw = (S)raw;
+ return x;
+}
+
+
+//========================================================================
+// FixedPoint::toDouble
+//========================================================================
+template<int F, class S, class W>
+double FixedPoint<F, S, W>::toDouble() const
+{
+ return (double)d_raw / (double)((W)1 << F);
+}
+
+
+//========================================================================
+// FixedPoint::toInt
+//========================================================================
+template<int F, class S, class W>
+int FixedPoint<F, S, W>::toInt() const
+{
+ return (int)((W)d_raw >> F);
+}
+
+
+//========================================================================
+// FixedPoint::maxValue, minValue, resolution
+//========================================================================
+template<int F, class S, class W>
+FixedPoint<F, S, W> FixedPoint<F, S, W>::maxValue()
+{
+ return fromRaw(std::numeric_limits<S>::max());
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> FixedPoint<F, S, W>::minValue()
+{
+ return fromRaw(std::numeric_limits<S>::min());
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> FixedPoint<F, S, W>::resolution()
+{
+ return fromRaw(1);
+}
+
+
+//========================================================================
+// FixedPoint arithmetic
+//========================================================================
+template<int F, class S, class W>
+FixedPoint<F, S, W> &FixedPoint<F, S, W>::operator+=(const FixedPoint &x)
+{
+ *this = fromRaw((W)d_raw + (W)x.d_raw);
+ return *this;
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> &FixedPoint<F, S, W>::operator-=(const FixedPoint &x)
+{
+ *this = fromRaw((W)d_raw - (W)x.d_raw);
+ return *this;
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> &FixedPoint<F, S, W>::operator*=(const FixedPoint &x)
+{
+ W p = (W)d_raw * (W)x.d_raw;
+ p = (p + ((W)1 << (F - 1))) >> F;
+ *this = fromRaw(p);
+ return *this;
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> &FixedPoint<F, S, W>::operator/=(const FixedPoint &x)
+{
+ if( x.d_raw == 0 )
+ {
+  d_raw = (d_raw < 0) ? std::numeric_limits<S>::min() : std::numeric_limits<S>::max();
+  return *this;
+ }
+ W n = (W)d_raw * ((W)1 << F);
+ *this = fromRaw(n / (W)x.d_raw);
+ return *this;
+}
+
+
+template<int F, class S, class W>
+FixedPoint<F, S, W> FixedPoint<F, S, W>::operator-() const
+{
+ return fromRaw(-(W)d_raw);
+}
+
+
+template<int F1, class S1, class W1, int F2, class S2, class W2>
+FixedPoint<F2, S2, W2> operator*(const FixedPoint<F1, S1, W1> &a, const FixedPoint<F2, S2, W2> &b)
+{
+ typedef typename FixedPointWider<W1, W2>::Type V;
+ V p = (V)a.getRaw() * (V)b.getRaw();
+ p = (p + ((V)1 << (F1 - 1))) >> F1;
+ return FixedPoint<F2, S2, W2>::fromRaw(p);
+}
+
+
+//========================================================================
+// fabs
+//========================================================================
+template<int F, class S, class W>
+FixedPoint<F, S, W> fabs(const FixedPoint<F, S, W> &x)
+{
+ return (x.getRaw() < 0) ? -x : x;
+}
+
+
+//========================================================================
+// sqrt
+//========================================================================
+template<int F, class S, class W>
+FixedPoint<F, S, W> sqrt(const FixedPoint<F, S, W> &x)
+{
+ if( x.getRaw() <= 0 )
+  return FixedPoint<F, S, W>();
+
+ // sqrt(raw * 2^F) = sqrt(raw * 2^a) * 2^((F - a)/2), with the
+ // pre-shift a as large as the 64 bit intermediate allows
+ unsigned long long v = (unsigned long long)x.getRaw();
+ int a = F;
+ while( (a > 0) && (v >> (62 - a)) )
+  --a;
+ if( (F - a) & 1 )
+  --a;
+ v <<= a;
+
+ unsigned long long root = 0;
+ unsigned long long bit = 1ULL << 62;
+ while( bit > v )
+  bit >>= 2;
+ while( bit != 0 )
+ {
+  if( v >= root + bit )
+  {
+   v -= root + bit;
+   root = (root >> 1) + bit;
+  }
+  else
+   root >>= 1;
+  bit >>= 2;
+ }
+ return FixedPoint<F, S, W>::fromRaw((long long)(root << ((F - a) / 2)));
+}
+
+
+//========================================================================
+// operator<<, operator>>
+//========================================================================
+template<int F, class S, class W>
+std::ostream &operator<<(std::ostream &out, const FixedPoint<F, S, W> &x)
+{
+ out << x.toDouble();
+ return out;
+}
+
+
+template<int F, class S, class W>
+std::istream &operator>>(std::istream &in, FixedPoint<F, S, W> &x)
+{
+ double d;
+ in >> d;
+ x = d;
+ return in;
+}
+
+
+#endif
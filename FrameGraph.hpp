@@ -0,0 +1,541 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FrameGraph.hpp
+// Description          : Time-stamped tree of coordinate frames
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_FrameGraph_hpp
+#define INCLUDED_FrameGraph_hpp
+
+#include <math.h>
+#include "Quaternion.hpp"
+#include "RigidTransform.hpp"
+#include "MathException.hpp"
+
+#if defined(_MSC_VER)
+ #include <intrin.h>
+ #define QMATH_MEMORY_BARRIER() _ReadWriteBarrier()
+#elif defined(__GNUC__)
+ #define QMATH_MEMORY_BARRIER() __sync_synchronize()
+#endif
+ // Keeps the compiler and the processor from moving memory accesses
+ // across it. On x86 loads are not reordered with loads nor stores with
+ // stores, so that a compiler barrier is enough for MSVC.
+
+template<int n, int depth> class FrameLookup;
+
+//====================================================================
+// class FrameGraph
+// -------------------------------------------------------------------
+// \brief
+// A tree of n coordinate frames whose relative poses change with time.
+//
+// Frames are numbered 1 to n. Every frame has a parent frame (or none,
+// for the root of a tree) and an edge that holds the last \a depth
+// poses of the frame relative to its parent, each with its time. A
+// static edge, such as the mount of a sensor, holds one pose that is
+// valid at all times. getTransform() returns the pose of one frame
+// relative to any other frame of the same tree at a given time: the
+// poses of the edges on the path between the two frames are
+// interpolated at that time (straight line for the origin, slerp()
+// for the orientation) and composed as \c RigidTransform. Times
+// outside the history of an edge are not extrapolated. The history is
+// a ring buffer, so adding a pose costs the same however long the
+// graph has been running, and nothing is allocated.
+//
+// One writer thread may add poses while any number of threads read.
+// Readers never block the writer and never wait for a lock: every edge
+// has a sequence number that the writer makes odd before and even
+// after changing the edge, and a reader copies what it needs from the
+// edge and starts again if the sequence number was odd or changed in
+// the meantime. The tree itself (setParent()) must be set up before
+// reading starts.
+//
+// A thread that makes many lookups should use a \c FrameLookup, which
+// keeps the poses of the frames relative to the root of their tree and
+// recomputes them only when an edge on the path has been updated. The
+// object is large (about 72 n depth bytes); allocate it with new or
+// make it static.
+//
+// <b>Example Program:</b>
+// \include FrameGraph.t.cpp
+//========================================================================
+
+template<int n, int depth = 32>
+class FrameGraph
+{
+ public:
+  inline FrameGraph();
+   // The default constructor. Every frame is the root of its own tree
+   // and has no poses.
+
+  ~FrameGraph() {}
+   // The default destructor.
+
+  inline void setParent(int frame, int parent);
+   // Attaches \a frame (1 to n) to \a parent (1 to n, or 0 to make it a
+   // root) and clears its poses. Throws an illegalIndex exception if
+   // either frame is out of range or if \a parent is \a frame or one
+   // of its descendants. Not to be called while other threads read.
+
+  inline int getParent(int frame) const;
+   //  return  The parent of \a frame, 0 for a root.
+
+  inline bool setTransform(int frame, double time, const Transform &pose);
+   // Adds the pose of \a frame relative to its parent at \a time. The
+   // oldest pose is dropped once the edge holds \a depth poses. Only
+   // the rotational and translational parts of \a pose are used, the
+   // rotation is assumed to be orthonormal.
+   //  return  false, and nothing is added, if \a time is not later
+   //          than the newest pose of the edge or the edge is static.
+
+  inline void setStaticTransform(int frame, const Transform &pose);
+   // Replaces the poses of \a frame by one that is valid at all times.
+
+  bool getTransform(int frame, double time, Transform &pose) const;
+   // The pose of \a frame relative to its parent at \a time.
+   //  return  false if \a time is outside the history of the edge.
+
+  bool getTransform(int a, int b, double time, Transform &pose) const;
+   // The pose of frame \a b relative to frame \a a (aTb) at \a time.
+   //  return  false if the frames are not in the same tree, or if
+   //          \a time is outside the history of an edge on the path.
+
+  bool getTransform(int a, int b, Transform &pose) const;
+   // As above, from the newest pose of every edge on the path.
+
+ private:
+  friend class FrameLookup<n, depth>;
+  inline void checkIndex(int i, int first) const;
+  inline void beginWrite(int i);
+  inline void endWrite(int i);
+  bool edge(int i, double time, RigidTransform<> &pose, unsigned int &sequence) const;
+  bool path(int a, int b, double time, Transform &pose) const;
+
+  int d_parent[n];                            // 0 for a root
+  bool d_static[n];
+  volatile unsigned int d_sequence[n];        // odd while the edge is written
+  int d_newest[n];                            // slot of the newest pose
+  int d_count[n];                             // number of poses
+  double d_time[n][depth];
+  Quaternion<> d_rotation[n][depth];
+  Vec3<> d_position[n][depth];
+};
+
+
+//====================================================================
+// class FrameLookup
+// -------------------------------------------------------------------
+// \brief
+// Cached lookups in a \c FrameGraph, for one reading thread.
+//
+// Keeps, for every frame, its pose relative to the root of its tree at
+// the time of the last lookup that involved it, together with the
+// sequence number of its edge and the version of the parent's cached
+// pose it was computed from. A lookup at the same time reuses the
+// cached poses of the frames whose edges and ancestors have not been
+// updated since, and composes the rest from the nearest valid
+// ancestor. Each thread needs its own \c FrameLookup.
+//========================================================================
+
+template<int n, int depth = 32>
+class FrameLookup
+{
+ public:
+  inline FrameLookup(const FrameGraph<n, depth> &graph);
+   // Constructs lookups into \a graph. Nothing is cached yet.
+
+  ~FrameLookup() {}
+   // The default destructor.
+
+  bool getTransform(int a, int b, double time, Transform &pose);
+  bool getTransform(int a, int b, Transform &pose);
+   // Same as \c FrameGraph::getTransform().
+
+ private:
+  bool update(int i, double time);
+  bool lookup(int a, int b, double time, Transform &pose);
+
+  const FrameGraph<n, depth> &d_graph;
+  RigidTransform<> d_pose[n];                 // pose relative to the root
+  double d_time[n];                           // time of d_pose
+  bool d_valid[n];
+  int d_root[n];
+  unsigned int d_sequence[n];                 // of the edge, for d_pose
+  unsigned int d_version[n];                  // incremented with d_pose
+  unsigned int d_parentVersion[n];            // of the parent, for d_pose
+};
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// FrameGraph::FrameGraph
+//========================================================================
+template<int n, int depth>
+FrameGraph<n, depth>::FrameGraph()
+{
+ for(int i = 0; i < n; ++i)
+ {
+  d_parent[i] = 0;
+  d_static[i] = false;
+  d_sequence[i] = 0;
+  d_newest[i] = depth - 1;
+  d_count[i] = 0;
+ }
+}
+
+
+//========================================================================
+// FrameGraph::checkIndex
+//========================================================================
+template<int n, int depth>
+void FrameGraph<n, depth>::checkIndex(int i, int first) const
+{
+ if( (i < first) || (i > n) )
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+}
+
+
+//========================================================================
+// FrameGraph::beginWrite, FrameGraph::endWrite
+//   Edge i (0-based) is being written while its sequence number is odd.
+//========================================================================
+template<int n, int depth>
+void FrameGraph<n, depth>::beginWrite(int i)
+{
+ d_sequence[i] = d_sequence[i] + 1;
+ QMATH_MEMORY_BARRIER();
+}
+
+template<int n, int depth>
+void FrameGraph<n, depth>::endWrite(int i)
+{
+ QMATH_MEMORY_BARRIER();
+ d_sequence[i] = d_sequence[i] + 1;
+}
+
+
+//========================================================================
+// FrameGraph::setParent, FrameGraph::getParent
+//========================================================================
+template<int n, int depth>
+void FrameGraph<n, depth>::setParent(int frame, int parent)
+{
+ checkIndex(frame, 1);
+ checkIndex(parent, 0);
+ for(int i = parent; i != 0; i = d_parent[i - 1])
+  if(i == frame)                              // would make a cycle
+  {
+   static MathException exception;
+   exception.setErrorType(QMathException_illegalIndex);
+   throw exception;
+  }
+ beginWrite(frame - 1);
+ d_parent[frame - 1] = parent;
+ d_static[frame - 1] = false;
+ d_count[frame - 1] = 0;
+ endWrite(frame - 1);
+}
+
+template<int n, int depth>
+int FrameGraph<n, depth>::getParent(int frame) const
+{
+ checkIndex(frame, 1);
+ return d_parent[frame - 1];
+}
+
+
+//========================================================================
+// FrameGraph::setTransform, FrameGraph::setStaticTransform
+//========================================================================
+template<int n, int depth>
+bool FrameGraph<n, depth>::setTransform(int frame, double time, const Transform &pose)
+{
+ checkIndex(frame, 1);
+ int i = frame - 1;
+ if( d_static[i] || ((d_count[i] > 0) && !(time > d_time[i][d_newest[i]])) )
+  return false;
+ const double *e = pose.Matrix<4, 4, double>::getElementsPointer(); // static call
+ Quaternion<> rotation(pose);
+ int slot = (d_newest[i] + 1) % depth;
+ beginWrite(i);
+ d_time[i][slot] = time;
+ d_rotation[i][slot] = rotation;
+ d_position[i][slot] = Vec3<>(e[3], e[7], e[11]);
+ d_newest[i] = slot;
+ if(d_count[i] < depth)
+  ++d_count[i];
+ endWrite(i);
+ return true;
+}
+
+template<int n, int depth>
+void FrameGraph<n, depth>::setStaticTransform(int frame, const Transform &pose)
+{
+ checkIndex(frame, 1);
+ int i = frame - 1;
+ const double *e = pose.Matrix<4, 4, double>::getElementsPointer(); // static call
+ Quaternion<> rotation(pose);
+ beginWrite(i);
+ d_time[i][0] = 0;
+ d_rotation[i][0] = rotation;
+ d_position[i][0] = Vec3<>(e[3], e[7], e[11]);
+ d_newest[i] = 0;
+ d_count[i] = 1;
+ d_static[i] = true;
+ endWrite(i);
+}
+
+
+//========================================================================
+// FrameGraph::edge
+//   The pose of edge i (0-based) at the given time, and the sequence
+//   number of the edge it was read at. HUGE_VAL stands for the newest
+//   pose. The two poses around the time are found by bisection over the
+//   ring buffer and copied; the copy is repeated if the writer changed
+//   the edge meanwhile. Indices read during a change are always in
+//   range, so a torn read is harmless until it is discarded.
+//========================================================================
+template<int n, int depth>
+bool FrameGraph<n, depth>::edge(int i, double time, RigidTransform<> &pose,
+                                unsigned int &sequence) const
+{
+ Quaternion<> q0, q1;
+ Vec3<> p0, p1;
+ double t0, t1;
+ bool found;
+ unsigned int s;
+ do
+ {
+  s = d_sequence[i];
+  QMATH_MEMORY_BARRIER();
+  int count = d_count[i], newest = d_newest[i];
+  int oldest = newest - count + 1 + depth;
+  found = (count > 0);
+  if(found)
+  {
+   int j0 = newest, j1 = newest;
+   if( !d_static[i] && (time != HUGE_VAL) )
+   {
+    // bisect for the last pose k (0 = oldest) with time_k <= time
+    int low = 0, high = count - 1;
+    if( (time < d_time[i][oldest % depth]) || (time > d_time[i][newest]) )
+     found = false;
+    while(low < high)
+    {
+     int mid = (low + high + 1) / 2;
+     if(d_time[i][(oldest + mid) % depth] <= time)
+      low = mid;
+     else
+      high = mid - 1;
+    }
+    j0 = (oldest + low) % depth;
+    j1 = (low < count - 1) ? (oldest + low + 1) % depth : j0;
+   }
+   t0 = d_time[i][j0];
+   t1 = d_time[i][j1];
+   q0 = d_rotation[i][j0];
+   q1 = d_rotation[i][j1];
+   p0 = d_position[i][j0];
+   p1 = d_position[i][j1];
+  }
+  QMATH_MEMORY_BARRIER();
+ }while( (s & 1) || (s != d_sequence[i]) );
+ sequence = s;
+ if(!found)
+  return false;
+
+ if(t1 > t0)
+ {
+  double f = (time - t0) / (t1 - t0);
+  q0 = slerp(q0, q1, f);
+  p0 += f * (p1 - p0);
+ }
+ Matrix<3, 3> r = q0.toRotationMatrix();
+ const double *e = r.Matrix<3, 3, double>::getElementsPointer();
+ double *f = pose.getElementsPointer();
+ for(int k = 0; k < 3; ++k)
+ {
+  f[k * 4] = e[k * 3];
+  f[k * 4 + 1] = e[k * 3 + 1];
+  f[k * 4 + 2] = e[k * 3 + 2];
+  f[k * 4 + 3] = p0.getElementsPointer()[k];
+ }
+ return true;
+}
+
+
+//========================================================================
+// FrameGraph::getTransform
+//========================================================================
+template<int n, int depth>
+bool FrameGraph<n, depth>::getTransform(int frame, double time, Transform &pose) const
+{
+ checkIndex(frame, 1);
+ RigidTransform<> t;
+ unsigned int sequence;
+ if(!edge(frame - 1, time, t, sequence))
+  return false;
+ pose = t.toTransform();
+ return true;
+}
+
+template<int n, int depth>
+bool FrameGraph<n, depth>::getTransform(int a, int b, double time, Transform &pose) const
+{
+ return path(a, b, time, pose);
+}
+
+template<int n, int depth>
+bool FrameGraph<n, depth>::getTransform(int a, int b, Transform &pose) const
+{
+ return path(a, b, HUGE_VAL, pose);
+}
+
+
+//========================================================================
+// FrameGraph::path
+//   Composes the edges from a and from b up to their nearest common
+//   ancestor c, then aTb = inverse(cTa) cTb.
+//========================================================================
+template<int n, int depth>
+bool FrameGraph<n, depth>::path(int a, int b, double time, Transform &pose) const
+{
+ checkIndex(a, 1);
+ checkIndex(b, 1);
+ int up[2][n], length[2] = {0, 0};
+ int i, j;
+ for(i = a; i != 0; i = d_parent[i - 1])
+  up[0][length[0]++] = i;
+ for(i = b; i != 0; i = d_parent[i - 1])
+  up[1][length[1]++] = i;
+ if(up[0][length[0] - 1] != up[1][length[1] - 1])
+  return false;                               // different trees
+ while( (length[0] > 0) && (length[1] > 0) &&
+        (up[0][length[0] - 1] == up[1][length[1] - 1]) )
+ {
+  --length[0];
+  --length[1];
+ }
+
+ RigidTransform<> t[2], e;
+ unsigned int sequence;
+ for(j = 0; j < 2; ++j)
+  for(i = length[j] - 1; i >= 0; --i)
+  {
+   if(!edge(up[j][i] - 1, time, e, sequence))
+    return false;
+   t[j] = t[j] * e;
+  }
+ pose = (inverse(t[0]) * t[1]).toTransform();
+ return true;
+}
+
+
+//========================================================================
+// FrameLookup::FrameLookup
+//========================================================================
+template<int n, int depth>
+FrameLookup<n, depth>::FrameLookup(const FrameGraph<n, depth> &graph)
+ : d_graph(graph)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  d_valid[i] = false;
+  d_version[i] = 0;
+ }
+}
+
+
+//========================================================================
+// FrameLookup::update
+//   Makes the pose of frame i (0-based) relative to its root valid for
+//   the given time, first for its ancestors. The pose of a root is the
+//   identity and does not depend on its edge.
+//========================================================================
+template<int n, int depth>
+bool FrameLookup<n, depth>::update(int i, double time)
+{
+ int parent = d_graph.d_parent[i] - 1;
+ if(parent < 0)
+ {
+  if( !d_valid[i] || (d_root[i] != i) )
+  {
+   d_pose[i] = RigidTransform<>();
+   d_root[i] = i;
+   d_valid[i] = true;
+   ++d_version[i];
+  }
+  return true;
+ }
+ if(!update(parent, time))
+  return false;
+ unsigned int sequence = d_graph.d_sequence[i];
+ if( d_valid[i] && (d_time[i] == time) && (d_sequence[i] == sequence) &&
+     (d_parentVersion[i] == d_version[parent]) )
+  return true;
+
+ RigidTransform<> e;
+ d_valid[i] = false;
+ if(!d_graph.edge(i, time, e, sequence))
+  return false;
+ d_pose[i] = d_pose[parent] * e;
+ d_root[i] = d_root[parent];
+ d_parentVersion[i] = d_version[parent];
+ d_time[i] = time;
+ d_sequence[i] = sequence;
+ d_valid[i] = true;
+ ++d_version[i];
+ return true;
+}
+
+
+//========================================================================
+// FrameLookup::getTransform
+//========================================================================
+template<int n, int depth>
+bool FrameLookup<n, depth>::getTransform(int a, int b, double time, Transform &pose)
+{
+ return lookup(a, b, time, pose);
+}
+
+template<int n, int depth>
+bool FrameLookup<n, depth>::getTransform(int a, int b, Transform &pose)
+{
+ return lookup(a, b, HUGE_VAL, pose);
+}
+
+template<int n, int depth>
+bool FrameLookup<n, depth>::lookup(int a, int b, double time, Transform &pose)
+{
+ d_graph.checkIndex(a, 1);
+ d_graph.checkIndex(b, 1);
+ if( !update(a - 1, time) || !update(b - 1, time) || (d_root[a - 1] != d_root[b - 1]) )
+  return false;
+ pose = (inverse(d_pose[a - 1]) * d_pose[b - 1]).toTransform();
+ return true;
+}
+
+#endif
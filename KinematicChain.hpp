@@ -0,0 +1,517 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : KinematicChain.hpp
+// Description          : Forward kinematics of serial manipulators
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_KinematicChain_hpp
+#define INCLUDED_KinematicChain_hpp
+
+#include <math.h>
+#include "RigidTransform.hpp"
+#include "MathException.hpp"
+
+//========================================================================
+/*! \enum _QMathDHConvention
+    \brief Denavit-Hartenberg conventions */
+//========================================================================
+typedef enum _QMathDHConvention
+{
+ QMathDH_standard    = 0x00,  //!< A = Rz(theta) Tz(d) Tx(a) Rx(alpha) (Spong and Vidyasagar).
+ QMathDH_modified    = 0x01   /*!< A = Rx(alpha) Tx(a) Rz(theta) Tz(d), with a and alpha
+                                   of the previous axis (Craig). */
+}QMathDHConvention_t;
+
+//========================================================================
+/*! \enum _QMathJoint
+    \brief Joint types */
+//========================================================================
+typedef enum _QMathJoint
+{
+ QMathJoint_revolute  = 0x00,  //!< The joint position is added to theta.
+ QMathJoint_prismatic = 0x01   //!< The joint position is added to d.
+}QMathJoint_t;
+
+
+//====================================================================
+// class KinematicChain
+// -------------------------------------------------------------------
+// \brief
+// Forward kinematics of a serial chain of n links described by
+// Denavit-Hartenberg parameters.
+//
+// Link i (1 to n) has the parameters a, alpha, d and theta and joint i
+// moves it: a revolute joint adds its position to theta, a prismatic
+// joint adds it to d. The link transform A_i, the transforms 0T_i =
+// A_1...A_i of every frame relative to the base, and the transforms
+// iT_n = A_{i+1}...A_n of the last frame relative to every frame are
+// kept in the object. Changing the position of joint k recomputes A_k
+// at once; the products that contain A_k (0T_i for i >= k and iT_n for
+// i < k) are recomputed the next time they are asked for, starting from
+// the nearest product that is still valid. A control loop that moves
+// only the wrist joints therefore pays only for the wrist links.
+//
+// The products are computed as \c RigidTransform (the bottom row of a
+// link transform is always [0 0 0 1]) and returned as \c Transform.
+// getTransforms() evaluates many joint configurations, sharing them
+// among processor cores when compiled with OpenMP. getJacobian() builds
+// the geometric Jacobian and its time derivative from the cached frames
+// in a pass over the joints, writing into the caller's matrices.
+//
+// <b>Example Program:</b>
+// \include KinematicChain.t.cpp
+//========================================================================
+
+template<int n>
+class KinematicChain
+{
+ public:
+  inline KinematicChain(QMathDHConvention_t convention = QMathDH_standard);
+   // The default constructor. All link parameters and joint positions
+   // are zero and all joints are revolute.
+   //  convention  The convention of the link parameters.
+
+  ~KinematicChain() {}
+   // The default destructor.
+
+  inline void setLink(int i, double a, double alpha, double d, double theta,
+                      QMathJoint_t type = QMathJoint_revolute);
+   // Sets the parameters of link i (1 to n). For QMathDH_modified, a and
+   // alpha are those of axis i - 1, i.e. the link transform is
+   // Rx(alpha) Tx(a) Rz(theta) Tz(d). theta (or d, for a prismatic joint)
+   // is the offset to which the joint position is added. Throws an
+   // illegalIndex exception if i is out of range.
+
+  inline QMathDHConvention_t getConvention() const { return d_convention; }
+   //  return  The convention of the link parameters.
+
+  inline void setJointPosition(int i, double q);
+   // Sets the position of joint i (1 to n), in radians for a revolute
+   // and in length units for a prismatic joint. Throws an illegalIndex
+   // exception if i is out of range.
+
+  inline void setJointPositions(const ColumnVector<n, double> &q);
+   // Sets the positions of all joints. Only the joints whose position
+   // differs from the current one count as changed.
+
+  inline double getJointPosition(int i) const;
+  inline ColumnVector<n, double> getJointPositions() const;
+   //  return  The position of joint i, or of all joints.
+
+  inline Transform getLinkTransform(int i) const;
+   //  return  The transform A_i of link i, i.e. of frame i relative to
+   //          frame i - 1.
+
+  inline Transform getTransform() const;
+   //  return  The transform 0T_n of the last frame relative to the base.
+
+  inline Transform getTransform(int i) const;
+   //  return  The transform 0T_i of frame i (0 to n) relative to the
+   //          base. 0T_0 is the identity.
+
+  inline Transform getTransformToEnd(int i) const;
+   //  return  The transform iT_n of the last frame relative to frame i
+   //          (0 to n). nT_n is the identity.
+
+  void getTransforms(const ColumnVector<n, double> *q, Transform *t, int count) const;
+   // Computes t[k] = 0T_n for the joint positions q[k], k = 0 to
+   // count - 1, with the link parameters of this chain. Does not change
+   // the joint positions or the cached products of this object.
+
+  void getJacobian(Matrix<6, n, double> &jacobian) const;
+   // Computes the geometric Jacobian at the current joint positions,
+   // expressed in the base frame: column i maps the velocity of joint i
+   // to the linear velocity of the origin of the last frame (rows 1 to
+   // 3) and the angular velocity of the last frame (rows 4 to 6). The
+   // elements are written directly into \a jacobian.
+
+  void getJacobian(const ColumnVector<n, double> &velocity, Matrix<6, n, double> &jacobian,
+                   Matrix<6, n, double> &derivative) const;
+   // Computes the Jacobian as above and, for the given joint velocities,
+   // its time derivative in the same pass over the links.
+
+ private:
+  inline void checkIndex(int i, int first) const;
+  void jacobian(const double *velocity, double *j, double *dj) const;
+  inline void linkTransform(int i, double q, RigidTransform<> &t) const;
+  inline void changed(int i);
+  inline void updatePrefix(int i) const;
+  inline void updateSuffix(int i) const;
+
+  QMathDHConvention_t d_convention;
+  double d_a[n], d_alpha[n], d_d[n], d_theta[n];  // link parameters
+  QMathJoint_t d_type[n];
+  double d_q[n];                                  // joint positions
+  RigidTransform<> d_link[n];                     // A_1 ... A_n
+  mutable RigidTransform<> d_prefix[n + 1];       // 0T_0 ... 0T_n
+  mutable RigidTransform<> d_suffix[n + 1];       // 0T_n ... nT_n
+  mutable int d_prefixValid;                      // 0T_i valid for i <= d_prefixValid
+  mutable int d_suffixValid;                      // iT_n valid for i >= d_suffixValid
+};
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// KinematicChain::KinematicChain
+//========================================================================
+template<int n>
+KinematicChain<n>::KinematicChain(QMathDHConvention_t convention)
+ : d_convention(convention)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  d_a[i] = 0;
+  d_alpha[i] = 0;
+  d_d[i] = 0;
+  d_theta[i] = 0;
+  d_type[i] = QMathJoint_revolute;
+  d_q[i] = 0;
+ }
+ d_prefixValid = 0;
+ d_suffixValid = n;
+}
+
+
+//========================================================================
+// KinematicChain::checkIndex
+//========================================================================
+template<int n>
+void KinematicChain<n>::checkIndex(int i, int first) const
+{
+ if( (i < first) || (i > n) )
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+}
+
+
+//========================================================================
+// KinematicChain::linkTransform
+//   The products of the elementary transforms, expanded.
+//========================================================================
+template<int n>
+void KinematicChain<n>::linkTransform(int i, double q, RigidTransform<> &t) const
+{
+ double theta = d_theta[i], d = d_d[i];
+ if(d_type[i] == QMathJoint_revolute)
+  theta += q;
+ else
+  d += q;
+ double ct = cos(theta), st = sin(theta);
+ double ca = cos(d_alpha[i]), sa = sin(d_alpha[i]);
+ double a = d_a[i];
+ double *e = t.getElementsPointer();
+ if(d_convention == QMathDH_standard)
+ {
+  e[0] = ct; e[1] = -st * ca; e[2] = st * sa;  e[3] = a * ct;
+  e[4] = st; e[5] = ct * ca;  e[6] = -ct * sa; e[7] = a * st;
+  e[8] = 0;  e[9] = sa;       e[10] = ca;      e[11] = d;
+ }
+ else
+ {
+  e[0] = ct;      e[1] = -st;     e[2] = 0;    e[3] = a;
+  e[4] = st * ca; e[5] = ct * ca; e[6] = -sa;  e[7] = -sa * d;
+  e[8] = st * sa; e[9] = ct * sa; e[10] = ca;  e[11] = ca * d;
+ }
+}
+
+
+//========================================================================
+// KinematicChain::changed
+//   Recomputes A_i (0-based) and invalidates the products containing it.
+//========================================================================
+template<int n>
+void KinematicChain<n>::changed(int i)
+{
+ linkTransform(i, d_q[i], d_link[i]);
+ if(d_prefixValid > i)
+  d_prefixValid = i;
+ if(d_suffixValid < i + 1)
+  d_suffixValid = i + 1;
+}
+
+
+//========================================================================
+// KinematicChain::setLink
+//========================================================================
+template<int n>
+void KinematicChain<n>::setLink(int i, double a, double alpha, double d, double theta,
+                                QMathJoint_t type)
+{
+ checkIndex(i, 1);
+ d_a[i - 1] = a;
+ d_alpha[i - 1] = alpha;
+ d_d[i - 1] = d;
+ d_theta[i - 1] = theta;
+ d_type[i - 1] = type;
+ changed(i - 1);
+}
+
+
+//========================================================================
+// KinematicChain::setJointPosition, KinematicChain::setJointPositions
+//========================================================================
+template<int n>
+void KinematicChain<n>::setJointPosition(int i, double q)
+{
+ checkIndex(i, 1);
+ if(d_q[i - 1] != q)
+ {
+  d_q[i - 1] = q;
+  changed(i - 1);
+ }
+}
+
+template<int n>
+void KinematicChain<n>::setJointPositions(const ColumnVector<n, double> &q)
+{
+ const double *e = q.Matrix<n, 1, double>::getElementsPointer(); // static call
+ for(int i = 0; i < n; ++i)
+  if(d_q[i] != e[i])
+  {
+   d_q[i] = e[i];
+   changed(i);
+  }
+}
+
+
+//========================================================================
+// KinematicChain::getJointPosition, KinematicChain::getJointPositions
+//========================================================================
+template<int n>
+double KinematicChain<n>::getJointPosition(int i) const
+{
+ checkIndex(i, 1);
+ return d_q[i - 1];
+}
+
+template<int n>
+ColumnVector<n, double> KinematicChain<n>::getJointPositions() const
+{
+ ColumnVector<n, double> q;
+ double *e = q.Matrix<n, 1, double>::getElementsPointer();
+ for(int i = 0; i < n; ++i)
+  e[i] = d_q[i];
+ return q;
+}
+
+
+//========================================================================
+// KinematicChain::updatePrefix, KinematicChain::updateSuffix
+//========================================================================
+template<int n>
+void KinematicChain<n>::updatePrefix(int i) const
+{
+ for(; d_prefixValid < i; ++d_prefixValid)
+  d_prefix[d_prefixValid + 1] = d_prefix[d_prefixValid] * d_link[d_prefixValid];
+}
+
+template<int n>
+void KinematicChain<n>::updateSuffix(int i) const
+{
+ for(; d_suffixValid > i; --d_suffixValid)
+  d_suffix[d_suffixValid - 1] = d_link[d_suffixValid - 1] * d_suffix[d_suffixValid];
+}
+
+
+//========================================================================
+// KinematicChain::getLinkTransform, KinematicChain::getTransform,
+// KinematicChain::getTransformToEnd
+//========================================================================
+template<int n>
+Transform KinematicChain<n>::getLinkTransform(int i) const
+{
+ checkIndex(i, 1);
+ return d_link[i - 1].toTransform();
+}
+
+template<int n>
+Transform KinematicChain<n>::getTransform() const
+{
+ updatePrefix(n);
+ return d_prefix[n].toTransform();
+}
+
+template<int n>
+Transform KinematicChain<n>::getTransform(int i) const
+{
+ checkIndex(i, 0);
+ updatePrefix(i);
+ return d_prefix[i].toTransform();
+}
+
+template<int n>
+Transform KinematicChain<n>::getTransformToEnd(int i) const
+{
+ checkIndex(i, 0);
+ updateSuffix(i);
+ return d_suffix[i].toTransform();
+}
+
+
+//========================================================================
+// KinematicChain::getTransforms
+//========================================================================
+template<int n>
+void KinematicChain<n>::getTransforms(const ColumnVector<n, double> *q, Transform *t,
+                                      int count) const
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < count; ++k)
+ {
+  const double *e = q[k].Matrix<n, 1, double>::getElementsPointer();
+  RigidTransform<> p, a;
+  linkTransform(0, e[0], p);
+  for(int i = 1; i < n; ++i)
+  {
+   linkTransform(i, e[i], a);
+   p = p * a;
+  }
+  t[k] = p.toTransform();
+ }
+}
+
+
+//========================================================================
+// KinematicChain::getJacobian
+//========================================================================
+template<int n>
+void KinematicChain<n>::getJacobian(Matrix<6, n, double> &jacobian) const
+{
+ this->jacobian(0, jacobian.Matrix<6, n, double>::getElementsPointer(), 0);
+}
+
+template<int n>
+void KinematicChain<n>::getJacobian(const ColumnVector<n, double> &velocity,
+                                    Matrix<6, n, double> &jacobian,
+                                    Matrix<6, n, double> &derivative) const
+{
+ this->jacobian(velocity.Matrix<n, 1, double>::getElementsPointer(),
+                jacobian.Matrix<6, n, double>::getElementsPointer(),
+                derivative.Matrix<6, n, double>::getElementsPointer());
+}
+
+
+//========================================================================
+// KinematicChain::jacobian
+//   Joint i moves about (or along) the axis z through the point p: the z
+//   axis and origin of frame i - 1 (standard) or frame i (modified).
+//   Column i is [z x (o - p); z] for a revolute and [z; 0] for a
+//   prismatic joint, o being the origin of the last frame.
+//
+//   The derivative needs the velocities of z, p and o. Joints 1 to i - 1
+//   move the axis of joint i as a rigid body, so that the velocity of a
+//   point x attached to it is w x x - c + u, with the sums over those
+//   joints
+//     w = sum z_j qd_j,  c = sum (z_j x p_j) qd_j  (revolute),
+//     u = sum z_j qd_j                              (prismatic).
+//   Then dz = w x z and dp = w x p - c + u, and the derivative of column
+//   i is [dz x (o - p) + z x (do - dp); dz] (revolute) or [dz; 0]. The
+//   sums are accumulated in the pass over the joints. do is only known
+//   at the end, so the term z x do is added in a second pass.
+//========================================================================
+template<int n>
+void KinematicChain<n>::jacobian(const double *velocity, double *j, double *dj) const
+{
+ updatePrefix(n);
+ const double *e = d_prefix[n].getElementsPointer();
+ const double o[3] = {e[3], e[7], e[11]};
+ double w[3] = {0, 0, 0}, c[3] = {0, 0, 0}, u[3] = {0, 0, 0};
+ int i, r;
+
+ for(i = 0; i < n; ++i)
+ {
+  const double *f = d_prefix[(d_convention == QMathDH_standard) ? i : i + 1].getElementsPointer();
+  const double z[3] = {f[2], f[6], f[10]};
+  const double p[3] = {f[3], f[7], f[11]};
+  const double op[3] = {o[0] - p[0], o[1] - p[1], o[2] - p[2]};
+  bool revolute = (d_type[i] == QMathJoint_revolute);
+
+  if(revolute)
+  {
+   j[i] = z[1] * op[2] - z[2] * op[1];
+   j[n + i] = z[2] * op[0] - z[0] * op[2];
+   j[2 * n + i] = z[0] * op[1] - z[1] * op[0];
+   for(r = 0; r < 3; ++r)
+    j[(3 + r) * n + i] = z[r];
+  }
+  else
+   for(r = 0; r < 3; ++r)
+   {
+    j[r * n + i] = z[r];
+    j[(3 + r) * n + i] = 0;
+   }
+
+  if(!dj)
+   continue;
+
+  const double dz[3] = {w[1] * z[2] - w[2] * z[1], w[2] * z[0] - w[0] * z[2],
+                        w[0] * z[1] - w[1] * z[0]};
+  if(revolute)
+  {
+   const double dp[3] = {w[1] * p[2] - w[2] * p[1] - c[0] + u[0],
+                         w[2] * p[0] - w[0] * p[2] - c[1] + u[1],
+                         w[0] * p[1] - w[1] * p[0] - c[2] + u[2]};
+   // dz x (o - p) - z x dp; z x do follows below
+   dj[i] = dz[1] * op[2] - dz[2] * op[1] - (z[1] * dp[2] - z[2] * dp[1]);
+   dj[n + i] = dz[2] * op[0] - dz[0] * op[2] - (z[2] * dp[0] - z[0] * dp[2]);
+   dj[2 * n + i] = dz[0] * op[1] - dz[1] * op[0] - (z[0] * dp[1] - z[1] * dp[0]);
+   for(r = 0; r < 3; ++r)
+    dj[(3 + r) * n + i] = dz[r];
+
+   double qd = velocity[i];
+   w[0] += z[0] * qd;
+   w[1] += z[1] * qd;
+   w[2] += z[2] * qd;
+   c[0] += (z[1] * p[2] - z[2] * p[1]) * qd;
+   c[1] += (z[2] * p[0] - z[0] * p[2]) * qd;
+   c[2] += (z[0] * p[1] - z[1] * p[0]) * qd;
+  }
+  else
+   for(r = 0; r < 3; ++r)
+   {
+    dj[r * n + i] = dz[r];
+    dj[(3 + r) * n + i] = 0;
+    u[r] += z[r] * velocity[i];
+   }
+ }
+
+ if(!dj)
+  return;
+ const double vo[3] = {w[1] * o[2] - w[2] * o[1] - c[0] + u[0],
+                       w[2] * o[0] - w[0] * o[2] - c[1] + u[1],
+                       w[0] * o[1] - w[1] * o[0] - c[2] + u[2]};
+ for(i = 0; i < n; ++i)
+  if(d_type[i] == QMathJoint_revolute)
+  {
+   const double *z = j + 3 * n + i;   // rows 4 to 6 of column i, n apart
+   dj[i] += z[n] * vo[2] - z[2 * n] * vo[1];
+   dj[n + i] += z[2 * n] * vo[0] - z[0] * vo[2];
+   dj[2 * n + i] += z[0] * vo[1] - z[n] * vo[0];
+  }
+}
+
+
+#endif
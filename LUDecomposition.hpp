@@ -0,0 +1,282 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LUDecomposition.hpp
+// Description          : Template class for LU decomposition of square
+//                        matrices
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_LUDecomposition_hpp
+#define INCLUDED_LUDecomposition_hpp
+
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+
+//========================================================================
+// class LUDecomposition
+// -----------------------------------------------------------------------
+// \brief
+// LU decomposition with partial pivoting of a square matrix.
+//
+// The factors are kept by the object, so that a matrix factorized once
+// can be used to solve any number of linear systems afterwards at the
+// cost of a forward and back substitution each.
+//
+// <b>Example Program:</b>
+// \include LUDecomposition.t.cpp
+//========================================================================
+
+template<int size, class T = double>
+class LUDecomposition
+{
+ public:
+  inline LUDecomposition();
+   // The default constructor. The object holds no factorization
+   // until factorize() is called.
+
+  inline LUDecomposition(const Matrix<size, size, T> &A);
+   // This constructor factorizes \a A. See factorize().
+
+  ~LUDecomposition() {}
+   // The default destructor.
+
+  void factorize(const Matrix<size, size, T> &A);
+   // Computes and stores the factors P * A = L * U. Throws
+   // QMathException_singular if \a A is singular.
+
+  template<int nrhs>
+  Matrix<size, nrhs, T> solve(const Matrix<size, nrhs, T> &B) const;
+   //  return  The solution X of A * X = B using the stored factors.
+
+  inline ColumnVector<size, T> solve(const ColumnVector<size, T> &b) const;
+   //  return  The solution x of A * x = b using the stored factors.
+
+  void solve(const ColumnVector<size, T> *b, ColumnVector<size, T> *x, int count) const;
+   // Solves A * x[i] = b[i] for an array of right hand sides.
+   //  b      Array of \a count right hand sides.
+   //  x      Array of \a count solutions. May be the same array as \a b.
+   //  count  Number of systems.
+
+  T determinant() const;
+   //  return  The determinant of the factorized matrix.
+
+  Matrix<size, size, T> inverse() const;
+   //  return  The inverse of the factorized matrix.
+
+  // ========== END OF INTERFACE ==========
+
+ protected:
+  T d_lu[size * size];
+  int d_pivot[size];
+  bool d_valid;
+
+  inline void checkValid() const;
+};
+
+
+template<int size, class T>
+void shermanMorrisonUpdate(Matrix<size, size, T> &Ainv, const ColumnVector<size, T> &u,
+                           const ColumnVector<size, T> &v);
+ // Rank-1 update of an explicitly stored inverse using the
+ // Sherman-Morrison formula. Given Ainv = inverse(A), \a Ainv is
+ // replaced with inverse(A + u * transpose(v)) in O(size^2) operations.
+ // Throws QMathException_singular if the updated matrix is singular.
+ // Example (BFGS update of an inverse Hessian approximation):
+ // \code
+ // Matrix<4,4> H;
+ // ColumnVector<4> u, v;
+ // shermanMorrisonUpdate(H, u, v);
+ // \endcode
+
+
+//========================================================================
+// End of declarations.
+//========================================================================
+
+
+//========================================================================
+// LUDecomposition::LUDecomposition
+//========================================================================
+template<int size, class T>
+LUDecomposition<size, T>::LUDecomposition()
+{
+ d_valid = false;
+}
+
+
+template<int size, class T>
+LUDecomposition<size, T>::LUDecomposition(const Matrix<size, size, T> &A)
+{
+ d_valid = false;
+ factorize(A);
+}
+
+
+//========================================================================
+// LUDecomposition::checkValid
+//========================================================================
+template<int size, class T>
+void LUDecomposition<size, T>::checkValid() const
+{
+ if(!d_valid)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_singular);
+  throw exception;
+ }
+}
+
+
+//========================================================================
+// LUDecomposition::factorize
+//========================================================================
+template<int size, class T>
+void LUDecomposition<size, T>::factorize(const Matrix<size, size, T> &A)
+{
+ const T *a = A.getElementsPointer();
+ for(int i = 0; i < size * size; ++i)
+  d_lu[i] = a[i];
+ d_valid = luDecompose<size, T>(d_lu, d_pivot);
+ checkValid();
+}
+
+
+//========================================================================
+// LUDecomposition::solve
+//========================================================================
+template<int size, class T>
+template<int nrhs>
+Matrix<size, nrhs, T> LUDecomposition<size, T>::solve(const Matrix<size, nrhs, T> &B) const
+{
+ checkValid();
+ Matrix<size, nrhs, T> X(B);
+ luSubstitute<size, T>(d_lu, d_pivot, X.getElementsPointer(), nrhs);
+ return X;
+}
+
+
+template<int size, class T>
+ColumnVector<size, T> LUDecomposition<size, T>::solve(const ColumnVector<size, T> &b) const
+{
+ checkValid();
+ ColumnVector<size, T> x(b);
+ luSubstitute<size, T>(d_lu, d_pivot, x.getElementsPointer(), 1);
+ return x;
+}
+
+
+template<int size, class T>
+void LUDecomposition<size, T>::solve(const ColumnVector<size, T> *b, ColumnVector<size, T> *x,
+                                     int count) const
+{
+ checkValid();
+ for(int i = 0; i < count; ++i)
+ {
+  if(x != b)
+   x[i] = b[i];
+  luSubstitute<size, T>(d_lu, d_pivot, x[i].getElementsPointer(), 1);
+ }
+}
+
+
+//========================================================================
+// LUDecomposition::determinant
+//========================================================================
+template<int size, class T>
+T LUDecomposition<size, T>::determinant() const
+{
+ checkValid();
+ T det = 1;
+ for(int i = 0; i < size; ++i)
+ {
+  det *= d_lu[i * size + i];
+  if(d_pivot[i] != i)
+   det = -det;
+ }
+ return det;
+}
+
+
+//========================================================================
+// LUDecomposition::inverse
+//========================================================================
+template<int size, class T>
+Matrix<size, size, T> LUDecomposition<size, T>::inverse() const
+{
+ checkValid();
+ Matrix<size, size, T> inv;
+ T *x = inv.getElementsPointer();
+ for(int i = 0; i < size * size; ++i)
+  x[i] = 0;
+ for(int i = 0; i < size; ++i)
+  x[i * size + i] = 1;
+ luSubstitute<size, T>(d_lu, d_pivot, x, size);
+ return inv;
+}
+
+
+//========================================================================
+// shermanMorrisonUpdate
+//========================================================================
+template<int size, class T>
+void shermanMorrisonUpdate(Matrix<size, size, T> &Ainv, const ColumnVector<size, T> &u,
+                           const ColumnVector<size, T> &v)
+{
+ T *m = Ainv.getElementsPointer();
+ const T *pu = u.getElementsPointer();
+ const T *pv = v.getElementsPointer();
+ T w[size]; // Ainv * u
+ T z[size]; // transpose(v) * Ainv
+ int r, c;
+
+ for(r = 0; r < size; ++r)
+ {
+  w[r] = 0;
+  z[r] = 0;
+ }
+ for(r = 0; r < size; ++r)
+ {
+  for(c = 0; c < size; ++c)
+  {
+   w[r] += m[r * size + c] * pu[c];
+   z[c] += pv[r] * m[r * size + c];
+  }
+ }
+
+ T denominator = 1;
+ for(r = 0; r < size; ++r)
+  denominator += pv[r] * w[r];
+ if(fabs(denominator) < NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_singular);
+  throw exception;
+ }
+
+ T s = 1 / denominator;
+ for(r = 0; r < size; ++r)
+ {
+  T wr = w[r] * s;
+  for(c = 0; c < size; ++c)
+   m[r * size + c] -= wr * z[c];
+ }
+}
+
+
+#endif
@@ -0,0 +1,275 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LaserScan.hpp
+// Description          : Projection of laser scans to Cartesian points
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_LaserScan_hpp
+#define INCLUDED_LaserScan_hpp
+
+#include "Simd.hpp"
+#include "FastMath.hpp"
+#include "RigidTransform.hpp"
+#include "SE2.hpp"
+
+//====================================================================
+// class LaserScan
+// -------------------------------------------------------------------
+// \brief
+// The geometry of a planar laser scan of n beams, which converts the
+// measured ranges to Cartesian points in the frame of the sensor or in
+// any other frame.
+//
+// Beam i (0 to n - 1) points at the angle angleMin + i angleIncrement
+// from the x axis of the sensor, in its xy plane, so that a range r
+// measures the point (r cos, r sin, 0). The cosines and sines of the n
+// angles are computed once, when the geometry is set, and kept in two
+// tables. project() then multiplies the ranges by the tables and applies
+// the transform to the target frame in the same pass, four beams at a
+// time with SIMD instructions (see Simd.hpp): two multiplications and
+// two fused multiply-adds per coordinate, and no trigonometry.
+//
+// A range is valid if rangeMin <= r <= rangeMax. Other ranges, including
+// NaN and infinity, which drivers use to report missing returns, are
+// dropped: the points of the valid beams are written one after the
+// other into the output arrays (structure of arrays), optionally with
+// the number of the beam of each, and project() returns how many there
+// are. The output arrays must have room for n points and must not
+// overlap the ranges. The last incomplete group of four beams is
+// computed from a zero-padded copy, as in PointBatch.hpp, so that every
+// point is computed with the same rounding. No memory is allocated.
+//
+// <b>Example Program:</b>
+// \include LaserScan.t.cpp
+//========================================================================
+
+template<int n, class T = double>
+class LaserScan
+{
+ public:
+  inline LaserScan(const T &angleMin, const T &angleIncrement,
+                   const T &rangeMin, const T &rangeMax);
+   // Constructs the geometry of a scan.
+   //  angleMin        The angle of the first beam (radians).
+   //  angleIncrement  The angle between consecutive beams (radians).
+   //  rangeMin, rangeMax  The limits of the valid ranges.
+
+  ~LaserScan() {}
+   // The default destructor.
+
+  inline void setAngles(const T &angleMin, const T &angleIncrement);
+   // Sets the angles of the beams and recomputes the tables.
+
+  inline void setRangeLimits(const T &rangeMin, const T &rangeMax);
+   // Sets the limits of the valid ranges.
+
+  inline T getAngleMin() const { return d_angleMin; }
+  inline T getAngleIncrement() const { return d_angleIncrement; }
+  inline T getRangeMin() const { return d_rangeMin; }
+  inline T getRangeMax() const { return d_rangeMax; }
+   //  return  The geometry set by the constructor or the functions above.
+
+  inline const T *getCosines() const { return d_cos; }
+  inline const T *getSines() const { return d_sin; }
+   //  return  The tables of the cosines and the sines of the n beam
+   //          angles.
+
+  int project(const T *range, T *x, T *y, int *beam = 0) const;
+   // Projects the ranges of the n beams to points in the frame of the
+   // sensor.
+   //  range  The n measured ranges.
+   //  x, y   The coordinates of the valid points.
+   //  beam   If not null, the number of the beam of each point.
+   //  return The number of valid points.
+
+  int project(const T *range, const SE2<T> &frame, T *x, T *y, int *beam = 0) const;
+   // As above, with the points transformed by \a frame, the pose of
+   // the sensor in the target frame, such as the robot base.
+
+  int project(const T *range, const RigidTransform<T> &frame,
+              T *x, T *y, T *z, int *beam = 0) const;
+  int project(const T *range, const Transform &frame,
+              T *x, T *y, T *z, int *beam = 0) const;
+   // As above, in three dimensions. The elements of a \c Transform are
+   // converted to T.
+
+ private:
+  enum { N = (n + 3) / 4 * 4 };
+  int project(const T *m, const T *range, T *x, T *y, T *z, int *beam) const;
+
+  T d_angleMin;
+  T d_angleIncrement;
+  T d_rangeMin;
+  T d_rangeMax;
+  T d_cos[N];                        // tables, zero-padded to a multiple of four
+  T d_sin[N];
+};
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// LaserScan::LaserScan
+//========================================================================
+template<int n, class T>
+LaserScan<n, T>::LaserScan(const T &angleMin, const T &angleIncrement,
+                           const T &rangeMin, const T &rangeMax)
+{
+ for(int i = n; i < N; ++i)
+ {
+  d_cos[i] = 0;
+  d_sin[i] = 0;
+ }
+ setAngles(angleMin, angleIncrement);
+ setRangeLimits(rangeMin, rangeMax);
+}
+
+
+//========================================================================
+// LaserScan::setAngles, LaserScan::setRangeLimits
+//========================================================================
+template<int n, class T>
+void LaserScan<n, T>::setAngles(const T &angleMin, const T &angleIncrement)
+{
+ d_angleMin = angleMin;
+ d_angleIncrement = angleIncrement;
+ for(int i = 0; i < n; ++i)
+  sinCos(angleMin + i * angleIncrement, d_sin[i], d_cos[i]);
+}
+
+template<int n, class T>
+void LaserScan<n, T>::setRangeLimits(const T &rangeMin, const T &rangeMax)
+{
+ d_rangeMin = rangeMin;
+ d_rangeMax = rangeMax;
+}
+
+
+//========================================================================
+// LaserScan::project
+//========================================================================
+template<int n, class T>
+int LaserScan<n, T>::project(const T *range, T *x, T *y, int *beam) const
+{
+ const T m[12] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0};
+ return project(m, range, x, y, 0, beam);
+}
+
+template<int n, class T>
+int LaserScan<n, T>::project(const T *range, const SE2<T> &frame, T *x, T *y, int *beam) const
+{
+ const T *e = frame.getElementsPointer();
+ const T m[12] = {e[0], -e[1], 0, e[2], e[1], e[0], 0, e[3], 0, 0, 1, 0};
+ return project(m, range, x, y, 0, beam);
+}
+
+template<int n, class T>
+int LaserScan<n, T>::project(const T *range, const RigidTransform<T> &frame,
+                             T *x, T *y, T *z, int *beam) const
+{
+ return project(frame.getElementsPointer(), range, x, y, z, beam);
+}
+
+template<int n, class T>
+int LaserScan<n, T>::project(const T *range, const Transform &frame,
+                             T *x, T *y, T *z, int *beam) const
+{
+ const double *e = frame.Matrix<4, 4, double>::getElementsPointer(); // static call
+ T m[12];
+ for(int i = 0; i < 12; ++i)
+  m[i] = (T)e[i];
+ return project(m, range, x, y, z, beam);
+}
+
+
+//========================================================================
+// LaserScan::project (kernel)
+//   m holds the twelve elements of the transform row by row; only the
+//   first two columns and the translation are used, since the points of
+//   the scan have z = 0. The points of a group of four valid beams are
+//   stored directly into the output; a group with invalid beams goes
+//   through a local copy from which the valid points are picked. z is
+//   null for planar output.
+//========================================================================
+template<int n, class T>
+int LaserScan<n, T>::project(const T *m, const T *range, T *x, T *y, T *z, int *beam) const
+{
+ typedef Simd4<T> S;
+ S r11 = S::broadcast(m[0]), r12 = S::broadcast(m[1]), d1 = S::broadcast(m[3]);
+ S r21 = S::broadcast(m[4]), r22 = S::broadcast(m[5]), d2 = S::broadcast(m[7]);
+ S r31 = S::broadcast(m[8]), r32 = S::broadcast(m[9]), d3 = S::broadcast(m[11]);
+ const T lo = d_rangeMin, hi = d_rangeMax;
+ int count = 0;
+
+ for(int i = 0; i < n; i += 4)
+ {
+  T padded[4], t[3][4];
+  const T *r = range + i;
+  int j, k = (n - i < 4) ? (n - i) : 4, valid = 0;
+  if(k < 4)
+  {
+   for(j = 0; j < 4; ++j)
+    padded[j] = (j < k) ? r[j] : 0;
+   r = padded;
+  }
+  for(j = 0; j < k; ++j)
+   if(r[j] >= lo && r[j] <= hi)
+    valid |= 1 << j;
+  if(!valid)
+   continue;
+
+  S rr = S::load(r);
+  S u = rr * S::load(d_cos + i), v = rr * S::load(d_sin + i);
+  S px = S::multiplyAdd(r12, v, S::multiplyAdd(r11, u, d1));
+  S py = S::multiplyAdd(r22, v, S::multiplyAdd(r21, u, d2));
+  if(valid == 15)
+  {
+   px.store(x + count);
+   py.store(y + count);
+   if(z)
+    S::multiplyAdd(r32, v, S::multiplyAdd(r31, u, d3)).store(z + count);
+   if(beam)
+    for(j = 0; j < 4; ++j)
+     beam[count + j] = i + j;
+   count += 4;
+   continue;
+  }
+  px.store(t[0]);
+  py.store(t[1]);
+  if(z)
+   S::multiplyAdd(r32, v, S::multiplyAdd(r31, u, d3)).store(t[2]);
+  for(j = 0; j < k; ++j)
+  {
+   if(!(valid & (1 << j)))
+    continue;
+   x[count] = t[0][j];
+   y[count] = t[1][j];
+   if(z)
+    z[count] = t[2][j];
+   if(beam)
+    beam[count] = i + j;
+   ++count;
+  }
+ }
+ return count;
+}
+
+
+#endif
@@ -0,0 +1,438 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LieGroup.hpp
+// Description          : Exponential and logarithm maps of rotations and
+//                        rigid transforms
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_LieGroup_hpp
+#define INCLUDED_LieGroup_hpp
+
+#include <math.h>
+#include "Transform.hpp"
+
+//========================================================================
+// SO(3) and SE(3)
+// -----------------------------------------------------------------------
+// \brief
+// Closed-form exponential and logarithm maps of rotations (SO(3)) and
+// rigid transforms (SE(3)), the adjoint of a transform and the left
+// Jacobians of both groups, as used for pose-graph optimization and
+// for integrating twists.
+//
+// A rotation vector phi is the axis of rotation scaled by the angle
+// theta = |phi|. A twist xi = [rho; phi] holds the translational part
+// in elements 1 to 3 and the rotational part in elements 4 to 6, in
+// the order of the rows of KinematicChain::getJacobian(). With K the
+// cross product matrix of phi, expSO3() is the Rodrigues formula
+// \code
+// R = I + sin(theta)/theta K + (1 - cos(theta))/theta^2 K^2
+// \endcode
+// and expSE3() adds the translation J(phi) rho, where J is the left
+// Jacobian of SO(3). The logarithms invert them for theta in [0, pi].
+// As for vectorRotation(), the rotations are returned as \c Transform;
+// expSO3(theta * u) is vectorRotation(u, theta).
+//
+// Coefficients such as (1 - cos(theta))/theta^2 are evaluated from
+// their Taylor series for small angles, where the closed forms lose
+// accuracy or divide by zero, and logSO3() takes the axis from the
+// symmetric part of the rotation near theta = pi. The results are
+// fixed-size objects; no function allocates memory.
+//
+// The left Jacobian J relates a small change d of a vector to the
+// change of the group element, exp(xi + d) = exp(J(xi) d) exp(xi) to
+// first order in d; the right Jacobian is J(-xi). The adjoint maps
+// twists between frames, T expSE3(xi) inverse(T) = expSE3(adjointSE3(T) xi).
+// The formulas follow T. D. Barfoot, State Estimation for Robotics,
+// Cambridge University Press, 2017.
+//
+// <b>Example Program:</b>
+// \include LieGroup.t.cpp
+//========================================================================
+
+inline Transform expSO3(const ColumnVector<3, double> &phi);
+ //  return  The rotation by the angle |phi| about the axis phi.
+
+inline ColumnVector<3, double> logSO3(const Transform &t);
+ //  return  The rotation vector phi, with |phi| in [0, pi], of the
+ //          rotation part of t. For a rotation by pi either of phi and
+ //          -phi may be returned.
+
+inline Transform expSE3(const ColumnVector<6, double> &xi);
+ //  return  The transform of the twist xi = [rho; phi]: the rotation
+ //          expSO3(phi) and the translation leftJacobianSO3(phi) rho.
+
+inline ColumnVector<6, double> logSE3(const Transform &t);
+ //  return  The twist xi such that expSE3(xi) is t, with the
+ //          rotational part given by logSO3(t).
+
+inline Matrix<6, 6, double> adjointSE3(const Transform &t);
+ //  return  The adjoint [R P R; 0 R] of t = [R p], P the cross product
+ //          matrix of p. It maps a twist in the frame of t to the frame
+ //          in which t is expressed.
+
+inline Matrix<3, 3, double> leftJacobianSO3(const ColumnVector<3, double> &phi);
+ //  return  The left Jacobian of SO(3) at phi,
+ //          I + (1 - cos(theta))/theta^2 K + (theta - sin(theta))/theta^3 K^2.
+
+inline Matrix<3, 3, double> inverseLeftJacobianSO3(const ColumnVector<3, double> &phi);
+ //  return  The inverse of the left Jacobian of SO(3) at phi,
+ //          I - K/2 + (1/theta^2 - cot(theta/2)/(2 theta)) K^2, for
+ //          |phi| < 2 pi.
+
+inline Matrix<6, 6, double> leftJacobianSE3(const ColumnVector<6, double> &xi);
+ //  return  The left Jacobian [J Q; 0 J] of SE(3) at xi = [rho; phi],
+ //          where J is the left Jacobian of SO(3) at phi and Q couples
+ //          rho and phi.
+
+inline Matrix<6, 6, double> inverseLeftJacobianSE3(const ColumnVector<6, double> &xi);
+ //  return  The inverse [J^-1 -J^-1 Q J^-1; 0 J^-1] of the left
+ //          Jacobian of SE(3) at xi, for |phi| < 2 pi.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// LieGroupElements
+//   Internal. The rotation blocks, coefficients and the coupling block
+//   from which the maps below assemble their results.
+//========================================================================
+class LieGroupElements
+{
+ public:
+  static inline void rotation(const double *phi, double a, double b, double *m, int stride);
+   // Writes I + a K + b K^2, K the cross product matrix of phi, into
+   // the 3x3 block at m with rows stride elements apart.
+
+  static inline void coefficients(double t2, double &a, double &b, double &c);
+   // sin(theta)/theta, (1 - cos(theta))/theta^2 and
+   // (theta - sin(theta))/theta^3 for theta^2 = t2.
+
+  static inline double inverseCoefficient(double t2);
+   // 1/theta^2 - cot(theta/2)/(2 theta) for theta^2 = t2.
+
+  static inline void coupling(const double *xi, double *m, int stride);
+   // The block Q of the left Jacobian of SE(3) at xi, written into the
+   // 3x3 block at m with rows stride elements apart.
+};
+
+
+//========================================================================
+// LieGroupElements::rotation
+//========================================================================
+void LieGroupElements::rotation(const double *phi, double a, double b, double *m, int stride)
+{
+ double x = phi[0], y = phi[1], z = phi[2];
+ double *r1 = m, *r2 = m + stride, *r3 = m + 2 * stride;
+ r1[0] = 1 - b * (y * y + z * z); r1[1] = b * x * y - a * z;         r1[2] = b * x * z + a * y;
+ r2[0] = b * x * y + a * z;         r2[1] = 1 - b * (x * x + z * z); r2[2] = b * y * z - a * x;
+ r3[0] = b * x * z - a * y;         r3[1] = b * y * z + a * x;         r3[2] = 1 - b * (x * x + y * y);
+}
+
+
+//========================================================================
+// LieGroupElements::coefficients
+//   The terms left out of the series are below 1e-22. The second
+//   coefficient is computed from sin(theta/2) to avoid cancellation; the
+//   other two lose at most eps/theta^2, which their terms multiply by
+//   theta^2.
+//========================================================================
+void LieGroupElements::coefficients(double t2, double &a, double &b, double &c)
+{
+ if(t2 < 1e-6)
+ {
+  a = 1 - t2 / 6 * (1 - t2 / 20);
+  b = 0.5 - t2 / 24 * (1 - t2 / 30);
+  c = 1.0 / 6 - t2 / 120 * (1 - t2 / 42);
+  return;
+ }
+ double theta = sqrt(t2), s, co;
+ sinCos(0.5 * theta, s, co);
+ a = 2 * s * co / theta;
+ b = 2 * s * s / t2;
+ c = (theta - 2 * s * co) / (t2 * theta);
+}
+
+
+//========================================================================
+// LieGroupElements::inverseCoefficient
+//========================================================================
+double LieGroupElements::inverseCoefficient(double t2)
+{
+ if(t2 < 1e-6)
+  return 1.0 / 12 + t2 / 720 * (1 + t2 / 42);
+ double theta = sqrt(t2), s, co;
+ sinCos(0.5 * theta, s, co);
+ return 1 / t2 - co / (2 * theta * s);
+}
+
+
+//========================================================================
+// LieGroupElements::coupling
+//   Q = P/2 + a (KP + PK + KPK) + b (KKP + PKK - 3 KPK)
+//       + c (KPKK + KKPK),
+//   P and K the cross product matrices of rho and phi. The closed forms
+//   of a, b and c lose up to eps/theta^2 to cancellation, so below
+//   theta = 1 they are summed from their series (terms to theta^16).
+//========================================================================
+void LieGroupElements::coupling(const double *xi, double *m, int stride)
+{
+ const double *rho = xi, *phi = xi + 3;
+ double t2 = phi[0] * phi[0] + phi[1] * phi[1] + phi[2] * phi[2];
+ double a = 0, b = 0, c = 0;
+ if(t2 < 1)
+ {
+  // a, b, c: sums over k of (-t2)^k / (2k+3)!, / (2k+4)!, (k+1) / (2k+5)!
+  double term = 1, f = 1.0 / 6;
+  for(int k = 0; k < 8; ++k)
+  {
+   a += term * f;
+   f /= 2 * k + 4;
+   b += term * f;
+   f /= 2 * k + 5;
+   c += term * (k + 1) * f;
+   term *= -t2;
+  }
+ }
+ else
+ {
+  double theta = sqrt(t2), s, co;
+  sinCos(theta, s, co);
+  a = (theta - s) / (t2 * theta);
+  b = (t2 + 2 * co - 2) / (2 * t2 * t2);
+  c = (2 * theta - 3 * s + theta * co) / (2 * t2 * t2 * theta);
+ }
+
+ Matrix<3, 3, double> P, K;
+ P = 0, -rho[2], rho[1],
+     rho[2], 0, -rho[0],
+     -rho[1], rho[0], 0;
+ K = 0, -phi[2], phi[1],
+     phi[2], 0, -phi[0],
+     -phi[1], phi[0], 0;
+ Matrix<3, 3, double> KP = K * P, PK = P * K, KPK = KP * K;
+ Matrix<3, 3, double> KKP = K * KP, PKK = PK * K;
+ Matrix<3, 3, double> q = 0.5 * P + a * (KP + PK + KPK) + b * (KKP + PKK - 3.0 * KPK)
+                          + c * (KPK * K + K * KPK);
+ const double *e = q.Matrix<3, 3, double>::getElementsPointer();
+ for(int r = 0; r < 3; ++r)
+  for(int col = 0; col < 3; ++col)
+   m[r * stride + col] = e[r * 3 + col];
+}
+
+
+//========================================================================
+// expSO3
+//========================================================================
+Transform expSO3(const ColumnVector<3, double> &phi)
+{
+ const double *p = phi.Matrix<3, 1, double>::getElementsPointer();
+ double a, b, c;
+ LieGroupElements::coefficients(p[0] * p[0] + p[1] * p[1] + p[2] * p[2], a, b, c);
+ Transform t;
+ LieGroupElements::rotation(p, a, b, t.Matrix<4, 4, double>::getElementsPointer(), 4);
+ return t;
+}
+
+
+//========================================================================
+// logSO3
+//   theta from atan2(|w|/2, (trace - 1)/2), w the axial vector of R - R'
+//   (2 sin(theta) times the axis). Near pi, where w vanishes, the axis
+//   u is taken from the symmetric part (R + R')/2 - cos(theta) I =
+//   (1 - cos(theta)) u u', using its largest diagonal element, and its
+//   sign from w.
+//========================================================================
+ColumnVector<3, double> logSO3(const Transform &t)
+{
+ const double *e = t.Matrix<4, 4, double>::getElementsPointer();
+ ColumnVector<3, double> phi;
+ double *p = phi.Matrix<3, 1, double>::getElementsPointer();
+ double w[3] = {e[9] - e[6], e[2] - e[8], e[4] - e[1]};
+ double c = 0.5 * (e[0] + e[5] + e[10] - 1);
+ double s = 0.5 * sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+ double theta = atan2(s, c);
+ int i;
+
+ if(c < -0.9)
+ {
+  double d[3] = {e[0] - c, e[5] - c, e[10] - c};
+  int k = (d[0] >= d[1]) ? ((d[0] >= d[2]) ? 0 : 2) : ((d[1] >= d[2]) ? 1 : 2);
+  double scale = 1 / sqrt(d[k] * (1 - c));
+  for(i = 0; i < 3; ++i)
+   p[i] = (i == k) ? d[k] * scale : 0.5 * (e[4 * k + i] + e[4 * i + k]) * scale;
+  double norm = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+  if(p[0] * w[0] + p[1] * w[1] + p[2] * w[2] < 0)
+   norm = -norm;
+  for(i = 0; i < 3; ++i)
+   p[i] *= theta / norm;
+  return phi;
+ }
+
+ double t2 = theta * theta;
+ double k = (t2 < 1e-6) ? 0.5 + t2 / 12 * (1 + 7 * t2 / 60) : 0.5 * theta / s;
+ for(i = 0; i < 3; ++i)
+  p[i] = k * w[i];
+ return phi;
+}
+
+
+//========================================================================
+// expSE3
+//========================================================================
+Transform expSE3(const ColumnVector<6, double> &xi)
+{
+ const double *x = xi.Matrix<6, 1, double>::getElementsPointer();
+ double a, b, c, j[9];
+ LieGroupElements::coefficients(x[3] * x[3] + x[4] * x[4] + x[5] * x[5], a, b, c);
+ Transform t;
+ double *e = t.Matrix<4, 4, double>::getElementsPointer();
+ LieGroupElements::rotation(x + 3, a, b, e, 4);
+ LieGroupElements::rotation(x + 3, b, c, j, 3);
+ for(int r = 0; r < 3; ++r)
+  e[4 * r + 3] = j[3 * r] * x[0] + j[3 * r + 1] * x[1] + j[3 * r + 2] * x[2];
+ return t;
+}
+
+
+//========================================================================
+// logSE3
+//========================================================================
+ColumnVector<6, double> logSE3(const Transform &t)
+{
+ const double *e = t.Matrix<4, 4, double>::getElementsPointer();
+ ColumnVector<3, double> phi = logSO3(t);
+ const double *p = phi.Matrix<3, 1, double>::getElementsPointer();
+ double j[9];
+ double d = LieGroupElements::inverseCoefficient(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+ LieGroupElements::rotation(p, -0.5, d, j, 3);
+ ColumnVector<6, double> xi;
+ double *x = xi.Matrix<6, 1, double>::getElementsPointer();
+ for(int r = 0; r < 3; ++r)
+ {
+  x[r] = j[3 * r] * e[3] + j[3 * r + 1] * e[7] + j[3 * r + 2] * e[11];
+  x[r + 3] = p[r];
+ }
+ return xi;
+}
+
+
+//========================================================================
+// adjointSE3
+//========================================================================
+Matrix<6, 6, double> adjointSE3(const Transform &t)
+{
+ const double *e = t.Matrix<4, 4, double>::getElementsPointer();
+ Matrix<6, 6, double> ad;
+ double *m = ad.Matrix<6, 6, double>::getElementsPointer();
+ double p0 = e[3], p1 = e[7], p2 = e[11];
+ for(int c = 0; c < 3; ++c)
+ {
+  double r0 = e[c], r1 = e[4 + c], r2 = e[8 + c];
+  m[c] = r0;      m[6 + c] = r1;      m[12 + c] = r2;
+  m[21 + c] = r0; m[27 + c] = r1;     m[33 + c] = r2;
+  m[3 + c] = p1 * r2 - p2 * r1;
+  m[9 + c] = p2 * r0 - p0 * r2;
+  m[15 + c] = p0 * r1 - p1 * r0;
+  m[18 + c] = 0;  m[24 + c] = 0;      m[30 + c] = 0;
+ }
+ return ad;
+}
+
+
+//========================================================================
+// leftJacobianSO3
+//========================================================================
+Matrix<3, 3, double> leftJacobianSO3(const ColumnVector<3, double> &phi)
+{
+ const double *p = phi.Matrix<3, 1, double>::getElementsPointer();
+ double a, b, c;
+ LieGroupElements::coefficients(p[0] * p[0] + p[1] * p[1] + p[2] * p[2], a, b, c);
+ Matrix<3, 3, double> j;
+ LieGroupElements::rotation(p, b, c, j.Matrix<3, 3, double>::getElementsPointer(), 3);
+ return j;
+}
+
+
+//========================================================================
+// inverseLeftJacobianSO3
+//========================================================================
+Matrix<3, 3, double> inverseLeftJacobianSO3(const ColumnVector<3, double> &phi)
+{
+ const double *p = phi.Matrix<3, 1, double>::getElementsPointer();
+ Matrix<3, 3, double> j;
+ double d = LieGroupElements::inverseCoefficient(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+ LieGroupElements::rotation(p, -0.5, d, j.Matrix<3, 3, double>::getElementsPointer(), 3);
+ return j;
+}
+
+
+//========================================================================
+// leftJacobianSE3
+//========================================================================
+Matrix<6, 6, double> leftJacobianSE3(const ColumnVector<6, double> &xi)
+{
+ const double *x = xi.Matrix<6, 1, double>::getElementsPointer();
+ double a, b, c;
+ LieGroupElements::coefficients(x[3] * x[3] + x[4] * x[4] + x[5] * x[5], a, b, c);
+ Matrix<6, 6, double> j;
+ double *m = j.Matrix<6, 6, double>::getElementsPointer();
+ LieGroupElements::rotation(x + 3, b, c, m, 6);
+ LieGroupElements::rotation(x + 3, b, c, m + 21, 6);
+ LieGroupElements::coupling(x, m + 3, 6);
+ for(int i = 18; i < 36; i += 6)
+  m[i] = m[i + 1] = m[i + 2] = 0;
+ return j;
+}
+
+
+//========================================================================
+// inverseLeftJacobianSE3
+//========================================================================
+Matrix<6, 6, double> inverseLeftJacobianSE3(const ColumnVector<6, double> &xi)
+{
+ const double *x = xi.Matrix<6, 1, double>::getElementsPointer();
+ double q[9], ji[9], jq[9];
+ int r, c, k;
+ double d = LieGroupElements::inverseCoefficient(x[3] * x[3] + x[4] * x[4] + x[5] * x[5]);
+ LieGroupElements::rotation(x + 3, -0.5, d, ji, 3);
+ LieGroupElements::coupling(x, q, 3);
+ Matrix<6, 6, double> j;
+ double *m = j.Matrix<6, 6, double>::getElementsPointer();
+ for(r = 0; r < 3; ++r)
+  for(c = 0; c < 3; ++c)
+  {
+   jq[3 * r + c] = ji[3 * r] * q[c] + ji[3 * r + 1] * q[3 + c] + ji[3 * r + 2] * q[6 + c];
+   m[6 * r + c] = ji[3 * r + c];
+   m[6 * r + c + 21] = ji[3 * r + c];
+   m[6 * r + c + 18] = 0;
+  }
+ for(r = 0; r < 3; ++r)
+  for(c = 0; c < 3; ++c)
+  {
+   double sum = 0;
+   for(k = 0; k < 3; ++k)
+    sum += jq[3 * r + k] * ji[3 * k + c];
+   m[6 * r + c + 3] = -sum;
+  }
+ return j;
+}
+
+#endif
@@ -0,0 +1,439 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : MatrixBatch.hpp
+// Description          : Inverse, solve and determinant of arrays of
+//                        small matrices
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_MatrixBatch_hpp
+#define INCLUDED_MatrixBatch_hpp
+
+#include <math.h>
+#include "Matrix.hpp"
+
+#ifndef QMATH_BATCH_LANES
+#define QMATH_BATCH_LANES 8
+#endif
+ // Number of matrices processed together by the batch kernels. The
+ // innermost loops of the kernels run across this many matrices, so it
+ // should be a multiple of the SIMD width of the processor for T.
+
+//========================================================================
+// Batched matrix operations
+// -----------------------------------------------------------------------
+// \brief
+// Inverse, solution of linear systems and determinant for arrays of
+// independent matrices of the same size.
+//
+// The matrices are processed in groups of QMATH_BATCH_LANES. Each group
+// is copied into a structure-of-arrays buffer in which element (r, c) of
+// all matrices of the group is contiguous, and the elimination runs on
+// all of them at once: every arithmetic statement is a loop across the
+// group, which the compiler turns into SIMD instructions. Matrices up to
+// 3 x 3 use closed-form expressions; larger ones use Gaussian
+// elimination with partial pivoting (pivot search and row exchanges are
+// done per matrix, the elimination itself across the group). When the
+// library is compiled with OpenMP (e.g. -fopenmp with GCC, or
+// useomp=yes with the makefiles of the examples), the groups are
+// distributed across processor cores.
+//
+// A singular matrix does not interrupt the batch, and no exception is
+// thrown. Its entry in the optional \a singular array is set to true,
+// its output is left unchanged, and the number of singular matrices is
+// returned.
+//
+// <b>Example Program:</b>
+// \include MatrixBatch.t.cpp
+//========================================================================
+
+template<int size, class T>
+int inverse(const Matrix<size, size, T> *m, Matrix<size, size, T> *inv, int count,
+            bool *singular = 0);
+ // Inverts an array of matrices.
+ //  m         Array of \a count matrices.
+ //  inv       Array of \a count inverses. May be the same array as \a m.
+ //  count     Number of matrices.
+ //  singular  Optional array of \a count flags, set to true for the
+ //            matrices that are singular.
+ //  return    The number of singular matrices.
+ // Example:
+ // \code
+ // Matrix<6,6> M[1000], Minv[1000];
+ // bool singular[1000];
+ // int failed = inverse(M, Minv, 1000, singular);
+ // \endcode
+
+template<int size, int nrhs, class T>
+int solve(const Matrix<size, size, T> *A, const Matrix<size, nrhs, T> *B,
+          Matrix<size, nrhs, T> *X, int count, bool *singular = 0);
+ // Solves A[i] * X[i] = B[i] for an array of linear systems.
+ //  A         Array of \a count square matrices.
+ //  B         Array of \a count right hand sides.
+ //  X         Array of \a count solutions. May be the same array as \a B.
+ //  count     Number of systems.
+ //  singular  Optional array of \a count flags, set to true for the
+ //            systems whose matrix is singular.
+ //  return    The number of singular systems.
+
+template<int size, class T>
+void determinant(const Matrix<size, size, T> *m, T *det, int count);
+ // Computes the determinants of an array of matrices. Nearly singular
+ // matrices get their small determinant, as with determinant() of a
+ // single matrix.
+ //  m      Array of \a count matrices.
+ //  det    Array of \a count determinants.
+ //  count  Number of matrices.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// BatchElimination
+//   Internal. Holds QMATH_BATCH_LANES matrices of size n x n and as many
+//   n x nrhs right hand sides in structure-of-arrays form: a[e][l] is
+//   element e (row-major) of the matrix in lane l. eliminate() replaces
+//   b with the solutions, computes the determinants and flags singular
+//   lanes. The elimination divides by the pivots even below the
+//   singularity threshold, so that the determinant is their product at
+//   every size, as with the closed forms; only a zero pivot is replaced
+//   by 1, which leaves the determinant zero. The solutions of singular
+//   lanes are discarded by the callers. Keeping the buffers as separate
+//   member arrays lets the compiler prove that the lane loops are free
+//   of aliasing.
+//========================================================================
+template<int n, int nrhs, class T>
+class BatchElimination
+{
+ public:
+  enum { L = QMATH_BATCH_LANES };
+  T a[n * n][L];
+  T b[nrhs ? n * nrhs : 1][L];
+  T det[L];
+  bool singular[L];
+
+  template<int nr, int nc>
+  static void gather(const Matrix<nr, nc, T> *m, int first, int active,
+                     T fill, T (*buffer)[L]);
+   // Copies matrices first .. first + active - 1 of m into the lanes of
+   // buffer. Unused lanes receive fill on the diagonal and zeros
+   // elsewhere.
+
+  void eliminate();
+};
+
+
+//========================================================================
+// BatchElimination::gather
+//========================================================================
+template<int n, int nrhs, class T>
+template<int nr, int nc>
+void BatchElimination<n, nrhs, T>::gather(const Matrix<nr, nc, T> *m, int first,
+                                          int active, T fill, T (*buffer)[L])
+{
+ int l, e;
+ for(l = 0; l < active; ++l)
+ {
+  const T *p = m[first + l].Matrix<nr, nc, T>::getElementsPointer(); // static call
+  for(e = 0; e < nr * nc; ++e)
+   buffer[e][l] = p[e];
+ }
+ for(; l < L; ++l)
+  for(e = 0; e < nr * nc; ++e)
+   buffer[e][l] = ((e / nc) == (e % nc)) ? fill : 0;
+}
+
+
+//========================================================================
+// BatchElimination::eliminate
+//========================================================================
+template<int n, int nrhs, class T>
+void BatchElimination<n, nrhs, T>::eliminate()
+{
+ const T eps = NumericTraits<T>::epsilon();
+ T ipiv[n][L];
+ T f[L];
+ int l, r, c, k;
+
+ for(l = 0; l < L; ++l)
+ {
+  det[l] = 1;
+  singular[l] = false;
+ }
+
+ if( n == 1 )
+ {
+  for(l = 0; l < L; ++l)
+  {
+   det[l] = a[0][l];
+   singular[l] = (fabs(a[0][l]) < eps);
+   f[l] = singular[l] ? 0 : 1 / a[0][l];
+  }
+  for(c = 0; c < nrhs; ++c)
+   for(l = 0; l < L; ++l)
+    b[c][l] *= f[l];
+  return;
+ }
+
+ if( n == 2 )
+ {
+  for(l = 0; l < L; ++l)
+  {
+   det[l] = a[0][l] * a[3][l] - a[1][l] * a[2][l];
+   singular[l] = (fabs(det[l]) < eps);
+   f[l] = singular[l] ? 0 : 1 / det[l];
+  }
+  for(c = 0; c < nrhs; ++c)
+   for(l = 0; l < L; ++l)
+   {
+    T x0 = (a[3][l] * b[c][l] - a[1][l] * b[nrhs + c][l]) * f[l];
+    T x1 = (a[0][l] * b[nrhs + c][l] - a[2][l] * b[c][l]) * f[l];
+    b[c][l] = x0;
+    b[nrhs + c][l] = x1;
+   }
+  return;
+ }
+
+ if( n == 3 )
+ {
+  T cof[9][L];
+  for(l = 0; l < L; ++l)
+  {
+   cof[0][l] = a[4][l] * a[8][l] - a[5][l] * a[7][l];
+   cof[1][l] = a[2][l] * a[7][l] - a[1][l] * a[8][l];
+   cof[2][l] = a[1][l] * a[5][l] - a[2][l] * a[4][l];
+   cof[3][l] = a[5][l] * a[6][l] - a[3][l] * a[8][l];
+   cof[4][l] = a[0][l] * a[8][l] - a[2][l] * a[6][l];
+   cof[5][l] = a[2][l] * a[3][l] - a[0][l] * a[5][l];
+   cof[6][l] = a[3][l] * a[7][l] - a[4][l] * a[6][l];
+   cof[7][l] = a[1][l] * a[6][l] - a[0][l] * a[7][l];
+   cof[8][l] = a[0][l] * a[4][l] - a[1][l] * a[3][l];
+   det[l] = a[0][l] * cof[0][l] + a[3][l] * cof[1][l] + a[6][l] * cof[2][l];
+  }
+  for(l = 0; l < L; ++l)
+  {
+   singular[l] = (fabs(det[l]) < eps);
+   f[l] = singular[l] ? 0 : 1 / det[l];
+  }
+  for(c = 0; c < nrhs; ++c)
+   for(l = 0; l < L; ++l)
+   {
+    T b0 = b[c][l], b1 = b[nrhs + c][l], b2 = b[2 * nrhs + c][l];
+    b[c][l] = (cof[0][l] * b0 + cof[1][l] * b1 + cof[2][l] * b2) * f[l];
+    b[nrhs + c][l] = (cof[3][l] * b0 + cof[4][l] * b1 + cof[5][l] * b2) * f[l];
+    b[2 * nrhs + c][l] = (cof[6][l] * b0 + cof[7][l] * b1 + cof[8][l] * b2) * f[l];
+   }
+  return;
+ }
+
+ // forward elimination with partial pivoting
+ for(k = 0; k < n; ++k)
+ {
+  for(l = 0; l < L; ++l)
+  {
+   int p = k;
+   T big = fabs(a[k * n + k][l]);
+   for(r = k + 1; r < n; ++r)
+   {
+    if(fabs(a[r * n + k][l]) > big)
+    {
+     big = fabs(a[r * n + k][l]);
+     p = r;
+    }
+   }
+   if(p != k)
+   {
+    for(c = k; c < n; ++c)
+    {
+     T tmp = a[k * n + c][l];
+     a[k * n + c][l] = a[p * n + c][l];
+     a[p * n + c][l] = tmp;
+    }
+    for(c = 0; c < nrhs; ++c)
+    {
+     T tmp = b[k * nrhs + c][l];
+     b[k * nrhs + c][l] = b[p * nrhs + c][l];
+     b[p * nrhs + c][l] = tmp;
+    }
+    det[l] = -det[l];
+   }
+   det[l] *= a[k * n + k][l];
+   if(big < eps)
+   {
+    singular[l] = true;
+    if(big == 0)
+     a[k * n + k][l] = 1; // keep the remaining arithmetic finite
+   }
+  }
+
+  // the pivot row is copied so that the updates below provably do not
+  // overlap the row they read from
+  T pivot[n + nrhs][L];
+  for(l = 0; l < L; ++l)
+   ipiv[k][l] = 1 / a[k * n + k][l];
+  for(c = k + 1; c < n; ++c)
+   for(l = 0; l < L; ++l)
+    pivot[c][l] = a[k * n + c][l];
+  for(c = 0; c < nrhs; ++c)
+   for(l = 0; l < L; ++l)
+    pivot[n + c][l] = b[k * nrhs + c][l];
+  for(r = k + 1; r < n; ++r)
+  {
+   for(l = 0; l < L; ++l)
+    f[l] = a[r * n + k][l] * ipiv[k][l];
+   for(c = k + 1; c < n; ++c)
+    for(l = 0; l < L; ++l)
+     a[r * n + c][l] -= f[l] * pivot[c][l];
+   for(c = 0; c < nrhs; ++c)
+    for(l = 0; l < L; ++l)
+     b[r * nrhs + c][l] -= f[l] * pivot[n + c][l];
+  }
+ }
+
+ // back substitution
+ for(r = n - 1; r >= 0; --r)
+  for(c = 0; c < nrhs; ++c)
+  {
+   for(l = 0; l < L; ++l)
+    f[l] = b[r * nrhs + c][l];
+   for(k = r + 1; k < n; ++k)
+    for(l = 0; l < L; ++l)
+     f[l] -= a[r * n + k][l] * b[k * nrhs + c][l];
+   for(l = 0; l < L; ++l)
+    b[r * nrhs + c][l] = f[l] * ipiv[r][l];
+  }
+}
+
+
+//========================================================================
+// solve
+//========================================================================
+template<int size, int nrhs, class T>
+int solve(const Matrix<size, size, T> *A, const Matrix<size, nrhs, T> *B,
+          Matrix<size, nrhs, T> *X, int count, bool *singular)
+{
+ typedef BatchElimination<size, nrhs, T> Kernel;
+ const int L = Kernel::L;
+ const int groups = (count + L - 1) / L;
+ int failures = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:failures) schedule(static)
+#endif
+ for(int g = 0; g < groups; ++g)
+ {
+  Kernel kernel;
+  int first = g * L;
+  int active = (count - first < L) ? (count - first) : L;
+
+  Kernel::gather(A, first, active, (T)1, kernel.a);
+  Kernel::gather(B, first, active, (T)0, kernel.b);
+  kernel.eliminate();
+
+  for(int l = 0; l < active; ++l)
+  {
+   if(singular)
+    singular[first + l] = kernel.singular[l];
+   if(kernel.singular[l])
+   {
+    ++failures;
+    continue;
+   }
+   T *x = X[first + l].Matrix<size, nrhs, T>::getElementsPointer();
+   for(int e = 0; e < size * nrhs; ++e)
+    x[e] = kernel.b[e][l];
+  }
+ }
+ return failures;
+}
+
+
+//========================================================================
+// inverse
+//========================================================================
+template<int size, class T>
+int inverse(const Matrix<size, size, T> *m, Matrix<size, size, T> *inv, int count,
+            bool *singular)
+{
+ typedef BatchElimination<size, size, T> Kernel;
+ const int L = Kernel::L;
+ const int groups = (count + L - 1) / L;
+ int failures = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(+:failures) schedule(static)
+#endif
+ for(int g = 0; g < groups; ++g)
+ {
+  Kernel kernel;
+  int first = g * L;
+  int active = (count - first < L) ? (count - first) : L;
+
+  Kernel::gather(m, first, active, (T)1, kernel.a);
+  for(int e = 0; e < size * size; ++e)
+   for(int l = 0; l < L; ++l)
+    kernel.b[e][l] = ((e / size) == (e % size)) ? 1 : 0;
+  kernel.eliminate();
+
+  for(int l = 0; l < active; ++l)
+  {
+   if(singular)
+    singular[first + l] = kernel.singular[l];
+   if(kernel.singular[l])
+   {
+    ++failures;
+    continue;
+   }
+   T *x = inv[first + l].Matrix<size, size, T>::getElementsPointer();
+   for(int e = 0; e < size * size; ++e)
+    x[e] = kernel.b[e][l];
+  }
+ }
+ return failures;
+}
+
+
+//========================================================================
+// determinant
+//========================================================================
+template<int size, class T>
+void determinant(const Matrix<size, size, T> *m, T *det, int count)
+{
+ typedef BatchElimination<size, 0, T> Kernel;
+ const int L = Kernel::L;
+ const int groups = (count + L - 1) / L;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int g = 0; g < groups; ++g)
+ {
+  Kernel kernel;
+  int first = g * L;
+  int active = (count - first < L) ? (count - first) : L;
+
+  Kernel::gather(m, first, active, (T)1, kernel.a);
+  kernel.eliminate();
+  for(int l = 0; l < active; ++l)
+   det[first + l] = kernel.det[l];
+ }
+}
+
+
+#endif
@@ -0,0 +1,161 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : MatrixExponential.hpp
+// Description          : Matrix exponential and discretization of linear
+//                        state-space models
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_MatrixExponential_hpp
+#define INCLUDED_MatrixExponential_hpp
+
+#include <math.h>
+#include "Matrix.hpp"
+
+//========================================================================
+// Matrix exponential
+// -----------------------------------------------------------------------
+// \brief
+// The exponential of a square matrix, and the exact zero-order-hold
+// discretization of a linear plant x' = A x + B u.
+//
+// expm() uses scaling and squaring with a diagonal (6,6) Pade
+// approximant: A is scaled by 2^-s so that its infinity norm is below
+// 1/2, the approximant is evaluated with one linear solve (no explicit
+// inverse), and the result is squared s times. For a linear
+// time-invariant system the transition matrix expm(A * dt) needs to be
+// computed once, and then replaces numerical integration such as
+// \c ODESolverRK4 over that time step.
+//
+// <b>Example Program:</b>
+// \include MatrixExponential.t.cpp
+//========================================================================
+
+template<int size, class T>
+Matrix<size, size, T> expm(const Matrix<size, size, T> &A);
+ //  return  The matrix exponential of \a A.
+ // Example:
+ // \code
+ // Matrix<2,2> A, Ad;
+ // Ad = expm(A * dt); // x(k+1) = Ad * x(k)
+ // \endcode
+
+template<int n, int m, class T>
+void zeroOrderHold(const Matrix<n, n, T> &A, const Matrix<n, m, T> &B, T dt,
+                   Matrix<n, n, T> &Ad, Matrix<n, m, T> &Bd);
+ // Exact discretization of the continuous-time plant x' = A x + B u for
+ // an input held constant over each sampling period, such that
+ // x(k+1) = Ad * x(k) + Bd * u(k).
+ //  A, B    The continuous-time system and input matrices.
+ //  dt      The sampling period.
+ //  Ad      Receives expm(A * dt).
+ //  Bd      Receives the integral of expm(A * t) * B for t from 0 to dt.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// expm
+//========================================================================
+template<int n, class T>
+Matrix<n, n, T> expm(const Matrix<n, n, T> &A)
+{
+ const int q = 6;
+ const T *a = A.getElementsPointer();
+ int r, c;
+
+ // scale so that the infinity norm is at most 1/2
+ T norm = 0;
+ for(r = 0; r < n; ++r)
+ {
+  T rowSum = 0;
+  for(c = 0; c < n; ++c)
+   rowSum += fabs(a[r * n + c]);
+  if(rowSum > norm) norm = rowSum;
+ }
+ int e = 0;
+ frexp(norm, &e);
+ int s = (e + 1 > 0) ? (e + 1) : 0;
+ Matrix<n, n, T> As(A);
+ As *= (T)ldexp(1.0, -s);
+
+ // Pade approximant N(As)/D(As) accumulated term by term
+ Matrix<n, n, T> X(As);
+ Matrix<n, n, T> N;
+ Matrix<n, n, T> D;
+ T *pn = N.getElementsPointer();
+ T *pd = D.getElementsPointer();
+ const T *px = X.getElementsPointer();
+ T coeff = (T)0.5;
+ for(r = 0; r < n * n; ++r)
+ {
+  pn[r] = coeff * px[r];
+  pd[r] = -coeff * px[r];
+ }
+ for(r = 0; r < n; ++r)
+ {
+  pn[r * n + r] += 1;
+  pd[r * n + r] += 1;
+ }
+
+ bool positive = true;
+ for(int k = 2; k <= q; ++k)
+ {
+  coeff = coeff * (q - k + 1) / (k * (2 * q - k + 1));
+  X = As * X;
+  px = X.getElementsPointer();
+  for(r = 0; r < n * n; ++r)
+  {
+   pn[r] += coeff * px[r];
+   if(positive)
+    pd[r] += coeff * px[r];
+   else
+    pd[r] -= coeff * px[r];
+  }
+  positive = !positive;
+ }
+
+ Matrix<n, n, T> E = solve(D, N);
+
+ // undo the scaling by repeated squaring
+ for(int k = 0; k < s; ++k)
+  E = E * E;
+ return E;
+}
+
+
+//========================================================================
+// zeroOrderHold
+//========================================================================
+template<int n, int m, class T>
+void zeroOrderHold(const Matrix<n, n, T> &A, const Matrix<n, m, T> &B, T dt,
+                   Matrix<n, n, T> &Ad, Matrix<n, m, T> &Bd)
+{
+ // expm([A B; 0 0] * dt) = [Ad Bd; 0 I]
+ Matrix<n + m, n + m, T> M;
+ M = 0;
+ M.setSubMatrix(1, 1, A * dt);
+ M.setSubMatrix(1, n + 1, B * dt);
+ Matrix<n + m, n + m, T> E = expm(M);
+ E.getSubMatrix(1, 1, Ad);
+ E.getSubMatrix(1, n + 1, Bd);
+}
+
+
+#endif
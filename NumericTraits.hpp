@@ -0,0 +1,116 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : NumericTraits.hpp
+// Description          : Properties of the scalar types used by the
+//                        library
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_NumericTraits_hpp
+#define INCLUDED_NumericTraits_hpp
+
+//========================================================================
+// class NumericTraits
+// -----------------------------------------------------------------------
+// \brief
+// Type-dependent constants and types used by the library kernels.
+//
+// The library throws QMathException_divideByZero and
+// QMathException_singular when a divisor, pivot or determinant is
+// smaller in magnitude than epsilon(). The value depends on the
+// precision of the scalar type: 1e-6 for float, 1e-12 for double.
+//
+// Sums of products (dot products, matrix products and norms) are
+// accumulated in AccumulatorType. This is the scalar type itself,
+// unless the library is compiled with QMATH_MIXED_PRECISION defined, in
+// which case float data is accumulated in double. This retains the
+// storage and bandwidth advantage of float while reducing round-off
+// error in long sums.
+//
+// Constant coefficients of filters, integrators and differentiators are
+// computed in double when the object is configured, and stored as
+// CoefficientType for use at run time. For the built-in floating point
+// types this is the type itself (double for other types such as
+// matrices); fixed-point types (see FixedPoint.hpp) use a fixed-point
+// format with more fractional bits than the data, so that no floating
+// point arithmetic is required at run time.
+//
+// Specialize this class to use the library with other scalar types.
+//========================================================================
+
+template<class T>
+class NumericTraits
+{
+ public:
+  typedef T AccumulatorType;
+   // Type in which sums of products are accumulated.
+
+  typedef T ScalarType;
+   // The scalar type itself. Used by the library in function
+   // signatures where the scalar argument must not take part in
+   // template argument deduction (so that, for instance, a double
+   // constant can scale a float matrix).
+
+  typedef double CoefficientType;
+   // Type of constant coefficients computed at configuration time.
+
+  static inline T epsilon() { return (T)1e-10; }
+   //  return  Magnitude below which divisors, pivots and determinants
+   //          are treated as zero.
+};
+
+
+template<>
+class NumericTraits<float>
+{
+ public:
+#ifdef QMATH_MIXED_PRECISION
+  typedef double AccumulatorType;
+#else
+  typedef float AccumulatorType;
+#endif
+  typedef float ScalarType;
+  typedef float CoefficientType;
+  static inline float epsilon() { return 1e-6f; }
+};
+
+
+template<>
+class NumericTraits<double>
+{
+ public:
+  typedef double AccumulatorType;
+  typedef double ScalarType;
+  typedef double CoefficientType;
+  static inline double epsilon() { return 1e-12; }
+};
+
+
+template<>
+class NumericTraits<long double>
+{
+ public:
+  typedef long double AccumulatorType;
+  typedef long double ScalarType;
+  typedef long double CoefficientType;
+  static inline long double epsilon() { return 1e-15L; }
+};
+
+
+#endif
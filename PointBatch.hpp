@@ -0,0 +1,369 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : PointBatch.hpp
+// Description          : Rigid body transformation of arrays of points
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_PointBatch_hpp
+#define INCLUDED_PointBatch_hpp
+
+#include "Simd.hpp"
+#include "Vec3.hpp"
+#include "RigidTransform.hpp"
+#include "VectorBatch.hpp"
+
+//========================================================================
+// Batched point transformation
+// -----------------------------------------------------------------------
+// \brief
+// Applies a \c Transform or a \c RigidTransform to every point of an
+// array, such as the points of a laser scan or a point cloud.
+//
+// Each point p is mapped to R p + d, where R is the rotation and d the
+// translation of the transform. The bottom row of a homogeneous matrix
+// is never used, so that a point takes nine multiplications and nine
+// additions instead of the sixteen of each of a product with a
+// \c ColumnVector<4>. The points can be given
+// \li in structure-of-arrays form, as three arrays x[], y[] and z[] of
+//     the coordinates. Four points at a time are computed with SIMD
+//     instructions (see Simd.hpp); this is the fastest layout.
+// \li as one interleaved array x0 y0 z0 x1 y1 z1 ..., the layout of
+//     most sensor drivers. The points are computed one at a time.
+// \li as an array of \c Vec3, each of which fills one group of four
+//     SIMD lanes.
+// \li as an array of \c ColumnVector<3>, computed one at a time
+//     directly on the element storage.
+//
+// When the processor has fused multiply-add instructions and the
+// compiler targets them (e.g. -mavx2 -mfma with GCC), every product and
+// sum is fused, and four doubles fill one AVX register. With OpenMP
+// (e.g. -fopenmp with GCC), the arrays are split into chunks of
+// QMATH_BATCH_CHUNK points that are distributed across processor cores,
+// as in VectorBatch.hpp.
+//
+// The elements of a \c Transform are converted to T, so that float
+// points are transformed in single precision. The results may be written
+// over the input (e.g. tx == x, ty == y and tz == z, or txyz == xyz) to
+// transform the points in place, but must not otherwise overlap it.
+//
+// <b>Example Program:</b>
+// \include PointBatch.t.cpp
+//========================================================================
+
+template<class T>
+void transformPoints(const Transform &t, const T *x, const T *y, const T *z,
+                     T *tx, T *ty, T *tz, int count);
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const T *x, const T *y, const T *z,
+                     T *tx, T *ty, T *tz, int count);
+ // Transforms the points (x[i], y[i], z[i]) for i = 0 to count - 1 and
+ // writes the results to (tx[i], ty[i], tz[i]).
+ // Example:
+ // \code
+ // float x[2048], y[2048], z[2048];        // a scan in the sensor frame
+ // Transform robotToSensor = ...;
+ // transformPoints(robotToSensor, x, y, z, x, y, z, 2048);  // in place
+ // \endcode
+
+template<class T>
+void transformPoints(const Transform &t, const T *xyz, T *txyz, int count);
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const T *xyz, T *txyz, int count);
+ // Transforms count points stored as x0 y0 z0 x1 y1 z1 ... in xyz and
+ // writes them to txyz in the same layout.
+
+template<class T>
+void transformPoints(const Transform &t, const Vec3<T> *p, Vec3<T> *tp, int count);
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const Vec3<T> *p, Vec3<T> *tp, int count);
+template<class T>
+void transformPoints(const Transform &t, const ColumnVector<3, T> *p,
+                     ColumnVector<3, T> *tp, int count);
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const ColumnVector<3, T> *p,
+                     ColumnVector<3, T> *tp, int count);
+ // Computes tp[i] = t p[i] for i = 0 to count - 1.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// BatchPoint3
+//   Internal. Single threaded kernels for the functions above, working
+//   on n points with the transform given as the twelve elements of a
+//   RigidTransform (row by row). The structure-of-arrays kernel handles
+//   the last incomplete group of four through zero-padded copies, as
+//   BatchVector3 does, so that every point is computed with the same
+//   rounding.
+//========================================================================
+template<class T>
+class BatchPoint3
+{
+ public:
+  enum { C = QMATH_BATCH_CHUNK };
+
+  static RigidTransform<T> rigid(const Transform &t);
+   // The twelve elements of t converted to T.
+
+  static void transform(const T *m, const T *x, const T *y, const T *z,
+                        T *tx, T *ty, T *tz, int n);
+  static void transform(const T *m, const T *xyz, T *txyz, int n);
+  static void transform(const T *m, const Vec3<T> *p, Vec3<T> *tp, int n);
+  static void transform(const T *m, const ColumnVector<3, T> *p,
+                        ColumnVector<3, T> *tp, int n);
+};
+
+
+//========================================================================
+// BatchPoint3::rigid
+//========================================================================
+template<class T>
+RigidTransform<T> BatchPoint3<T>::rigid(const Transform &t)
+{
+ const double *e = t.Matrix<4, 4, double>::getElementsPointer(); // static call
+ RigidTransform<T> r;
+ T *f = r.getElementsPointer();
+ for(int i = 0; i < 12; ++i)
+  f[i] = (T)e[i];
+ return r;
+}
+
+
+//========================================================================
+// BatchPoint3::transform (component arrays)
+//========================================================================
+template<class T>
+void BatchPoint3<T>::transform(const T *m, const T *x, const T *y, const T *z,
+                               T *tx, T *ty, T *tz, int n)
+{
+ typedef Simd4<T> S;
+ S r11 = S::broadcast(m[0]), r12 = S::broadcast(m[1]), r13 = S::broadcast(m[2]);
+ S r21 = S::broadcast(m[4]), r22 = S::broadcast(m[5]), r23 = S::broadcast(m[6]);
+ S r31 = S::broadcast(m[8]), r32 = S::broadcast(m[9]), r33 = S::broadcast(m[10]);
+ S d1 = S::broadcast(m[3]), d2 = S::broadcast(m[7]), d3 = S::broadcast(m[11]);
+ int i;
+ for(i = 0; i + 4 <= n; i += 4)
+ {
+  S px = S::load(x + i), py = S::load(y + i), pz = S::load(z + i);
+  S::multiplyAdd(r13, pz, S::multiplyAdd(r12, py, S::multiplyAdd(r11, px, d1))).store(tx + i);
+  S::multiplyAdd(r23, pz, S::multiplyAdd(r22, py, S::multiplyAdd(r21, px, d2))).store(ty + i);
+  S::multiplyAdd(r33, pz, S::multiplyAdd(r32, py, S::multiplyAdd(r31, px, d3))).store(tz + i);
+ }
+ if(i < n)
+ {
+  T t[6][4];
+  int j, k = n - i;
+  for(j = 0; j < 4; ++j)
+  {
+   t[0][j] = (j < k) ? x[i + j] : 0;
+   t[1][j] = (j < k) ? y[i + j] : 0;
+   t[2][j] = (j < k) ? z[i + j] : 0;
+  }
+  transform(m, t[0], t[1], t[2], t[3], t[4], t[5], 4);
+  for(j = 0; j < k; ++j)
+  {
+   tx[i + j] = t[3][j];
+   ty[i + j] = t[4][j];
+   tz[i + j] = t[5][j];
+  }
+ }
+}
+
+
+//========================================================================
+// BatchPoint3::transform (interleaved array)
+//========================================================================
+template<class T>
+void BatchPoint3<T>::transform(const T *m, const T *xyz, T *txyz, int n)
+{
+ T r11 = m[0], r12 = m[1], r13 = m[2], d1 = m[3];
+ T r21 = m[4], r22 = m[5], r23 = m[6], d2 = m[7];
+ T r31 = m[8], r32 = m[9], r33 = m[10], d3 = m[11];
+ for(int i = 0; i < 3 * n; i += 3)
+ {
+  T x = xyz[i], y = xyz[i + 1], z = xyz[i + 2];
+  txyz[i] = r11 * x + r12 * y + r13 * z + d1;
+  txyz[i + 1] = r21 * x + r22 * y + r23 * z + d2;
+  txyz[i + 2] = r31 * x + r32 * y + r33 * z + d3;
+ }
+}
+
+
+//========================================================================
+// BatchPoint3::transform (arrays of Vec3)
+//   The columns of the transform, (r1j, r2j, r3j, 0), scaled by the
+//   coordinates of the point and summed: the padding lane stays zero.
+//========================================================================
+template<class T>
+void BatchPoint3<T>::transform(const T *m, const Vec3<T> *p, Vec3<T> *tp, int n)
+{
+ typedef Simd4<T> S;
+ S c1 = S::set(m[0], m[4], m[8], 0), c2 = S::set(m[1], m[5], m[9], 0);
+ S c3 = S::set(m[2], m[6], m[10], 0), d = S::set(m[3], m[7], m[11], 0);
+ for(int i = 0; i < n; ++i)
+ {
+  const T *e = p[i].getElementsPointer();
+  S::multiplyAdd(c3, S::broadcast(e[2]),
+                 S::multiplyAdd(c2, S::broadcast(e[1]), S::multiplyAdd(c1, S::broadcast(e[0]), d)))
+   .store(tp[i].getElementsPointer());
+ }
+}
+
+
+//========================================================================
+// BatchPoint3::transform (arrays of ColumnVector)
+//========================================================================
+template<class T>
+void BatchPoint3<T>::transform(const T *m, const ColumnVector<3, T> *p,
+                               ColumnVector<3, T> *tp, int n)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  const T *e = p[i].Matrix<3, 1, T>::getElementsPointer(); // static calls
+  T x = e[0], y = e[1], z = e[2];
+  T *f = tp[i].Matrix<3, 1, T>::getElementsPointer();
+  f[0] = m[0] * x + m[1] * y + m[2] * z + m[3];
+  f[1] = m[4] * x + m[5] * y + m[6] * z + m[7];
+  f[2] = m[8] * x + m[9] * y + m[10] * z + m[11];
+ }
+}
+
+
+//========================================================================
+// transformPoints (component arrays)
+//========================================================================
+template<class T>
+void transformPoints(const Transform &t, const T *x, const T *y, const T *z,
+                     T *tx, T *ty, T *tz, int count)
+{
+ transformPoints(BatchPoint3<T>::rigid(t), x, y, z, tx, ty, tz, count);
+}
+
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const T *x, const T *y, const T *z,
+                     T *tx, T *ty, T *tz, int count)
+{
+ typedef BatchPoint3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+ const T *m = t.getElementsPointer();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::transform(m, x + i, y + i, z + i, tx + i, ty + i, tz + i, n);
+ }
+}
+
+
+//========================================================================
+// transformPoints (interleaved array)
+//========================================================================
+template<class T>
+void transformPoints(const Transform &t, const T *xyz, T *txyz, int count)
+{
+ transformPoints(BatchPoint3<T>::rigid(t), xyz, txyz, count);
+}
+
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const T *xyz, T *txyz, int count)
+{
+ typedef BatchPoint3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+ const T *m = t.getElementsPointer();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::transform(m, xyz + 3 * i, txyz + 3 * i, n);
+ }
+}
+
+
+//========================================================================
+// transformPoints (arrays of Vec3)
+//========================================================================
+template<class T>
+void transformPoints(const Transform &t, const Vec3<T> *p, Vec3<T> *tp, int count)
+{
+ transformPoints(BatchPoint3<T>::rigid(t), p, tp, count);
+}
+
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const Vec3<T> *p, Vec3<T> *tp, int count)
+{
+ typedef BatchPoint3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+ const T *m = t.getElementsPointer();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::transform(m, p + i, tp + i, n);
+ }
+}
+
+
+//========================================================================
+// transformPoints (arrays of ColumnVector)
+//========================================================================
+template<class T>
+void transformPoints(const Transform &t, const ColumnVector<3, T> *p,
+                     ColumnVector<3, T> *tp, int count)
+{
+ transformPoints(BatchPoint3<T>::rigid(t), p, tp, count);
+}
+
+template<class T>
+void transformPoints(const RigidTransform<T> &t, const ColumnVector<3, T> *p,
+                     ColumnVector<3, T> *tp, int count)
+{
+ typedef BatchPoint3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+ const T *m = t.getElementsPointer();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::transform(m, p + i, tp + i, n);
+ }
+}
+
+
+#endif
@@ -0,0 +1,405 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : PoseTrajectory.hpp
+// Description          : Interpolation of poses between waypoints
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_PoseTrajectory_hpp
+#define INCLUDED_PoseTrajectory_hpp
+
+#include <math.h>
+#include "Quaternion.hpp"
+#include "Elementwise.hpp"
+#include "VectorBatch.hpp"
+#include "MathException.hpp"
+
+//========================================================================
+/*! \enum _QMathTimeScaling
+    \brief Time scalings of a trajectory segment */
+//========================================================================
+typedef enum _QMathTimeScaling
+{
+ QMathTimeScaling_linear  = 0x00,  //!< s = tau. Constant velocity along a segment.
+ QMathTimeScaling_cubic   = 0x01,  //!< s = 3 tau^2 - 2 tau^3. Zero velocity at the waypoints.
+ QMathTimeScaling_quintic = 0x02   /*!< s = 10 tau^3 - 15 tau^4 + 6 tau^5. Zero velocity
+                                        and acceleration at the waypoints. */
+}QMathTimeScaling_t;
+
+
+//====================================================================
+// class PoseTrajectory
+// -------------------------------------------------------------------
+// \brief
+// A trajectory of poses through n (at least 2) waypoints.
+//
+// Waypoint i (1 to n) is a \c Transform reached at a given time. Between
+// two waypoints the origin moves along the straight line and the
+// orientation rotates about a fixed axis at the rate of slerp(), along
+// the shorter arc. The fraction s of the segment covered at time t is a
+// function of tau = (t - t_i) / (t_{i+1} - t_i) chosen by the time
+// scaling: linear, or the cubic and quintic polynomials that start and
+// stop each segment at rest. Before the first and after the last
+// waypoint the pose stays at that waypoint.
+//
+// Setting a waypoint precomputes the two segments that end at it: the
+// start position and the change of position, the start orientation q0
+// as a quaternion, half the angle phi of the rotation to the end
+// orientation, and the quaternion q1 = q0 [u, 0] for its axis u. The
+// orientation at s is then cos(s phi) q0 + sin(s phi) q1, and a pose
+// costs one sine and one cosine, two scaled sums of four elements (see
+// Simd.hpp) and the conversion to a matrix. getPoses() samples many
+// times into the caller's array: it computes the sines and cosines of a
+// whole block of samples with elementSin() and elementCos(), and when
+// compiled with OpenMP shares the blocks among processor cores. No
+// memory is allocated.
+//
+// <b>Example Program:</b>
+// \include PoseTrajectory.t.cpp
+//========================================================================
+
+template<int n>
+class PoseTrajectory
+{
+ public:
+  inline PoseTrajectory(QMathTimeScaling_t scaling = QMathTimeScaling_linear);
+   // The default constructor. Waypoint i is the identity at time i - 1.
+   //  scaling  The time scaling of the segments.
+
+  ~PoseTrajectory() {}
+   // The default destructor.
+
+  inline void setWaypoint(int i, double time, const Transform &pose);
+   // Sets waypoint i (1 to n). The times must increase with i once all
+   // waypoints are set. Only the rotational and translational parts of
+   // \a pose are used, the rotation is assumed to be orthonormal. Throws
+   // an illegalIndex exception if i is out of range.
+
+  inline double getTime(int i) const;
+  inline Transform getWaypoint(int i) const;
+   //  return  The time or the pose of waypoint i (1 to n).
+
+  inline void setTimeScaling(QMathTimeScaling_t scaling) { d_scaling = scaling; }
+  inline QMathTimeScaling_t getTimeScaling() const { return d_scaling; }
+   // Set or get the time scaling of the segments.
+
+  inline double getStartTime() const { return d_time[0]; }
+  inline double getEndTime() const { return d_time[n - 1]; }
+   //  return  The time of the first or of the last waypoint.
+
+  inline Transform getPose(double t) const;
+   //  return  The pose at time t.
+
+  void getPoses(double start, double step, Transform *pose, int count) const;
+   // Computes pose[k], k = 0 to count - 1, as the pose at time
+   // start + k step.
+
+  void getPoses(const double *time, Transform *pose, int count) const;
+   // Computes pose[k], k = 0 to count - 1, as the pose at time[k]. The
+   // times need not be sorted, but sorted times are found faster.
+
+ private:
+  inline void checkIndex(int i) const;
+  inline void setSegment(int k);
+  inline int findSegment(double t) const;
+  inline int nextSegment(double t, int k) const;
+  inline double fraction(double t, int k) const;
+  inline void setPose(int k, double s, double c, double sn, double *e) const;
+  void poses(const double *time, double start, double step, int first,
+             Transform *pose, int count) const;
+
+  QMathTimeScaling_t d_scaling;
+  double d_time[n];                  // waypoint times
+  Transform d_waypoint[n];
+  Quaternion<> d_rotation[n];        // waypoint orientations, q0 of each segment
+  Vec3<> d_position[n];              // waypoint positions
+  // segment k goes from waypoint k to waypoint k + 1 (0-based)
+  Vec3<> d_delta[n];                 // change of position
+  Quaternion<> d_normal[n];          // q1 = q0 [u, 0]
+  double d_angle[n];                 // half the rotation angle phi
+  double d_rate[n];                  // 1 / duration
+};
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// PoseTrajectory::PoseTrajectory
+//========================================================================
+template<int n>
+PoseTrajectory<n>::PoseTrajectory(QMathTimeScaling_t scaling)
+ : d_scaling(scaling)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  d_time[i] = i;
+  d_position[i] = Vec3<>(0, 0, 0);
+ }
+ for(int k = 0; k < n - 1; ++k)
+  setSegment(k);
+}
+
+
+//========================================================================
+// PoseTrajectory::checkIndex
+//========================================================================
+template<int n>
+void PoseTrajectory<n>::checkIndex(int i) const
+{
+ if( (i < 1) || (i > n) )
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_illegalIndex);
+  throw exception;
+ }
+}
+
+
+//========================================================================
+// PoseTrajectory::setSegment
+//   With r = conj(q0) q1 = [sin(phi) u, cos(phi)] the rotation from the
+//   start to the end orientation (sign chosen for the shorter arc), the
+//   orientation at s is q0 [sin(s phi) u, cos(s phi)] = cos(s phi) q0 +
+//   sin(s phi) q0 [u, 0]. u is arbitrary when there is no rotation.
+//========================================================================
+template<int n>
+void PoseTrajectory<n>::setSegment(int k)
+{
+ double duration = d_time[k + 1] - d_time[k];
+ d_rate[k] = (duration > 0) ? 1 / duration : 0;
+
+ d_delta[k] = d_position[k + 1] - d_position[k];
+
+ Quaternion<> r = conjugate(d_rotation[k]) * d_rotation[k + 1];
+ if(r.w() < 0)
+  r = Quaternion<>(-r.w(), -r.x(), -r.y(), -r.z());
+ double sn = sqrt(r.x() * r.x() + r.y() * r.y() + r.z() * r.z());
+ d_angle[k] = atan2(sn, r.w());
+ Quaternion<> u(0, 1, 0, 0);
+ if(sn > 0)
+  u = Quaternion<>(0, r.x() / sn, r.y() / sn, r.z() / sn);
+ d_normal[k] = d_rotation[k] * u;
+}
+
+
+//========================================================================
+// PoseTrajectory::setWaypoint
+//========================================================================
+template<int n>
+void PoseTrajectory<n>::setWaypoint(int i, double time, const Transform &pose)
+{
+ checkIndex(i);
+ const double *e = pose.Matrix<4, 4, double>::getElementsPointer(); // static call
+ d_time[i - 1] = time;
+ d_waypoint[i - 1] = pose;
+ d_rotation[i - 1] = Quaternion<>(pose);
+ d_position[i - 1] = Vec3<>(e[3], e[7], e[11]);
+ if(i > 1)
+  setSegment(i - 2);
+ if(i < n)
+  setSegment(i - 1);
+}
+
+
+//========================================================================
+// PoseTrajectory::getTime, PoseTrajectory::getWaypoint
+//========================================================================
+template<int n>
+double PoseTrajectory<n>::getTime(int i) const
+{
+ checkIndex(i);
+ return d_time[i - 1];
+}
+
+template<int n>
+Transform PoseTrajectory<n>::getWaypoint(int i) const
+{
+ checkIndex(i);
+ return d_waypoint[i - 1];
+}
+
+
+//========================================================================
+// PoseTrajectory::findSegment, PoseTrajectory::nextSegment
+//   The segment k that contains time t: the last one with t_k <= t, or
+//   the first one. findSegment() bisects, nextSegment() steps from a
+//   segment found for a nearby time.
+//========================================================================
+template<int n>
+int PoseTrajectory<n>::findSegment(double t) const
+{
+ int low = 0, high = n - 2;
+ while(low < high)
+ {
+  int mid = (low + high + 1) / 2;
+  if(d_time[mid] <= t)
+   low = mid;
+  else
+   high = mid - 1;
+ }
+ return low;
+}
+
+template<int n>
+int PoseTrajectory<n>::nextSegment(double t, int k) const
+{
+ while( (k < n - 2) && (d_time[k + 1] <= t) )
+  ++k;
+ while( (k > 0) && (d_time[k] > t) )
+  --k;
+ return k;
+}
+
+
+//========================================================================
+// PoseTrajectory::fraction
+//   The time scaling s(tau) of segment k at time t, with tau clamped to
+//   [0, 1].
+//========================================================================
+template<int n>
+double PoseTrajectory<n>::fraction(double t, int k) const
+{
+ double tau = (t - d_time[k]) * d_rate[k];
+ if( !(tau > 0) )                        // also when d_rate is 0
+  return 0;
+ if(tau >= 1)
+  return 1;
+ switch(d_scaling)
+ {
+  case QMathTimeScaling_cubic:
+   return tau * tau * (3 - 2 * tau);
+  case QMathTimeScaling_quintic:
+   return tau * tau * tau * (10 + tau * (-15 + 6 * tau));
+  default:
+   return tau;
+ }
+}
+
+
+//========================================================================
+// PoseTrajectory::setPose
+//   Writes the pose at fraction s of segment k into the elements e of a
+//   Transform, given c = cos(s phi) and sn = sin(s phi).
+//========================================================================
+template<int n>
+void PoseTrajectory<n>::setPose(int k, double s, double c, double sn, double *e) const
+{
+ typedef Simd4<double> S;
+ double q[4], p[4];
+ S::multiplyAdd(S::load(d_rotation[k].getElementsPointer()), S::broadcast(c),
+                S::load(d_normal[k].getElementsPointer()) * S::broadcast(sn)).store(q);
+ S::multiplyAdd(S::load(d_delta[k].getElementsPointer()), S::broadcast(s),
+                S::load(d_position[k].getElementsPointer())).store(p);
+
+ double x = q[0], y = q[1], z = q[2], w = q[3];
+ double x2 = x + x, y2 = y + y, z2 = z + z;
+ double xx = x * x2, yy = y * y2, zz = z * z2;
+ double xy = x * y2, xz = x * z2, yz = y * z2;
+ double wx = w * x2, wy = w * y2, wz = w * z2;
+ e[0] = 1 - yy - zz; e[1] = xy - wz;     e[2] = xz + wy;      e[3] = p[0];
+ e[4] = xy + wz;     e[5] = 1 - xx - zz; e[6] = yz - wx;      e[7] = p[1];
+ e[8] = xz - wy;     e[9] = yz + wx;     e[10] = 1 - xx - yy; e[11] = p[2];
+ e[12] = 0;          e[13] = 0;          e[14] = 0;           e[15] = 1;
+}
+
+
+//========================================================================
+// PoseTrajectory::getPose
+//========================================================================
+template<int n>
+Transform PoseTrajectory<n>::getPose(double t) const
+{
+ int k = findSegment(t);
+ double s = fraction(t, k);
+ double sn, c;
+ sinCos(s * d_angle[k], sn, c);
+ Transform pose;
+ setPose(k, s, c, sn, pose.Matrix<4, 4, double>::getElementsPointer());
+ return pose;
+}
+
+
+//========================================================================
+// PoseTrajectory::getPoses
+//========================================================================
+template<int n>
+void PoseTrajectory<n>::getPoses(double start, double step, Transform *pose, int count) const
+{
+ const int C = QMATH_BATCH_CHUNK;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int m = (count - i < C) ? (count - i) : C;
+  poses(0, start, step, i, pose + i, m);
+ }
+}
+
+template<int n>
+void PoseTrajectory<n>::getPoses(const double *time, Transform *pose, int count) const
+{
+ const int C = QMATH_BATCH_CHUNK;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int m = (count - i < C) ? (count - i) : C;
+  poses(time + i, 0, 0, 0, pose + i, m);
+ }
+}
+
+
+//========================================================================
+// PoseTrajectory::poses
+//   Up to QMATH_BATCH_CHUNK poses at the given times, or at start +
+//   (first + j) step when time is null. The segment of every sample is
+//   found by stepping from the segment of the previous one, then the
+//   sines and cosines of the whole block are computed at once.
+//========================================================================
+template<int n>
+void PoseTrajectory<n>::poses(const double *time, double start, double step, int first,
+                              Transform *pose, int count) const
+{
+ int segment[QMATH_BATCH_CHUNK];
+ double s[QMATH_BATCH_CHUNK], a[QMATH_BATCH_CHUNK];
+ double sn[QMATH_BATCH_CHUNK], c[QMATH_BATCH_CHUNK];
+ int j, k = findSegment(time ? time[0] : start + first * step);
+ for(j = 0; j < count; ++j)
+ {
+  double t = time ? time[j] : start + (first + j) * step;
+  k = nextSegment(t, k);
+  segment[j] = k;
+  s[j] = fraction(t, k);
+  a[j] = s[j] * d_angle[k];
+ }
+ elementSin(a, sn, count);
+ elementCos(a, c, count);
+ for(j = 0; j < count; ++j)
+  setPose(segment[j], s[j], c[j], sn[j], pose[j].Matrix<4, 4, double>::getElementsPointer());
+}
+
+#endif
@@ -0,0 +1,502 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Quaternion.hpp
+// Description          : Unit quaternions for rotations
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_Quaternion_hpp
+#define INCLUDED_Quaternion_hpp
+
+#include <iostream>
+#include <math.h>
+#include "Simd.hpp"
+#include "Vec3.hpp"
+#include "Transform.hpp"
+
+//====================================================================
+// class Quaternion
+// -------------------------------------------------------------------
+// \brief
+// A quaternion w + xi + yj + zk, used to represent rotations.
+//
+// A unit quaternion q = [cos(theta/2), sin(theta/2) u] represents a
+// rotation of theta radians about the unit vector u. Composing two
+// rotations is a Hamilton product (16 multiplications instead of 27 for
+// 3x3 matrices), renormalizing is a scaling of four elements, and two
+// orientations can be interpolated with slerp() or nlerp(). The
+// elements are stored as (x, y, z, w) so that the vector part lines up
+// with the elements of a \c Vec3, and every operation processes the
+// quaternion as one group of four SIMD lanes (see Simd.hpp). The class
+// has no virtual functions and nothing is allocated.
+//
+// The roll, pitch and yaw angles follow the same convention as
+// \c rpyRotation() and \c Transform::getRollPitchYaw(). Except for
+// normalize(), the functions assume unit quaternions and do not check.
+//
+// <b>Example Program:</b>
+// \include Quaternion.t.cpp
+//========================================================================
+
+template<class T = double>
+class QMATH_ALIGN16 Quaternion
+{
+ public:
+  inline Quaternion();
+   // The default constructor. The quaternion is initialized to the
+   // identity rotation [1, 0, 0, 0].
+
+  inline Quaternion(const T &w, const T &x, const T &y, const T &z);
+   // Constructs the quaternion w + xi + yj + zk.
+
+  inline Quaternion(const ColumnVector<3, T> &axis, const T &theta);
+   // Constructs a rotation of angle \a theta radians about the unit
+   // vector \a axis (same as \c vectorRotation()).
+
+  inline explicit Quaternion(const Matrix<3, 3, T> &rotation);
+  inline explicit Quaternion(const Matrix<4, 4, T> &transform);
+   // Conversion from a rotation matrix, or from the rotational part of
+   // a \c Transform. The matrix is assumed to be orthonormal.
+
+  inline Matrix<3, 3, T> toRotationMatrix() const;
+   //  return  The rotation as a 3x3 matrix.
+
+  inline TransformT<T> toTransform() const;
+   //  return  The rotation as a \c Transform with no translation.
+
+  inline void getRollPitchYaw(T &roll, T &pitch, T &yaw) const;
+   // The roll (z), pitch (y) and yaw (x) angles of the rotation. See
+   // \c Transform::getRollPitchYaw() for the convention and for the
+   // range of the solution.
+
+  inline T w() const { return d_element[3]; }
+  inline T x() const { return d_element[0]; }
+  inline T y() const { return d_element[1]; }
+  inline T z() const { return d_element[2]; }
+  inline T &w() { return d_element[3]; }
+  inline T &x() { return d_element[0]; }
+  inline T &y() { return d_element[1]; }
+  inline T &z() { return d_element[2]; }
+   // Access or assign the elements.
+
+  inline const T *getElementsPointer() const { return d_element; }
+  inline T *getElementsPointer() { return d_element; }
+   //  return  A pointer to the four elements, stored as (x, y, z, w).
+
+  inline T squaredNorm() const;
+   //  return  The sum of the squares of the elements.
+
+  inline T norm() const;
+   //  return  The 2-norm of the quaternion.
+
+  inline Quaternion<T> &normalize();
+   // Scales the quaternion to unit norm. Throws a divideByZero exception
+   // if the norm is less than NumericTraits<T>::epsilon().
+   //  return  Reference to this quaternion.
+
+ private:
+  inline void setRotation(const T *r, int stride);
+  T d_element[4];                                          // x, y, z, w
+};
+
+template<class T>
+inline Quaternion<T> rpyQuaternion(const T &roll, const T &pitch, const T &yaw);
+ //  return  The rotation of \c rpyRotation(roll, pitch, yaw) as a
+ //          quaternion.
+
+template<class T>
+inline Quaternion<T> operator*(const Quaternion<T> &p, const Quaternion<T> &q);
+ //  return  The Hamilton product p q, the rotation q followed by p.
+
+template<class T>
+inline Quaternion<T> conjugate(const Quaternion<T> &q);
+ //  return  The conjugate of q, which is also the inverse rotation.
+
+template<class T>
+inline T dotProduct(const Quaternion<T> &p, const Quaternion<T> &q);
+ //  return  The dot product of p and q as four-vectors.
+
+template<class T>
+inline Vec3<T> rotate(const Quaternion<T> &q, const Vec3<T> &v);
+template<class T>
+inline ColumnVector<3, T> rotate(const Quaternion<T> &q, const ColumnVector<3, T> &v);
+ //  return  The vector v rotated by q.
+
+template<class T>
+inline Quaternion<T> nlerp(const Quaternion<T> &p, const Quaternion<T> &q, const T &t);
+ //  return  The normalized linear interpolation from p (t = 0) to
+ //          q (t = 1) along the shorter arc. Cheaper than slerp(), but
+ //          the angular velocity is not constant.
+
+template<class T>
+inline Quaternion<T> slerp(const Quaternion<T> &p, const Quaternion<T> &q, const T &t);
+ //  return  The spherical linear interpolation from p (t = 0) to
+ //          q (t = 1) along the shorter arc, at constant angular
+ //          velocity.
+
+template<class T>
+std::ostream &operator<<(std::ostream &out, const Quaternion<T> &q);
+ // Writes the elements in the order w x y z.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// Quaternion::Quaternion
+//========================================================================
+template<class T>
+Quaternion<T>::Quaternion()
+{
+ d_element[0] = 0;
+ d_element[1] = 0;
+ d_element[2] = 0;
+ d_element[3] = 1;
+}
+
+template<class T>
+Quaternion<T>::Quaternion(const T &w, const T &x, const T &y, const T &z)
+{
+ d_element[0] = x;
+ d_element[1] = y;
+ d_element[2] = z;
+ d_element[3] = w;
+}
+
+template<class T>
+Quaternion<T>::Quaternion(const ColumnVector<3, T> &axis, const T &theta)
+{
+ const T *u = axis.Matrix<3, 1, T>::getElementsPointer(); // static call
+ T s = sin(theta / 2);
+ d_element[0] = s * u[0];
+ d_element[1] = s * u[1];
+ d_element[2] = s * u[2];
+ d_element[3] = cos(theta / 2);
+}
+
+template<class T>
+Quaternion<T>::Quaternion(const Matrix<3, 3, T> &rotation)
+{
+ setRotation(rotation.Matrix<3, 3, T>::getElementsPointer(), 3);
+}
+
+template<class T>
+Quaternion<T>::Quaternion(const Matrix<4, 4, T> &transform)
+{
+ setRotation(transform.Matrix<4, 4, T>::getElementsPointer(), 4);
+}
+
+
+//========================================================================
+// Quaternion::setRotation
+//   Shepperd's method: the square root is taken of the largest of
+//   4w^2, 4x^2, 4y^2 and 4z^2, which keeps the division well
+//   conditioned for every rotation.
+//========================================================================
+template<class T>
+void Quaternion<T>::setRotation(const T *r, int stride)
+{
+ T r11 = r[0], r12 = r[1], r13 = r[2];
+ T r21 = r[stride], r22 = r[stride + 1], r23 = r[stride + 2];
+ T r31 = r[2 * stride], r32 = r[2 * stride + 1], r33 = r[2 * stride + 2];
+ T trace = r11 + r22 + r33;
+ T s;
+ if(trace > 0)
+ {
+  s = 2 * sqrt(1 + trace);
+  d_element[3] = s / 4;
+  d_element[0] = (r32 - r23) / s;
+  d_element[1] = (r13 - r31) / s;
+  d_element[2] = (r21 - r12) / s;
+ }
+ else if(r11 > r22 && r11 > r33)
+ {
+  s = 2 * sqrt(1 + r11 - r22 - r33);
+  d_element[3] = (r32 - r23) / s;
+  d_element[0] = s / 4;
+  d_element[1] = (r12 + r21) / s;
+  d_element[2] = (r13 + r31) / s;
+ }
+ else if(r22 > r33)
+ {
+  s = 2 * sqrt(1 + r22 - r11 - r33);
+  d_element[3] = (r13 - r31) / s;
+  d_element[0] = (r12 + r21) / s;
+  d_element[1] = s / 4;
+  d_element[2] = (r23 + r32) / s;
+ }
+ else
+ {
+  s = 2 * sqrt(1 + r33 - r11 - r22);
+  d_element[3] = (r21 - r12) / s;
+  d_element[0] = (r13 + r31) / s;
+  d_element[1] = (r23 + r32) / s;
+  d_element[2] = s / 4;
+ }
+}
+
+
+//========================================================================
+// Quaternion::toRotationMatrix, Quaternion::toTransform
+//========================================================================
+template<class T>
+Matrix<3, 3, T> Quaternion<T>::toRotationMatrix() const
+{
+ T x = d_element[0], y = d_element[1], z = d_element[2], w = d_element[3];
+ Matrix<3, 3, T> r;
+ T *e = r.Matrix<3, 3, T>::getElementsPointer();
+ e[0] = 1 - 2 * (y * y + z * z);
+ e[1] = 2 * (x * y - w * z);
+ e[2] = 2 * (x * z + w * y);
+ e[3] = 2 * (x * y + w * z);
+ e[4] = 1 - 2 * (x * x + z * z);
+ e[5] = 2 * (y * z - w * x);
+ e[6] = 2 * (x * z - w * y);
+ e[7] = 2 * (y * z + w * x);
+ e[8] = 1 - 2 * (x * x + y * y);
+ return r;
+}
+
+template<class T>
+TransformT<T> Quaternion<T>::toTransform() const
+{
+ Matrix<3, 3, T> r = toRotationMatrix();
+ const T *e = r.Matrix<3, 3, T>::getElementsPointer();
+ TransformT<T> t;
+ T *f = t.Matrix<4, 4, T>::getElementsPointer();
+ for(int i = 0; i < 3; ++i)
+ {
+  f[i * 4] = e[i * 3];
+  f[i * 4 + 1] = e[i * 3 + 1];
+  f[i * 4 + 2] = e[i * 3 + 2];
+ }
+ return t;
+}
+
+
+//========================================================================
+// Quaternion::getRollPitchYaw
+//   Same as Transform::getRollPitchYaw, on the matrix elements that the
+//   angles need.
+//========================================================================
+template<class T>
+void Quaternion<T>::getRollPitchYaw(T &roll, T &pitch, T &yaw) const
+{
+ T x = d_element[0], y = d_element[1], z = d_element[2], w = d_element[3];
+ T r31 = 2 * (x * z - w * y);
+ if(r31 > 1) r31 = 1;
+ if(r31 < -1) r31 = -1;
+ pitch = -asin(r31);
+ T cp = cos(pitch);
+ if(cp > NumericTraits<T>::epsilon())
+ {
+  yaw = atan2(2 * (y * z + w * x), 1 - 2 * (x * x + y * y));  // R32/R33
+  roll = atan2(2 * (x * y + w * z), 1 - 2 * (y * y + z * z)); // R21/R11
+ }
+ else // gimbal lock
+ {
+  roll = 0;
+  yaw = atan2(2 * (x * y - w * z), 2 * (x * z + w * y));      // R12/R13
+ }
+}
+
+
+//========================================================================
+// Quaternion::squaredNorm, Quaternion::norm, Quaternion::normalize
+//========================================================================
+template<class T>
+T Quaternion<T>::squaredNorm() const
+{
+ Simd4<T> v = Simd4<T>::load(d_element);
+ return (v * v).sum();
+}
+
+template<class T>
+T Quaternion<T>::norm() const
+{
+ return sqrt(squaredNorm());
+}
+
+template<class T>
+Quaternion<T> &Quaternion<T>::normalize()
+{
+ Simd4<T> v = Simd4<T>::load(d_element);
+ T n = sqrt((v * v).sum());
+ if(n < NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ (v * Simd4<T>::broadcast((T)1 / n)).store(d_element);
+ return *this;
+}
+
+
+//========================================================================
+// rpyQuaternion
+//   The product z(roll) y(pitch) x(yaw) of the three elementary
+//   rotations, expanded.
+//========================================================================
+template<class T>
+Quaternion<T> rpyQuaternion(const T &roll, const T &pitch, const T &yaw)
+{
+ T cr = cos(roll / 2), sr = sin(roll / 2);
+ T cp = cos(pitch / 2), sp = sin(pitch / 2);
+ T cy = cos(yaw / 2), sy = sin(yaw / 2);
+ return Quaternion<T>(cr * cp * cy + sr * sp * sy,
+                      cr * cp * sy - sr * sp * cy,
+                      cr * sp * cy + sr * cp * sy,
+                      sr * cp * cy - cr * sp * sy);
+}
+
+
+//========================================================================
+// operator* (Quaternion, Quaternion)
+//   With p = (x1, y1, z1, w1) and q = (x2, y2, z2, w2), the product is
+//     w1 q
+//   + [(x1, y1, z1, x1) (w2, w2, w2, x2) + (y1, z1, x1, y1) (z2, x2, y2, y2)]
+//     (1, 1, 1, -1)
+//   - (z1, x1, y1, z1) (y2, z2, x2, z2)
+//========================================================================
+template<class T>
+Quaternion<T> operator*(const Quaternion<T> &p, const Quaternion<T> &q)
+{
+ typedef Simd4<T> S;
+ S a = S::load(p.getElementsPointer());
+ S b = S::load(q.getElementsPointer());
+ Quaternion<T> r;
+ (a.template permute<3, 3, 3, 3>() * b
+  + (a.template permute<0, 1, 2, 0>() * b.template permute<3, 3, 3, 0>()
+     + a.template permute<1, 2, 0, 1>() * b.template permute<2, 0, 1, 1>()) * S::set(1, 1, 1, -1)
+  - a.template permute<2, 0, 1, 2>() * b.template permute<1, 2, 0, 2>())
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// conjugate, dotProduct
+//========================================================================
+template<class T>
+Quaternion<T> conjugate(const Quaternion<T> &q)
+{
+ Quaternion<T> r;
+ (Simd4<T>::load(q.getElementsPointer()) * Simd4<T>::set(-1, -1, -1, 1))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+T dotProduct(const Quaternion<T> &p, const Quaternion<T> &q)
+{
+ return (Simd4<T>::load(p.getElementsPointer()) * Simd4<T>::load(q.getElementsPointer())).sum();
+}
+
+
+//========================================================================
+// rotate
+//   With u the vector part of q: t = 2 u x v, then v + w t + u x t.
+//   Cross products as in crossProduct(Vec3, Vec3); the fourth lane of
+//   every intermediate stays zero.
+//========================================================================
+template<class T>
+Vec3<T> rotate(const Quaternion<T> &q, const Vec3<T> &v)
+{
+ typedef Simd4<T> S;
+ S a = S::load(q.getElementsPointer());
+ S u = a * S::set(1, 1, 1, 0);
+ S w = a.template permute<3, 3, 3, 3>();
+ S b = S::load(v.getElementsPointer());
+ S t = (u * b.rotate() - u.rotate() * b).rotate();
+ t = t + t;
+ Vec3<T> r;
+ (b + w * t + (u * t.rotate() - u.rotate() * t).rotate()).store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+ColumnVector<3, T> rotate(const Quaternion<T> &q, const ColumnVector<3, T> &v)
+{
+ return rotate(q, Vec3<T>(v)).toColumnVector();
+}
+
+
+//========================================================================
+// nlerp
+//========================================================================
+template<class T>
+Quaternion<T> nlerp(const Quaternion<T> &p, const Quaternion<T> &q, const T &t)
+{
+ typedef Simd4<T> S;
+ S a = S::load(p.getElementsPointer());
+ S b = S::load(q.getElementsPointer());
+ T s = (a * b).sum() < 0 ? -t : t;                     // shorter arc
+ Quaternion<T> r;
+ (a * S::broadcast(1 - t) + b * S::broadcast(s)).store(r.getElementsPointer());
+ return r.normalize();
+}
+
+
+//========================================================================
+// slerp
+//   The angle between p and q as four-vectors is computed as
+//   2 atan2(|p - q|, |p + q|), which unlike acos(p.q) stays accurate
+//   when p and q are close. Falls back to linear interpolation when the
+//   angle is too small to divide by its sine.
+//========================================================================
+template<class T>
+Quaternion<T> slerp(const Quaternion<T> &p, const Quaternion<T> &q, const T &t)
+{
+ typedef Simd4<T> S;
+ S a = S::load(p.getElementsPointer());
+ S b = S::load(q.getElementsPointer());
+ if((a * b).sum() < 0)                                 // shorter arc
+  b = S::broadcast(0) - b;
+ S d = a - b, e = a + b;
+ T theta = 2 * atan2(sqrt((d * d).sum()), sqrt((e * e).sum()));
+ T st = sin(theta);
+ T ca, cb;
+ if(st < NumericTraits<T>::epsilon())
+ {
+  ca = 1 - t;
+  cb = t;
+ }
+ else
+ {
+  ca = sin((1 - t) * theta) / st;
+  cb = sin(t * theta) / st;
+ }
+ Quaternion<T> r;
+ (a * S::broadcast(ca) + b * S::broadcast(cb)).store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// operator<<
+//========================================================================
+template<class T>
+std::ostream &operator<<(std::ostream &out, const Quaternion<T> &q)
+{
+ out << q.w() << " " << q.x() << " " << q.y() << " " << q.z();
+ return out;
+}
+
+
+#endif
@@ -0,0 +1,316 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : RigidTransform.hpp
+// Description          : Compact 3x4 rigid body transformation
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_RigidTransform_hpp
+#define INCLUDED_RigidTransform_hpp
+
+#include <iostream>
+#include "Simd.hpp"
+#include "Vec3.hpp"
+#include "Transform.hpp"
+
+//====================================================================
+// class RigidTransform
+// -------------------------------------------------------------------
+// \brief
+// A rotation followed by a translation, stored as the top three rows
+// of a homogeneous transformation matrix:
+// \code
+//	[r11 r12 r13 p1]
+//	[r21 r22 r23 p2]
+//	[r31 r32 r33 p3]
+//	[ 0   0   0   1]  (implied, not stored)
+// \endcode
+// Since the bottom row is known, the product of two transforms takes
+// 36 multiplications instead of the 64 of a 4x4 matrix product, and the
+// inverse is the closed form [R' -R'p]. Each row of four elements is
+// processed as one group of SIMD lanes (see Simd.hpp). The class has
+// no virtual functions and element access is not range checked.
+//
+// The conversions to and from \c Transform copy the twelve elements
+// unchanged, so that a round trip is exact. The rotation part is
+// assumed to be orthonormal; it is neither checked nor corrected.
+//
+// <b>Example Program:</b>
+// \include RigidTransform.t.cpp
+//========================================================================
+
+template<class T = double>
+class QMATH_ALIGN16 RigidTransform
+{
+ public:
+  inline RigidTransform();
+   // The default constructor. The transform is initialized to the
+   // identity (no rotation and no translation).
+
+  inline RigidTransform(const Matrix<3, 3, T> &rotation, const ColumnVector<3, T> &translation);
+   // Constructs the transform [rotation translation].
+
+  inline explicit RigidTransform(const Matrix<4, 4, T> &m);
+   // Conversion from a 4x4 homogeneous transformation matrix, such as a
+   // \c Transform. The bottom row of \a m is assumed to be [0 0 0 1]
+   // and is not read.
+
+  inline TransformT<T> toTransform() const;
+   //  return  The transform as a 4x4 homogeneous transformation matrix.
+
+  inline T operator()(int r, int c) const { return d_element[(r - 1) * 4 + c - 1]; }
+  inline T &operator()(int r, int c) { return d_element[(r - 1) * 4 + c - 1]; }
+   // Access or assign the element at row r (1 to 3) and column c
+   // (1 to 4). Neither is checked.
+
+  inline const T *getElementsPointer() const { return d_element; }
+  inline T *getElementsPointer() { return d_element; }
+   //  return  A pointer to the twelve elements, stored row by row.
+
+  inline Matrix<3, 3, T> getRotation() const;
+   //  return  The rotation matrix (first three columns).
+
+  inline ColumnVector<3, T> getTranslation() const;
+   //  return  The position vector (last column).
+
+  inline void setRotation(const Matrix<3, 3, T> &rotation);
+  inline void setTranslation(const ColumnVector<3, T> &translation);
+   // Set the rotation matrix or the position vector.
+
+ private:
+  T d_element[12];
+};
+
+template<class T>
+inline RigidTransform<T> operator*(const RigidTransform<T> &a, const RigidTransform<T> &b);
+ //  return  The composition a * b (b applied first): 36 multiplications.
+
+template<class T>
+inline RigidTransform<T> inverse(const RigidTransform<T> &t);
+ //  return  The inverse of t, computed in closed form.
+
+template<class T>
+inline ColumnVector<3, T> operator*(const RigidTransform<T> &t, const ColumnVector<3, T> &p);
+template<class T>
+inline Vec3<T> operator*(const RigidTransform<T> &t, const Vec3<T> &p);
+ //  return  The point p transformed by t, R p + translation.
+
+template<class T>
+inline Vec3<T> rotate(const RigidTransform<T> &t, const Vec3<T> &v);
+ //  return  The direction v rotated by t, R v.
+
+template<class T>
+std::ostream &operator<<(std::ostream &out, const RigidTransform<T> &t);
+ // Writes the three rows, one per line.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// RigidTransform::RigidTransform
+//========================================================================
+template<class T>
+RigidTransform<T>::RigidTransform()
+{
+ for(int i = 0; i < 12; ++i)
+  d_element[i] = 0;
+ d_element[0] = 1;
+ d_element[5] = 1;
+ d_element[10] = 1;
+}
+
+template<class T>
+RigidTransform<T>::RigidTransform(const Matrix<3, 3, T> &rotation,
+                                  const ColumnVector<3, T> &translation)
+{
+ setRotation(rotation);
+ setTranslation(translation);
+}
+
+template<class T>
+RigidTransform<T>::RigidTransform(const Matrix<4, 4, T> &m)
+{
+ const T *e = m.Matrix<4, 4, T>::getElementsPointer(); // static call
+ for(int i = 0; i < 12; ++i)
+  d_element[i] = e[i];
+}
+
+
+//========================================================================
+// RigidTransform::toTransform
+//========================================================================
+template<class T>
+TransformT<T> RigidTransform<T>::toTransform() const
+{
+ TransformT<T> t;
+ T *e = t.Matrix<4, 4, T>::getElementsPointer();
+ for(int i = 0; i < 12; ++i)
+  e[i] = d_element[i];
+ return t;
+}
+
+
+//========================================================================
+// RigidTransform::getRotation, RigidTransform::getTranslation
+//========================================================================
+template<class T>
+Matrix<3, 3, T> RigidTransform<T>::getRotation() const
+{
+ Matrix<3, 3, T> r;
+ T *e = r.Matrix<3, 3, T>::getElementsPointer();
+ for(int i = 0; i < 3; ++i)
+ {
+  e[i * 3] = d_element[i * 4];
+  e[i * 3 + 1] = d_element[i * 4 + 1];
+  e[i * 3 + 2] = d_element[i * 4 + 2];
+ }
+ return r;
+}
+
+template<class T>
+ColumnVector<3, T> RigidTransform<T>::getTranslation() const
+{
+ ColumnVector<3, T> p;
+ T *e = p.Matrix<3, 1, T>::getElementsPointer();
+ e[0] = d_element[3];
+ e[1] = d_element[7];
+ e[2] = d_element[11];
+ return p;
+}
+
+
+//========================================================================
+// RigidTransform::setRotation, RigidTransform::setTranslation
+//========================================================================
+template<class T>
+void RigidTransform<T>::setRotation(const Matrix<3, 3, T> &rotation)
+{
+ const T *e = rotation.Matrix<3, 3, T>::getElementsPointer();
+ for(int i = 0; i < 3; ++i)
+ {
+  d_element[i * 4] = e[i * 3];
+  d_element[i * 4 + 1] = e[i * 3 + 1];
+  d_element[i * 4 + 2] = e[i * 3 + 2];
+ }
+}
+
+template<class T>
+void RigidTransform<T>::setTranslation(const ColumnVector<3, T> &translation)
+{
+ const T *e = translation.Matrix<3, 1, T>::getElementsPointer();
+ d_element[3] = e[0];
+ d_element[7] = e[1];
+ d_element[11] = e[2];
+}
+
+
+//========================================================================
+// operator* (RigidTransform, RigidTransform)
+//   Row i of a * b is a(i,1) b1 + a(i,2) b2 + a(i,3) b3 + [0 0 0 a(i,4)],
+//   where b1, b2 and b3 are the rows of b: 3 x 3 products of four lanes.
+//========================================================================
+template<class T>
+RigidTransform<T> operator*(const RigidTransform<T> &a, const RigidTransform<T> &b)
+{
+ typedef Simd4<T> S;
+ const T *x = a.getElementsPointer();
+ const T *y = b.getElementsPointer();
+ S b1 = S::load(y), b2 = S::load(y + 4), b3 = S::load(y + 8);
+ RigidTransform<T> r;
+ T *z = r.getElementsPointer();
+ for(int i = 0; i < 3; ++i, x += 4, z += 4)
+  (S::broadcast(x[0]) * b1 + S::broadcast(x[1]) * b2 + S::broadcast(x[2]) * b3
+   + S::set(0, 0, 0, x[3])).store(z);
+ return r;
+}
+
+
+//========================================================================
+// inverse
+//========================================================================
+template<class T>
+RigidTransform<T> inverse(const RigidTransform<T> &t)
+{
+ const T *e = t.getElementsPointer();
+ RigidTransform<T> r;
+ T *f = r.getElementsPointer();
+ for(int i = 0; i < 3; ++i)
+ {
+  f[i * 4] = e[i];
+  f[i * 4 + 1] = e[4 + i];
+  f[i * 4 + 2] = e[8 + i];
+  f[i * 4 + 3] = -(e[i] * e[3] + e[4 + i] * e[7] + e[8 + i] * e[11]);
+ }
+ return r;
+}
+
+
+//========================================================================
+// operator* (RigidTransform, point), rotate
+//========================================================================
+template<class T>
+ColumnVector<3, T> operator*(const RigidTransform<T> &t, const ColumnVector<3, T> &p)
+{
+ const T *e = t.getElementsPointer();
+ const T *v = p.Matrix<3, 1, T>::getElementsPointer();
+ ColumnVector<3, T> r;
+ T *f = r.Matrix<3, 1, T>::getElementsPointer();
+ for(int i = 0; i < 3; ++i, e += 4)
+  f[i] = e[0] * v[0] + e[1] * v[1] + e[2] * v[2] + e[3];
+ return r;
+}
+
+template<class T>
+Vec3<T> operator*(const RigidTransform<T> &t, const Vec3<T> &p)
+{
+ typedef Simd4<T> S;
+ const T *e = t.getElementsPointer();
+ S h = S::load(p.getElementsPointer()) + S::set(0, 0, 0, 1);   // (x, y, z, 1)
+ Vec3<T> r;
+ S::sums(S::load(e) * h, S::load(e + 4) * h, S::load(e + 8) * h, S::broadcast(0))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec3<T> rotate(const RigidTransform<T> &t, const Vec3<T> &v)
+{
+ typedef Simd4<T> S;
+ const T *e = t.getElementsPointer();
+ S h = S::load(v.getElementsPointer());                         // (x, y, z, 0)
+ Vec3<T> r;
+ S::sums(S::load(e) * h, S::load(e + 4) * h, S::load(e + 8) * h, S::broadcast(0))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// operator<<
+//========================================================================
+template<class T>
+std::ostream &operator<<(std::ostream &out, const RigidTransform<T> &t)
+{
+ for(int r = 1; r <= 3; ++r)
+  out << t(r, 1) << " " << t(r, 2) << " " << t(r, 3) << " " << t(r, 4) << std::endl;
+ return out;
+}
+
+
+#endif
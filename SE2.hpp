@@ -0,0 +1,469 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SE2.hpp
+// Description          : Planar rigid body transformation
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_SE2_hpp
+#define INCLUDED_SE2_hpp
+
+#include <math.h>
+#include <iostream>
+#include "Simd.hpp"
+#include "FastMath.hpp"
+#include "VectorBatch.hpp"
+#include "Transform.hpp"
+
+//====================================================================
+// class SE2
+// -------------------------------------------------------------------
+// \brief
+// A rotation by an angle theta in the plane followed by a translation
+// (x, y), such as the pose of a mobile base. The transform is stored as
+// the four numbers (cos(theta), sin(theta), x, y), which are the
+// elements r11, r21, p1 and p2 of the homogeneous transformation matrix
+// \code
+//	[c -s  0  x]
+//	[s  c  0  y]
+//	[0  0  1  0]
+//	[0  0  0  1]
+// \endcode
+// The product of two transforms takes 8 multiplications instead of the
+// 64 of a 4x4 matrix product, and is computed as one group of four
+// SIMD lanes (see Simd.hpp). The class has no virtual functions.
+//
+// The exponential and logarithm maps relate a transform to the twist
+// [vx; vy; omega], the linear velocities followed by the angular
+// velocity held for unit time, in the order used by LieGroup.hpp.
+// Near omega = 0 they use Taylor series, so that both are accurate to
+// rounding for all angles.
+//
+// Repeated products let (cos, sin) drift from unit length by a few
+// units of rounding per product; call normalize() from time to time
+// when integrating odometry over long runs. The conversion from a
+// \c Transform assumes a rotation about the z axis; the other elements
+// are not read.
+//
+// <b>Example Program:</b>
+// \include SE2.t.cpp
+//========================================================================
+
+template<class T = double>
+class QMATH_ALIGN16 SE2
+{
+ public:
+  inline SE2();
+   // The default constructor. The transform is initialized to the
+   // identity (no rotation and no translation).
+
+  inline SE2(const T &x, const T &y, const T &theta);
+   // Constructs the rotation by theta (radians) followed by the
+   // translation (x, y).
+
+  inline explicit SE2(const Matrix<4, 4, T> &m);
+   // Conversion from a 4x4 homogeneous transformation matrix, such as a
+   // \c Transform, whose rotation is about the z axis.
+
+  inline TransformT<T> toTransform() const;
+   //  return  The transform as a 4x4 homogeneous transformation matrix.
+
+  inline T x() const { return d_element[2]; }
+  inline T y() const { return d_element[3]; }
+   //  return  The translation.
+
+  inline T cosine() const { return d_element[0]; }
+  inline T sine() const { return d_element[1]; }
+   //  return  The cosine and the sine of the rotation angle.
+
+  inline T angle() const;
+   //  return  The rotation angle from -pi to pi.
+
+  inline const T *getElementsPointer() const { return d_element; }
+  inline T *getElementsPointer() { return d_element; }
+   //  return  A pointer to the four elements (cos, sin, x, y).
+
+  inline SE2<T> &normalize();
+   // Scales (cos, sin) back to unit length.
+   //  return  A reference to this transform.
+
+ private:
+  T d_element[4];
+};
+
+template<class T>
+inline SE2<T> operator*(const SE2<T> &a, const SE2<T> &b);
+ //  return  The composition a * b (b applied first): 8 multiplications.
+
+template<class T>
+inline SE2<T> inverse(const SE2<T> &t);
+ //  return  The inverse of t, computed in closed form.
+
+template<class T>
+inline ColumnVector<2, T> operator*(const SE2<T> &t, const ColumnVector<2, T> &p);
+ //  return  The point p transformed by t.
+
+template<class T>
+inline SE2<T> expSE2(const ColumnVector<3, T> &xi);
+ //  return  The transform reached by following the twist
+ //          xi = [vx; vy; omega] for unit time.
+
+template<class T>
+inline ColumnVector<3, T> logSE2(const SE2<T> &t);
+ //  return  The twist [vx; vy; omega] with omega from -pi to pi such
+ //          that expSE2() of it is t.
+
+template<class T>
+void transformPoints(const SE2<T> &t, const T *x, const T *y, T *tx, T *ty, int count);
+ // Computes (tx[i], ty[i]) = t (x[i], y[i]) for i = 0 to count - 1,
+ // four points at a time with SIMD instructions.
+
+template<class T>
+void transformPoints(const SE2<T> &t, const T *xy, T *txy, int count);
+ // As above, for count points interleaved as x0 y0 x1 y1 ..., two
+ // points at a time.
+ //
+ // As with the functions of PointBatch.hpp, the arrays are split into
+ // chunks of QMATH_BATCH_CHUNK points distributed across processor
+ // cores with OpenMP, and the results may be written over the input but
+ // must not otherwise overlap it.
+
+template<class T>
+std::ostream &operator<<(std::ostream &out, const SE2<T> &t);
+ // Writes x, y and the rotation angle on one line.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// SE2::SE2
+//========================================================================
+template<class T>
+SE2<T>::SE2()
+{
+ d_element[0] = 1;
+ d_element[1] = 0;
+ d_element[2] = 0;
+ d_element[3] = 0;
+}
+
+template<class T>
+SE2<T>::SE2(const T &x, const T &y, const T &theta)
+{
+ sinCos(theta, d_element[1], d_element[0]);
+ d_element[2] = x;
+ d_element[3] = y;
+}
+
+template<class T>
+SE2<T>::SE2(const Matrix<4, 4, T> &m)
+{
+ const T *e = m.Matrix<4, 4, T>::getElementsPointer(); // static call
+ d_element[0] = e[0];
+ d_element[1] = e[4];
+ d_element[2] = e[3];
+ d_element[3] = e[7];
+}
+
+
+//========================================================================
+// SE2::toTransform
+//========================================================================
+template<class T>
+TransformT<T> SE2<T>::toTransform() const
+{
+ TransformT<T> t;
+ T *e = t.Matrix<4, 4, T>::getElementsPointer();
+ e[0] = d_element[0];
+ e[1] = -d_element[1];
+ e[3] = d_element[2];
+ e[4] = d_element[1];
+ e[5] = d_element[0];
+ e[7] = d_element[3];
+ return t;
+}
+
+
+//========================================================================
+// SE2::angle, SE2::normalize
+//========================================================================
+template<class T>
+T SE2<T>::angle() const
+{
+ return atan2(d_element[1], d_element[0]);
+}
+
+template<class T>
+SE2<T> &SE2<T>::normalize()
+{
+ T k = 1 / sqrt(d_element[0] * d_element[0] + d_element[1] * d_element[1]);
+ d_element[0] *= k;
+ d_element[1] *= k;
+ return *this;
+}
+
+
+//========================================================================
+// operator* (SE2, SE2)
+//   a * b = ca (cb, sb, xb, yb) + sa (-sb, cb, -yb, xb) + (0, 0, xa, ya):
+//   the rotation and the translation of b are both rotated by a.
+//========================================================================
+template<class T>
+SE2<T> operator*(const SE2<T> &a, const SE2<T> &b)
+{
+ typedef Simd4<T> S;
+ const T *e = a.getElementsPointer();
+ S f = S::load(b.getElementsPointer());
+ SE2<T> r;
+ S::multiplyAdd(S::set(-e[1], e[1], -e[1], e[1]), f.template permute<1, 0, 3, 2>(),
+                S::multiplyAdd(S::broadcast(e[0]), f, S::set(0, 0, e[2], e[3])))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// inverse
+//========================================================================
+template<class T>
+SE2<T> inverse(const SE2<T> &t)
+{
+ const T *e = t.getElementsPointer();
+ SE2<T> r;
+ T *f = r.getElementsPointer();
+ f[0] = e[0];
+ f[1] = -e[1];
+ f[2] = -(e[0] * e[2] + e[1] * e[3]);
+ f[3] = e[1] * e[2] - e[0] * e[3];
+ return r;
+}
+
+
+//========================================================================
+// operator* (SE2, point)
+//========================================================================
+template<class T>
+ColumnVector<2, T> operator*(const SE2<T> &t, const ColumnVector<2, T> &p)
+{
+ const T *e = t.getElementsPointer();
+ const T *v = p.Matrix<2, 1, T>::getElementsPointer(); // static calls
+ ColumnVector<2, T> r;
+ T *f = r.Matrix<2, 1, T>::getElementsPointer();
+ f[0] = e[0] * v[0] - e[1] * v[1] + e[2];
+ f[1] = e[1] * v[0] + e[0] * v[1] + e[3];
+ return r;
+}
+
+
+//========================================================================
+// expSE2
+//   With u = omega/2 and h = sin(u)/u, the rotation is
+//   (1 - 2 sin^2 u, 2 sin u cos u) and the translation is V [vx; vy],
+//   V = [a -b; b a] with a = sin(omega)/omega = h cos u and
+//   b = (1 - cos(omega))/omega = h sin u. Below omega^2 = 1e-4, h is its
+//   Taylor series, whose first neglected term is below 1e-17.
+//========================================================================
+template<class T>
+SE2<T> expSE2(const ColumnVector<3, T> &xi)
+{
+ const T *v = xi.Matrix<3, 1, T>::getElementsPointer(); // static call
+ T u = v[2] / 2, s, c, h, t2 = v[2] * v[2];
+ sinCos(u, s, c);
+ if(t2 < (T)1e-4)
+  h = 1 - t2 / 24 * (1 - t2 / 80);
+ else
+  h = s / u;
+ T a = h * c, b = h * s;
+ SE2<T> r;
+ T *e = r.getElementsPointer();
+ e[0] = 1 - 2 * s * s;
+ e[1] = 2 * s * c;
+ e[2] = a * v[0] - b * v[1];
+ e[3] = b * v[0] + a * v[1];
+ return r;
+}
+
+
+//========================================================================
+// logSE2
+//   V^-1 = [g u; -u g] with u = omega/2 and g = u cot(u), where
+//   cot(u) = (1 + cos(omega))/sin(omega) = sin(omega)/(1 - cos(omega)):
+//   the first form is used for cos(omega) >= 0 and the second otherwise,
+//   so that neither subtracts nearly equal numbers. Below omega^2 = 1e-4,
+//   g is its Taylor series.
+//========================================================================
+template<class T>
+ColumnVector<3, T> logSE2(const SE2<T> &t)
+{
+ const T *e = t.getElementsPointer();
+ T omega = atan2(e[1], e[0]), u = omega / 2, t2 = omega * omega, g;
+ if(t2 < (T)1e-4)
+  g = 1 - t2 / 12 * (1 + t2 / 60);
+ else if(e[0] >= 0)
+  g = u * (1 + e[0]) / e[1];
+ else
+  g = u * e[1] / (1 - e[0]);
+ ColumnVector<3, T> r;
+ T *f = r.Matrix<3, 1, T>::getElementsPointer(); // static call
+ f[0] = g * e[2] + u * e[3];
+ f[1] = g * e[3] - u * e[2];
+ f[2] = omega;
+ return r;
+}
+
+
+//========================================================================
+// BatchPoint2
+//   Internal. Single threaded kernels for transformPoints(), working on
+//   n points. The last incomplete group of SIMD lanes is computed from
+//   zero-padded copies, as in BatchPoint3, so that every point is
+//   computed with the same rounding.
+//========================================================================
+template<class T>
+class BatchPoint2
+{
+ public:
+  enum { C = QMATH_BATCH_CHUNK };
+
+  static void transform(const T *m, const T *x, const T *y, T *tx, T *ty, int n);
+  static void transform(const T *m, const T *xy, T *txy, int n);
+};
+
+
+//========================================================================
+// BatchPoint2::transform (component arrays)
+//========================================================================
+template<class T>
+void BatchPoint2<T>::transform(const T *m, const T *x, const T *y, T *tx, T *ty, int n)
+{
+ typedef Simd4<T> S;
+ S c = S::broadcast(m[0]), s = S::broadcast(m[1]), ns = S::broadcast(-m[1]);
+ S d1 = S::broadcast(m[2]), d2 = S::broadcast(m[3]);
+ int i;
+ for(i = 0; i + 4 <= n; i += 4)
+ {
+  S px = S::load(x + i), py = S::load(y + i);
+  S::multiplyAdd(ns, py, S::multiplyAdd(c, px, d1)).store(tx + i);
+  S::multiplyAdd(c, py, S::multiplyAdd(s, px, d2)).store(ty + i);
+ }
+ if(i < n)
+ {
+  T t[4][4];
+  int j, k = n - i;
+  for(j = 0; j < 4; ++j)
+  {
+   t[0][j] = (j < k) ? x[i + j] : 0;
+   t[1][j] = (j < k) ? y[i + j] : 0;
+  }
+  transform(m, t[0], t[1], t[2], t[3], 4);
+  for(j = 0; j < k; ++j)
+  {
+   tx[i + j] = t[2][j];
+   ty[i + j] = t[3][j];
+  }
+ }
+}
+
+
+//========================================================================
+// BatchPoint2::transform (interleaved array)
+//   (x0, y0, x1, y1) maps to c (x0, y0, x1, y1) + (-s, s, -s, s)
+//   (y0, x0, y1, x1) + (p1, p2, p1, p2).
+//========================================================================
+template<class T>
+void BatchPoint2<T>::transform(const T *m, const T *xy, T *txy, int n)
+{
+ typedef Simd4<T> S;
+ S c = S::broadcast(m[0]), s = S::set(-m[1], m[1], -m[1], m[1]);
+ S d = S::set(m[2], m[3], m[2], m[3]);
+ int i;
+ for(i = 0; i + 2 <= n; i += 2)
+ {
+  S p = S::load(xy + 2 * i);
+  S::multiplyAdd(s, p.template permute<1, 0, 3, 2>(), S::multiplyAdd(c, p, d))
+   .store(txy + 2 * i);
+ }
+ if(i < n)
+ {
+  T t[8] = {xy[2 * i], xy[2 * i + 1], 0, 0};
+  transform(m, t, t + 4, 2);
+  txy[2 * i] = t[4];
+  txy[2 * i + 1] = t[5];
+ }
+}
+
+
+//========================================================================
+// transformPoints (component arrays)
+//========================================================================
+template<class T>
+void transformPoints(const SE2<T> &t, const T *x, const T *y, T *tx, T *ty, int count)
+{
+ typedef BatchPoint2<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+ const T *m = t.getElementsPointer();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::transform(m, x + i, y + i, tx + i, ty + i, n);
+ }
+}
+
+
+//========================================================================
+// transformPoints (interleaved array)
+//========================================================================
+template<class T>
+void transformPoints(const SE2<T> &t, const T *xy, T *txy, int count)
+{
+ typedef BatchPoint2<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+ const T *m = t.getElementsPointer();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::transform(m, xy + 2 * i, txy + 2 * i, n);
+ }
+}
+
+
+//========================================================================
+// operator<<
+//========================================================================
+template<class T>
+std::ostream &operator<<(std::ostream &out, const SE2<T> &t)
+{
+ out << t.x() << " " << t.y() << " " << t.angle() << std::endl;
+ return out;
+}
+
+
+#endif
@@ -0,0 +1,400 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Simd.hpp
+// Description          : Four-lane SIMD arithmetic with a portable fallback
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_Simd_hpp
+#define INCLUDED_Simd_hpp
+
+#include <math.h>
+
+#if !defined(QMATH_NO_SSE) && (defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define QMATH_SSE
+#include <xmmintrin.h>
+#endif
+#if defined(QMATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define QMATH_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(QMATH_SSE2) && defined(__AVX2__)
+#define QMATH_AVX2
+#include <immintrin.h>
+#endif
+#if defined(QMATH_SSE2) && defined(__FMA__)
+#define QMATH_FMA
+#include <immintrin.h>
+#endif
+ // QMATH_SSE, QMATH_SSE2, QMATH_AVX2 and QMATH_FMA are defined when the
+ // compiler targets a processor with these instruction sets (e.g.
+ // -mavx2 -mfma with GCC). Define QMATH_NO_SSE before including any
+ // QMath header to use the portable code instead.
+
+#if defined(_MSC_VER)
+ #define QMATH_ALIGN16 __declspec(align(16))
+#elif defined(__GNUC__)
+ #define QMATH_ALIGN16 __attribute__((aligned(16)))
+#else
+ #define QMATH_ALIGN16
+#endif
+ // Placed after the class keyword, aligns objects of the class to 16
+ // bytes.
+
+#if defined(QMATH_AVX2) && defined(QMATH_FMA)
+ #define QMATH_SIMD_NAMESPACE QMathSimd_avx2_fma
+#elif defined(QMATH_AVX2)
+ #define QMATH_SIMD_NAMESPACE QMathSimd_avx2
+#elif defined(QMATH_SSE2) && defined(QMATH_FMA)
+ #define QMATH_SIMD_NAMESPACE QMathSimd_sse2_fma
+#elif defined(QMATH_SSE2)
+ #define QMATH_SIMD_NAMESPACE QMathSimd_sse2
+#elif defined(QMATH_SSE)
+ #define QMATH_SIMD_NAMESPACE QMathSimd_sse
+#else
+ #define QMATH_SIMD_NAMESPACE QMathSimd_portable
+#endif
+ // Simd4 is declared in a namespace named after the instruction sets,
+ // made visible by a using-directive. Its layout and its inline
+ // functions differ between instruction sets, so that the namespace
+ // keeps the copies compiled into libQMath apart from those of a
+ // program compiled for other instruction sets (e.g. -mavx2 -mfma),
+ // in the static library as in the shared one. Functions taking or
+ // returning Simd4 are kept apart through their parameter types;
+ // internal classes whose layout depends on Simd4, or whose functions
+ // return it from scalar arguments, are declared in this namespace too.
+
+//========================================================================
+// class Simd4
+// -----------------------------------------------------------------------
+// \brief
+// This file is used internally by the library. Simd4<T> holds four
+// values of type T in SIMD registers where the processor has them (SSE
+// for float, SSE2 or AVX2 for double) and in an ordinary array
+// otherwise. Loads and stores are unaligned, so any four consecutive
+// elements can be processed.
+//========================================================================
+
+namespace QMATH_SIMD_NAMESPACE {
+
+template<class T>
+class Simd4
+{
+ public:
+  static inline Simd4 load(const T *p)
+  { Simd4 r; r.v[0] = p[0]; r.v[1] = p[1]; r.v[2] = p[2]; r.v[3] = p[3]; return r; }
+   // Loads p[0..3].
+
+  static inline Simd4 broadcast(const T &s)
+  { Simd4 r; r.v[0] = s; r.v[1] = s; r.v[2] = s; r.v[3] = s; return r; }
+   // All four lanes set to s.
+
+  static inline Simd4 set(const T &a, const T &b, const T &c, const T &d)
+  { Simd4 r; r.v[0] = a; r.v[1] = b; r.v[2] = c; r.v[3] = d; return r; }
+   // The lanes (a, b, c, d), assembled in registers. Prefer this to
+   // storing elements one at a time and loading them as a group, which
+   // stalls the processor.
+
+  inline void store(T *p) const
+  { p[0] = v[0]; p[1] = v[1]; p[2] = v[2]; p[3] = v[3]; }
+   // Stores the lanes to p[0..3].
+
+  inline Simd4 operator+(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = v[i] + b.v[i]; return r; }
+
+  inline Simd4 operator-(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = v[i] - b.v[i]; return r; }
+
+  inline Simd4 operator*(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = v[i] * b.v[i]; return r; }
+
+  inline Simd4 operator/(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = v[i] / b.v[i]; return r; }
+
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return a * b + c; }
+   // a * b + c, with a single rounding (fused) where QMATH_FMA is
+   // defined.
+
+  inline Simd4 sqrt() const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = ::sqrt(v[i]); return r; }
+   // The square roots of the lanes.
+
+  inline Simd4 minimum(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = (b.v[i] < v[i]) ? b.v[i] : v[i]; return r; }
+
+  inline Simd4 maximum(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = (v[i] < b.v[i]) ? b.v[i] : v[i]; return r; }
+   // The lane-wise minimum and maximum.
+
+  inline Simd4 abs() const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = (T)fabs(v[i]); return r; }
+   // The absolute values of the lanes.
+
+  inline Simd4 greater(const Simd4 &b) const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = (b.v[i] < v[i]) ? 1 : 0; return r; }
+   // 1 in the lanes where a > b, 0 elsewhere. Multiplying by the result
+   // selects between two values without branching.
+
+  inline Simd4 round() const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = (T)floor(v[i] + (T)0.5); return r; }
+   // The lanes rounded to the nearest integer. Valid for lanes of
+   // magnitude below 2^22 for float and 2^51 for double; the rounding
+   // of halves may differ between implementations.
+
+  inline Simd4 pow2() const
+  { Simd4 r; for(int i = 0; i < 4; ++i) r.v[i] = (T)ldexp(1.0, (int)v[i]); return r; }
+   // 2 to the power of the lanes, which must hold integers for which
+   // the result is a normal number of type T.
+
+  inline Simd4 rotate() const
+  { Simd4 r; r.v[0] = v[1]; r.v[1] = v[2]; r.v[2] = v[0]; r.v[3] = v[3]; return r; }
+   // (a1, a2, a0, a3): rotates the first three lanes, as used by cross
+   // products.
+
+  template<int i0, int i1, int i2, int i3>
+  inline Simd4 permute() const
+  { return set(v[i0], v[i1], v[i2], v[i3]); }
+   // (a[i0], a[i1], a[i2], a[i3]) for lane numbers from 0 to 3. Called
+   // as x.template permute<3, 3, 3, 3>() in templates.
+
+  inline T sum() const
+  { return (v[0] + v[2]) + (v[1] + v[3]); }
+   // The sum of the four lanes, added in the same order by all
+   // implementations.
+
+  static inline Simd4 sums(const Simd4 &a, const Simd4 &b, const Simd4 &c, const Simd4 &d)
+  { return set(a.sum(), b.sum(), c.sum(), d.sum()); }
+   // (a.sum(), b.sum(), c.sum(), d.sum()), computed together. Four dot
+   // products, such as a 4x4 matrix times a vector, need one call.
+
+ private:
+  T v[4];
+};
+
+// ========== END OF INTERFACE ==========
+
+
+#ifdef QMATH_SSE
+template<>
+class Simd4<float>
+{
+ public:
+  static inline Simd4 load(const float *p) { return Simd4(_mm_loadu_ps(p)); }
+  static inline Simd4 broadcast(const float &s) { return Simd4(_mm_set1_ps(s)); }
+  static inline Simd4 set(const float &a, const float &b, const float &c, const float &d)
+  { return Simd4(_mm_setr_ps(a, b, c, d)); }
+  inline void store(float *p) const { _mm_storeu_ps(p, v); }
+  inline Simd4 operator+(const Simd4 &b) const { return Simd4(_mm_add_ps(v, b.v)); }
+  inline Simd4 operator-(const Simd4 &b) const { return Simd4(_mm_sub_ps(v, b.v)); }
+  inline Simd4 operator*(const Simd4 &b) const { return Simd4(_mm_mul_ps(v, b.v)); }
+  inline Simd4 operator/(const Simd4 &b) const { return Simd4(_mm_div_ps(v, b.v)); }
+#ifdef QMATH_FMA
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return Simd4(_mm_fmadd_ps(a.v, b.v, c.v)); }
+#else
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return Simd4(_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)); }
+#endif
+  inline Simd4 sqrt() const { return Simd4(_mm_sqrt_ps(v)); }
+  inline Simd4 minimum(const Simd4 &b) const { return Simd4(_mm_min_ps(v, b.v)); }
+  inline Simd4 maximum(const Simd4 &b) const { return Simd4(_mm_max_ps(v, b.v)); }
+  inline Simd4 abs() const { return Simd4(_mm_andnot_ps(_mm_set1_ps(-0.0f), v)); }
+  inline Simd4 greater(const Simd4 &b) const
+  { return Simd4(_mm_and_ps(_mm_cmpgt_ps(v, b.v), _mm_set1_ps(1.0f))); }
+  inline Simd4 round() const
+  {
+   const __m128 m = _mm_set1_ps(12582912.0f);              // 1.5 * 2^23
+   return Simd4(_mm_sub_ps(_mm_add_ps(v, m), m));
+  }
+  inline Simd4 pow2() const
+  {
+#ifdef QMATH_SSE2
+   __m128i e = _mm_add_epi32(_mm_cvtps_epi32(v), _mm_set1_epi32(127));
+   return Simd4(_mm_castsi128_ps(_mm_slli_epi32(e, 23)));
+#else
+   float f[4];
+   _mm_storeu_ps(f, v);
+   for(int i = 0; i < 4; ++i) f[i] = (float)ldexp(1.0, (int)f[i]);
+   return Simd4(_mm_loadu_ps(f));
+#endif
+  }
+  inline Simd4 rotate() const { return Simd4(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1))); }
+  template<int i0, int i1, int i2, int i3>
+  inline Simd4 permute() const { return Simd4(_mm_shuffle_ps(v, v, _MM_SHUFFLE(i3, i2, i1, i0))); }
+  inline float sum() const
+  {
+   __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));         // (0+2, 1+3, ...)
+   s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1)));
+   return _mm_cvtss_f32(s);
+  }
+  static inline Simd4 sums(const Simd4 &a, const Simd4 &b, const Simd4 &c, const Simd4 &d)
+  {
+   __m128 ab = _mm_add_ps(_mm_unpacklo_ps(a.v, b.v), _mm_unpackhi_ps(a.v, b.v)); // a0+a2 b0+b2 a1+a3 b1+b3
+   __m128 cd = _mm_add_ps(_mm_unpacklo_ps(c.v, d.v), _mm_unpackhi_ps(c.v, d.v));
+   return Simd4(_mm_add_ps(_mm_movelh_ps(ab, cd), _mm_movehl_ps(cd, ab)));
+  }
+
+  Simd4() {}
+  explicit Simd4(__m128 x) : v(x) {}
+
+ private:
+  __m128 v;
+};
+#endif
+
+
+#if defined(QMATH_AVX2)
+template<>
+class Simd4<double>
+{
+ public:
+  static inline Simd4 load(const double *p) { return Simd4(_mm256_loadu_pd(p)); }
+  static inline Simd4 broadcast(const double &s) { return Simd4(_mm256_set1_pd(s)); }
+  static inline Simd4 set(const double &a, const double &b, const double &c, const double &d)
+  { return Simd4(_mm256_setr_pd(a, b, c, d)); }
+  inline void store(double *p) const { _mm256_storeu_pd(p, v); }
+  inline Simd4 operator+(const Simd4 &b) const { return Simd4(_mm256_add_pd(v, b.v)); }
+  inline Simd4 operator-(const Simd4 &b) const { return Simd4(_mm256_sub_pd(v, b.v)); }
+  inline Simd4 operator*(const Simd4 &b) const { return Simd4(_mm256_mul_pd(v, b.v)); }
+  inline Simd4 operator/(const Simd4 &b) const { return Simd4(_mm256_div_pd(v, b.v)); }
+#ifdef QMATH_FMA
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return Simd4(_mm256_fmadd_pd(a.v, b.v, c.v)); }
+#else
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return Simd4(_mm256_add_pd(_mm256_mul_pd(a.v, b.v), c.v)); }
+#endif
+  inline Simd4 sqrt() const { return Simd4(_mm256_sqrt_pd(v)); }
+  inline Simd4 minimum(const Simd4 &b) const { return Simd4(_mm256_min_pd(v, b.v)); }
+  inline Simd4 maximum(const Simd4 &b) const { return Simd4(_mm256_max_pd(v, b.v)); }
+  inline Simd4 abs() const { return Simd4(_mm256_andnot_pd(_mm256_set1_pd(-0.0), v)); }
+  inline Simd4 greater(const Simd4 &b) const
+  { return Simd4(_mm256_and_pd(_mm256_cmp_pd(v, b.v, _CMP_GT_OQ), _mm256_set1_pd(1.0))); }
+  inline Simd4 round() const { return Simd4(_mm256_round_pd(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+  inline Simd4 pow2() const
+  {
+   __m128i e = _mm_add_epi32(_mm256_cvtpd_epi32(v), _mm_set1_epi32(1023));
+   return Simd4(_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_cvtepi32_epi64(e), 52)));
+  }
+  inline Simd4 rotate() const { return Simd4(_mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 0, 2, 1))); }
+  template<int i0, int i1, int i2, int i3>
+  inline Simd4 permute() const { return Simd4(_mm256_permute4x64_pd(v, _MM_SHUFFLE(i3, i2, i1, i0))); }
+  inline double sum() const
+  {
+   __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+   return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+  static inline Simd4 sums(const Simd4 &a, const Simd4 &b, const Simd4 &c, const Simd4 &d)
+  {
+   __m256d ac = _mm256_add_pd(_mm256_permute2f128_pd(a.v, c.v, 0x20),   // a0+a2 a1+a3 c0+c2 c1+c3
+                              _mm256_permute2f128_pd(a.v, c.v, 0x31));
+   __m256d bd = _mm256_add_pd(_mm256_permute2f128_pd(b.v, d.v, 0x20),
+                              _mm256_permute2f128_pd(b.v, d.v, 0x31));
+   return Simd4(_mm256_add_pd(_mm256_unpacklo_pd(ac, bd), _mm256_unpackhi_pd(ac, bd)));
+  }
+
+  Simd4() {}
+  explicit Simd4(__m256d x) : v(x) {}
+
+ private:
+  __m256d v;
+};
+#elif defined(QMATH_SSE2)
+template<>
+class Simd4<double>
+{
+ public:
+  static inline Simd4 load(const double *p) { return Simd4(_mm_loadu_pd(p), _mm_loadu_pd(p + 2)); }
+  static inline Simd4 broadcast(const double &s) { __m128d x = _mm_set1_pd(s); return Simd4(x, x); }
+  static inline Simd4 set(const double &a, const double &b, const double &c, const double &d)
+  { return Simd4(_mm_setr_pd(a, b), _mm_setr_pd(c, d)); }
+  inline void store(double *p) const { _mm_storeu_pd(p, lo); _mm_storeu_pd(p + 2, hi); }
+  inline Simd4 operator+(const Simd4 &b) const { return Simd4(_mm_add_pd(lo, b.lo), _mm_add_pd(hi, b.hi)); }
+  inline Simd4 operator-(const Simd4 &b) const { return Simd4(_mm_sub_pd(lo, b.lo), _mm_sub_pd(hi, b.hi)); }
+  inline Simd4 operator*(const Simd4 &b) const { return Simd4(_mm_mul_pd(lo, b.lo), _mm_mul_pd(hi, b.hi)); }
+  inline Simd4 operator/(const Simd4 &b) const { return Simd4(_mm_div_pd(lo, b.lo), _mm_div_pd(hi, b.hi)); }
+#ifdef QMATH_FMA
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return Simd4(_mm_fmadd_pd(a.lo, b.lo, c.lo), _mm_fmadd_pd(a.hi, b.hi, c.hi)); }
+#else
+  static inline Simd4 multiplyAdd(const Simd4 &a, const Simd4 &b, const Simd4 &c)
+  { return Simd4(_mm_add_pd(_mm_mul_pd(a.lo, b.lo), c.lo), _mm_add_pd(_mm_mul_pd(a.hi, b.hi), c.hi)); }
+#endif
+  inline Simd4 sqrt() const { return Simd4(_mm_sqrt_pd(lo), _mm_sqrt_pd(hi)); }
+  inline Simd4 minimum(const Simd4 &b) const { return Simd4(_mm_min_pd(lo, b.lo), _mm_min_pd(hi, b.hi)); }
+  inline Simd4 maximum(const Simd4 &b) const { return Simd4(_mm_max_pd(lo, b.lo), _mm_max_pd(hi, b.hi)); }
+  inline Simd4 abs() const
+  {
+   const __m128d m = _mm_set1_pd(-0.0);
+   return Simd4(_mm_andnot_pd(m, lo), _mm_andnot_pd(m, hi));
+  }
+  inline Simd4 greater(const Simd4 &b) const
+  {
+   const __m128d one = _mm_set1_pd(1.0);
+   return Simd4(_mm_and_pd(_mm_cmpgt_pd(lo, b.lo), one), _mm_and_pd(_mm_cmpgt_pd(hi, b.hi), one));
+  }
+  inline Simd4 round() const
+  {
+   const __m128d m = _mm_set1_pd(6755399441055744.0);       // 1.5 * 2^52
+   return Simd4(_mm_sub_pd(_mm_add_pd(lo, m), m), _mm_sub_pd(_mm_add_pd(hi, m), m));
+  }
+  inline Simd4 pow2() const { return Simd4(pow2(lo), pow2(hi)); }
+  inline Simd4 rotate() const { return Simd4(_mm_shuffle_pd(lo, hi, 1), _mm_shuffle_pd(lo, hi, 2)); }
+  template<int i0, int i1, int i2, int i3>
+  inline Simd4 permute() const
+  {
+   return Simd4(_mm_shuffle_pd(i0 < 2 ? lo : hi, i1 < 2 ? lo : hi, (i0 & 1) | ((i1 & 1) << 1)),
+                _mm_shuffle_pd(i2 < 2 ? lo : hi, i3 < 2 ? lo : hi, (i2 & 1) | ((i3 & 1) << 1)));
+  }
+  inline double sum() const
+  {
+   __m128d s = _mm_add_pd(lo, hi);
+   return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+  }
+  static inline Simd4 sums(const Simd4 &a, const Simd4 &b, const Simd4 &c, const Simd4 &d)
+  {
+   __m128d sa = _mm_add_pd(a.lo, a.hi), sb = _mm_add_pd(b.lo, b.hi);   // a0+a2 a1+a3
+   __m128d sc = _mm_add_pd(c.lo, c.hi), sd = _mm_add_pd(d.lo, d.hi);
+   return Simd4(_mm_add_pd(_mm_unpacklo_pd(sa, sb), _mm_unpackhi_pd(sa, sb)),
+                _mm_add_pd(_mm_unpacklo_pd(sc, sd), _mm_unpackhi_pd(sc, sd)));
+  }
+
+  Simd4() {}
+  Simd4(__m128d l, __m128d h) : lo(l), hi(h) {}
+
+ private:
+  static inline __m128d pow2(__m128d x)
+  {
+   __m128i e = _mm_add_epi32(_mm_cvtpd_epi32(x), _mm_set1_epi32(1023));
+   return _mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(e, _mm_setzero_si128()), 52));
+  }
+
+  __m128d lo, hi;                                          // lanes 0, 1 and 2, 3
+};
+#endif
+
+} // namespace QMATH_SIMD_NAMESPACE
+
+using namespace QMATH_SIMD_NAMESPACE;
+
+
+#endif
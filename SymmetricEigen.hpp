@@ -0,0 +1,420 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SymmetricEigen.hpp
+// Description          : Eigen-decomposition of real symmetric matrices
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_SymmetricEigen_hpp
+#define INCLUDED_SymmetricEigen_hpp
+
+#include <math.h>
+#include <limits>
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+//========================================================================
+// Eigen-decomposition of symmetric matrices
+// -----------------------------------------------------------------------
+// \brief
+// Eigenvalues and eigenvectors of real symmetric matrices.
+//
+// 3 x 3 matrices (inertia tensors, covariances of point clouds) are
+// solved in closed form: the eigenvalues are the roots of the
+// characteristic polynomial computed trigonometrically, and the
+// eigenvectors are obtained from cross products of the rows of
+// (A - lambda * I). When two eigenvalues are too close for the closed form
+// to produce accurate eigenvectors, the solver falls back to the Jacobi
+// method. Matrices of any other size are diagonalized by cyclic Jacobi
+// rotations.
+//
+// Only the upper triangle of the input matrix is referenced. Eigenvalues
+// are returned in ascending order and the corresponding unit eigenvectors
+// are the columns of the eigenvector matrix.
+//
+// <b>Example Program:</b>
+// \include SymmetricEigen.t.cpp
+//========================================================================
+
+template<int size, class T>
+void eigenSymmetric(const Matrix<size, size, T> &m, ColumnVector<size, T> &values,
+                    Matrix<size, size, T> &vectors);
+ // Eigen-decomposition of a symmetric matrix \a m such that
+ // m = vectors * diag(values) * transpose(vectors).
+ //  m        The symmetric matrix.
+ //  values   The eigenvalues in ascending order.
+ //  vectors  The eigenvectors, stored column-wise in the same order
+ //           as \a values.
+
+template<class T>
+void eigenSymmetric(const Matrix<3, 3, T> &m, ColumnVector<3, T> &values,
+                    Matrix<3, 3, T> &vectors);
+ // Closed-form eigen-decomposition of a symmetric 3 x 3 matrix. See above.
+
+template<int size, class T>
+void eigenValuesSymmetric(const Matrix<size, size, T> &m, ColumnVector<size, T> &values);
+ // Computes only the eigenvalues of a symmetric matrix. This is cheaper
+ // than eigenSymmetric() because the eigenvectors are not accumulated.
+ //  values   The eigenvalues in ascending order.
+
+template<class T>
+void eigenValuesSymmetric(const Matrix<3, 3, T> &m, ColumnVector<3, T> &values);
+ // Closed-form eigenvalues of a symmetric 3 x 3 matrix.
+
+template<class T>
+void eigenSymmetric(const Matrix<3, 3, T> *m, ColumnVector<3, T> *values,
+                    Matrix<3, 3, T> *vectors, int count);
+ // Eigen-decomposition of an array of symmetric 3 x 3 matrices.
+ //  m        Array of \a count symmetric matrices.
+ //  values   Array of \a count vectors receiving the eigenvalues.
+ //  vectors  Array of \a count matrices receiving the eigenvectors.
+ //  count    Number of matrices in the batch.
+
+template<class T>
+void eigenValuesSymmetric(const Matrix<3, 3, T> *m, ColumnVector<3, T> *values, int count);
+ // Eigenvalues of an array of symmetric 3 x 3 matrices.
+ // Example:
+ // \code
+ // Matrix<3,3> covariance[100];
+ // ColumnVector<3> lambda[100];
+ // eigenValuesSymmetric(covariance, lambda, 100);
+ // \endcode
+
+template<int size, class T>
+void symmetricEigenJacobi(T *a, T *d, T *v);
+ // Cyclic Jacobi kernel operating on raw row-major storage. This function
+ // is used internally by the library.
+ //  a  The size x size symmetric matrix. The contents are destroyed.
+ //  d  Receives the \a size eigenvalues in ascending order.
+ //  v  Receives the eigenvectors column-wise, or 0 if not required.
+
+template<class T>
+bool symmetricEigen3(const T *a, T *d, T *v);
+ // Closed-form 3 x 3 kernel operating on raw row-major storage. This
+ // function is used internally by the library.
+ //  return  false if the eigenvectors could not be computed accurately
+ //          in closed form (repeated eigenvalues). Eigenvalues are
+ //          always valid.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// symmetricEigenJacobi
+//========================================================================
+template<int n, class T>
+void symmetricEigenJacobi(T *a, T *d, T *v)
+{
+ int p, q, j;
+
+ if(v)
+ {
+  for(p = 0; p < n*n; ++p)
+   v[p] = 0;
+  for(p = 0; p < n; ++p)
+   v[p * n + p] = 1;
+ }
+ for(p = 0; p < n; ++p)
+  d[p] = a[p * n + p];
+
+ for(int sweep = 0; sweep < 50; ++sweep)
+ {
+  T off = 0;
+  for(p = 0; p < n-1; ++p)
+   for(q = p+1; q < n; ++q)
+    off += fabs(a[p * n + q]);
+  if(off == 0)
+   break;
+
+  for(p = 0; p < n-1; ++p)
+  {
+   for(q = p+1; q < n; ++q)
+   {
+    T apq = a[p * n + q];
+    T g = 100 * fabs(apq);
+
+    // after a few sweeps, drop elements that no longer affect the diagonal
+    if( (sweep > 3) && (fabs(d[p]) + g == fabs(d[p])) && (fabs(d[q]) + g == fabs(d[q])) )
+    {
+     a[p * n + q] = 0;
+     continue;
+    }
+    if(apq == 0)
+     continue;
+
+    T h = d[q] - d[p];
+    T t;
+    if(fabs(h) + g == fabs(h))
+     t = apq / h;
+    else
+    {
+     T theta = (T)0.5 * h / apq;
+     t = 1 / (fabs(theta) + sqrt(1 + theta * theta));
+     if(theta < 0)
+      t = -t;
+    }
+    T c = 1 / sqrt(1 + t * t);
+    T s = t * c;
+    T tau = s / (1 + c);
+
+    d[p] -= t * apq;
+    d[q] += t * apq;
+    a[p * n + q] = 0;
+
+    T x, y;
+    for(j = 0; j < p; ++j)
+    {
+     x = a[j * n + p]; y = a[j * n + q];
+     a[j * n + p] = x - s * (y + x * tau);
+     a[j * n + q] = y + s * (x - y * tau);
+    }
+    for(j = p+1; j < q; ++j)
+    {
+     x = a[p * n + j]; y = a[j * n + q];
+     a[p * n + j] = x - s * (y + x * tau);
+     a[j * n + q] = y + s * (x - y * tau);
+    }
+    for(j = q+1; j < n; ++j)
+    {
+     x = a[p * n + j]; y = a[q * n + j];
+     a[p * n + j] = x - s * (y + x * tau);
+     a[q * n + j] = y + s * (x - y * tau);
+    }
+    if(v)
+    {
+     for(j = 0; j < n; ++j)
+     {
+      x = v[j * n + p]; y = v[j * n + q];
+      v[j * n + p] = x - s * (y + x * tau);
+      v[j * n + q] = y + s * (x - y * tau);
+     }
+    }
+   }
+  }
+ }
+
+ // sort into ascending order
+ for(p = 0; p < n-1; ++p)
+ {
+  int k = p;
+  for(q = p+1; q < n; ++q)
+   if(d[q] < d[k]) k = q;
+  if(k != p)
+  {
+   T tmp = d[p]; d[p] = d[k]; d[k] = tmp;
+   if(v)
+   {
+    for(j = 0; j < n; ++j)
+    {
+     tmp = v[j * n + p]; v[j * n + p] = v[j * n + k]; v[j * n + k] = tmp;
+    }
+   }
+  }
+ }
+}
+
+
+//========================================================================
+// symmetricEigenVector3
+//   Unit null vector of (A - e * I) from the largest cross product of
+//   its rows. Returns false if (A - e * I) is not of rank 2.
+//========================================================================
+template<class T>
+bool symmetricEigenVector3(const T *a, T e, T scale, T *u)
+{
+ T r0[3] = {a[0] - e, a[1], a[2]};
+ T r1[3] = {a[1], a[4] - e, a[5]};
+ T r2[3] = {a[2], a[5], a[8] - e};
+ T c[3][3];
+
+ c[0][0] = r0[1]*r1[2] - r0[2]*r1[1];
+ c[0][1] = r0[2]*r1[0] - r0[0]*r1[2];
+ c[0][2] = r0[0]*r1[1] - r0[1]*r1[0];
+ c[1][0] = r0[1]*r2[2] - r0[2]*r2[1];
+ c[1][1] = r0[2]*r2[0] - r0[0]*r2[2];
+ c[1][2] = r0[0]*r2[1] - r0[1]*r2[0];
+ c[2][0] = r1[1]*r2[2] - r1[2]*r2[1];
+ c[2][1] = r1[2]*r2[0] - r1[0]*r2[2];
+ c[2][2] = r1[0]*r2[1] - r1[1]*r2[0];
+
+ int k = 0;
+ T n2[3];
+ for(int i = 0; i < 3; ++i)
+ {
+  n2[i] = c[i][0]*c[i][0] + c[i][1]*c[i][1] + c[i][2]*c[i][2];
+  if(n2[i] > n2[k]) k = i;
+ }
+
+ T s2 = scale * scale;
+ if( n2[k] <= std::numeric_limits<T>::epsilon() * s2 * s2 )
+  return false;
+
+ T in = 1 / sqrt(n2[k]);
+ u[0] = c[k][0] * in;
+ u[1] = c[k][1] * in;
+ u[2] = c[k][2] * in;
+ return true;
+}
+
+
+//========================================================================
+// symmetricEigen3
+//========================================================================
+template<class T>
+bool symmetricEigen3(const T *a, T *d, T *v)
+{
+ T p1 = a[1]*a[1] + a[2]*a[2] + a[5]*a[5];
+ T q = (a[0] + a[4] + a[8]) / 3;
+ T b00 = a[0] - q;
+ T b11 = a[4] - q;
+ T b22 = a[8] - q;
+ T p = sqrt( (b00*b00 + b11*b11 + b22*b22 + 2 * p1) / 6 );
+
+ if(p == 0) // multiple of identity
+ {
+  d[0] = d[1] = d[2] = q;
+  if(v)
+  {
+   for(int i = 0; i < 9; ++i) v[i] = 0;
+   v[0] = v[4] = v[8] = 1;
+  }
+  return true;
+ }
+
+ // eigenvalues of B = (A - qI)/p are 2cos(phi + 2k pi/3), det(B) = 2cos(3phi)
+ T detB = b00 * (b11 * b22 - a[5] * a[5])
+        - a[1] * (a[1] * b22 - a[5] * a[2])
+        + a[2] * (a[1] * a[5] - b11 * a[2]);
+ T r = detB / (2 * p * p * p);
+ if(r < -1) r = -1;
+ if(r > 1) r = 1;
+ T phi = acos(r) / 3;
+ T e1 = q + 2 * p * cos(phi);
+ T e3 = q + 2 * p * cos(phi + (T)(2.0 * M_PI / 3.0));
+ T e2 = 3 * q - e1 - e3;
+ d[0] = e3;
+ d[1] = e2;
+ d[2] = e1;
+
+ if(!v)
+  return true;
+
+ // cross products lose accuracy as eigenvalues coalesce
+ T gap = sqrt(std::numeric_limits<T>::epsilon()) * p;
+ if( (e1 - e2 < gap) || (e2 - e3 < gap) )
+  return false;
+
+ T u1[3], u3[3];
+ if( !symmetricEigenVector3(a, e1, p, u1) || !symmetricEigenVector3(a, e3, p, u3) )
+  return false;
+
+ // re-orthogonalize the smallest against the largest, complete the basis
+ T dp = u1[0]*u3[0] + u1[1]*u3[1] + u1[2]*u3[2];
+ u3[0] -= dp * u1[0];
+ u3[1] -= dp * u1[1];
+ u3[2] -= dp * u1[2];
+ T in = 1 / sqrt(u3[0]*u3[0] + u3[1]*u3[1] + u3[2]*u3[2]);
+ u3[0] *= in;
+ u3[1] *= in;
+ u3[2] *= in;
+
+ v[0] = u3[0]; v[3] = u3[1]; v[6] = u3[2];
+ v[2] = u1[0]; v[5] = u1[1]; v[8] = u1[2];
+ v[1] = u1[1]*u3[2] - u1[2]*u3[1];
+ v[4] = u1[2]*u3[0] - u1[0]*u3[2];
+ v[7] = u1[0]*u3[1] - u1[1]*u3[0];
+ return true;
+}
+
+
+//========================================================================
+// eigenSymmetric
+//========================================================================
+template<int n, class T>
+void eigenSymmetric(const Matrix<n, n, T> &m, ColumnVector<n, T> &values,
+                    Matrix<n, n, T> &vectors)
+{
+ T a[n * n];
+ const T *pm = m.getElementsPointer();
+ for(int i = 0; i < n * n; ++i)
+  a[i] = pm[i];
+ symmetricEigenJacobi<n, T>(a, values.getElementsPointer(), vectors.getElementsPointer());
+}
+
+
+template<class T>
+void eigenSymmetric(const Matrix<3, 3, T> &m, ColumnVector<3, T> &values,
+                    Matrix<3, 3, T> &vectors)
+{
+ const T *pm = m.getElementsPointer();
+ T *pv = vectors.getElementsPointer();
+ T *pd = values.getElementsPointer();
+ if( !symmetricEigen3(pm, pd, pv) )
+ {
+  T a[9];
+  for(int i = 0; i < 9; ++i)
+   a[i] = pm[i];
+  symmetricEigenJacobi<3, T>(a, pd, pv);
+ }
+}
+
+
+template<class T>
+void eigenSymmetric(const Matrix<3, 3, T> *m, ColumnVector<3, T> *values,
+                    Matrix<3, 3, T> *vectors, int count)
+{
+ for(int i = 0; i < count; ++i)
+  eigenSymmetric(m[i], values[i], vectors[i]);
+}
+
+
+//========================================================================
+// eigenValuesSymmetric
+//========================================================================
+template<int n, class T>
+void eigenValuesSymmetric(const Matrix<n, n, T> &m, ColumnVector<n, T> &values)
+{
+ T a[n * n];
+ const T *pm = m.getElementsPointer();
+ for(int i = 0; i < n * n; ++i)
+  a[i] = pm[i];
+ symmetricEigenJacobi<n, T>(a, values.getElementsPointer(), (T *)0);
+}
+
+
+template<class T>
+void eigenValuesSymmetric(const Matrix<3, 3, T> &m, ColumnVector<3, T> &values)
+{
+ symmetricEigen3(m.getElementsPointer(), values.getElementsPointer(), (T *)0);
+}
+
+
+template<class T>
+void eigenValuesSymmetric(const Matrix<3, 3, T> *m, ColumnVector<3, T> *values, int count)
+{
+ for(int i = 0; i < count; ++i)
+  symmetricEigen3(m[i].getElementsPointer(), values[i].getElementsPointer(), (T *)0);
+}
+
+
+#endif
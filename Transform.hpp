@@ -1,289 +1,648 @@
-//======================================================================== 
-// Package		: QMath - Template Math Library
-// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
-// Compatibility	: GCC 2.95.3 and above, MSVS 2005
-// File                 : Transform.hpp
-// Description          : Template class for homogeneous transformations
-//
-// Copyright (C) 2000 Vilas Chitrakaran
-// 
-// This program is free software; you can redistribute it and/or modify
-// it under the terms of the GNU Lesser General Public License as published 
-// by the Free Software Foundation; either version 2 of the License, or (at
-// your option) any later version.
-// 
-// This program is distributed in the hope that it will be useful, but
-// WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
-// 
-// You should have received a copy of the GNU General Public License
-// along with this program; if not, write to the Free Software
-// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
-//========================================================================  
- 
-#ifndef INCLUDED_Transform_hpp
-#define INCLUDED_Transform_hpp
-
-#ifdef QMATH_DLL
- #ifdef QMATH_DLL_EXPORT
-  #define QMATHDLL_API __declspec(dllexport)
- #else
-  #define QMATHDLL_API __declspec(dllimport)
- #endif
-#else
- #define QMATHDLL_API
-#endif
-
-#include <float.h>
-#include "Matrix.hpp"
-#include "ColumnVector.hpp"
-#include "RowVector.hpp"
-
-#ifdef _MSC_VER
- #define finite(n) _finite(n)
-#endif
-
-
-//====================================================================
-// class Transform
-// -------------------------------------------------------------------
-// \brief
-// The class \c Transform represents a 4x4 homogeneous transformation 
-// matrix.
-//
-// <b>Example Program:</b>
-// \include Transform.t.cpp
-//========================================================================  
- 
-class QMATHDLL_API Transform : public Matrix <4, 4, double>
-{
- public:
-  inline Transform();
-   // The default constructor for the
-   // \c Transform object. The \c Transform
-   // matrix is initialized to the following form.
-   // \code
-   //	[1 0 0 0]
-   //	[0 1 0 0]
-   //	[0 0 1 0]
-   //	[0 0 0 1]
-   // \endcode
-
-  inline Transform(const Transform &transform);
-   // Copy Constructor.
-
-  ~Transform() {}
-   // The default destructor.
-	
-  inline MatrixInitializer<double> operator=(const double &val);
-   // This function provides an overloaded assignment
-   // operator for initializing the elements of a Transform.
-   // The initialization of the Transform object can be 
-   // done as a comma seperated list. For example:
-   // \code Transform myTransform;
-   // myTransform = cos(x), sin(x),...so on ; \endcode
-   //  val  The comma separated list of elements.
-		
-  inline ColumnVector<3,double> getTranslation() const;
-   //  return  The position vector (last column) from the matrix.
-		
-  inline void getRollPitchYaw(double &roll, double &pitch, double &yaw) const;
-   // This function returns the roll (z), pitch (y) and yaw (x) angles from the
-   // homogeneous transformation matrix. The angles are defined as follows: 
-   // The rotational part of the Transform matrix is obtained by 
-   // first defining a rotation about X axis by \c yaw radians, 
-   // then a rotation about the Y axis by \c pitch radians and 
-   // finally a rotation about the Z axis by \c roll radians, 
-   // all rotations being relative to a fixed XYZ frame. The definition follows
-   // the description in the following textbook:
-   // M. W. Spong, and M. Vidyasagar, Robot Dynamics and Control, John 
-   // Wiley and Sons, ISBN: 047161243, 1989.
-   // <hr>NOTE: There are multiple solutions (combinations of angles) that
-   // result in the same rotation matrix, but are physically different 
-   // orientations. This function returns a solution corresponding to 
-   // cos(pitch) > 0, i.e., -pi/2 < pitch < pi/2. If the assumption that 
-   // cos(pitch) > 0 does not hold, incorrect solutions are returned. Beware of
-   // gimbal lock that happens when cos(pitch) = 0, in which case, the roll and 
-   // the yaw angles are indistinguishable.<hr> 
-   //  roll, pitch, yaw  The angles extracted from the transformation matrix.
-		
- private:
-};
-
-inline QMATHDLL_API Transform operator* (const Transform &firstTransfrom, const Transform &secondTransform);
- // Overloading binary operator * for multiplication between two transforms.
-
-inline Transform inverse(const Transform &t);
- //  return  The inverse of the transform \a t.
-
-inline QMATHDLL_API Transform translation(double x, double y, double z);
- //  return  A \a Transform representing a translation of \a x, \a y and \a z 
- //          units in the X, Y and Z directions.
-
-QMATHDLL_API Transform xRotation(double theta);
- //  return  A \a Transform representing a rotation of angle 
- //          \a theta radians about the X axis.
-
-QMATHDLL_API Transform yRotation(double theta);
- //  return  A \a Transform representing a rotation 
- //          of angle \a theta about the Y axis.
-
-QMATHDLL_API Transform zRotation(double theta);
- //  return  A \a Transform representing a rotation of angle 
- //          \a theta radians about the Z axis.
-
-QMATHDLL_API Transform vectorRotation(const ColumnVector<3, double> &vector, double theta);
- //  return  A \a Transform representing a rotation of angle \a theta 
- //          radians about an arbitrary vector \a vector (computed using
- //          Rodrigues formula.
-
-inline QMATHDLL_API Transform rpyRotation(double roll, double pitch, double yaw);
- // Sets the rotational part of the transform matrix from the 
- // \c roll, \c pitch and \c yaw angles as described in the following: 
- // M. W. Spong, and M. Vidyasagar, Robot Dynamics and Control, John Wiley and 
- // Sons, ISBN: 047161243, 1989. The rotational part
- // of the Transform matrix is obtained by first defining 
- // a rotation about X axis by \c yaw radians, then a rotation 
- // about the Y axis by \c pitch radians and finally a rotation 
- // about the Z axis by \c roll radians, all rotations being 
- // relative to a fixed XYZ frame.
- //  yaw	Rotation about the X axis.
- //  pitch	Successive rotation about the Y axis.
- //  roll	Successive rotation about the Z axis.
- //  return     A transformation matrix with the rotation matrix set.
-
-// ========== END OF INTERFACE ==========
-
-
-//============================================================= 
-// Transform::Transform: Constructor of the Transform class
-//=============================================================  
-Transform::Transform() : Matrix<4,4,double>()
-{
- for(int i = 0; i < 16; ++i)
-  d_element[i] = 0;
- d_element[0] = 1;
- d_element[5] = 1;
- d_element[10] = 1;
- d_element[15] = 1;
-}
-
-
-Transform::Transform(const Transform &t):Matrix<4,4,double>(t)
-{
-}
-
-
-//============================================================= 
-// Transform::operator=
-//=============================================================  
-MatrixInitializer<double> Transform::operator=(const double &elementValue)
-{
- return this->Matrix<4, 4, double>::operator=(elementValue);
-}
-
-
-//============================================================= 
-// Transform::getTranslation
-//=============================================================  
-ColumnVector<3,double> Transform::getTranslation() const
-{
- ColumnVector<3, double> translation;	 
- for (int i = 0; i < 3; ++i)
-  translation(i+1) = d_element[i * 4 + 3];
- return translation;
-}
-
-
-//============================================================= 
-// Transform::getRollPitchYaw
-//=============================================================  
-void Transform::getRollPitchYaw(double &roll, double &pitch, double &yaw) const
-{
- double cp;
- pitch = -asin(d_element[8]); //[2][0]
- cp = cos(pitch);
- if( finite(1.0/cp) ) {
-  yaw = atan2(d_element[9]/cp, d_element[10]/cp); // R32/R33
-  roll = atan2(d_element[4]/cp, d_element[0]/cp); // R21/R11
- } else { // gimbal lock
-  roll = 0;
-  yaw = atan2(d_element[1], d_element[2]); // R12/R13
- }
-}
-
-
-//============================================================= 
-// operator*
-//=============================================================  
-Transform operator* (const Transform &t1, const Transform &t2)
-{
- Transform p;
- for (int r = 1; r <= 4; ++r)
- {
-  for (int c = 1; c <= 4; ++c)
-  {
-   double s = 0;
-   for (int cd = 1; cd <= 4; ++cd)
-    s += t1.getElement(r, cd) * t2.getElement(cd, c);
-   p(r, c) = s;
-  }
- }
- return p;
-}
-
-
-//============================================================= 
-// inverse
-//=============================================================  
-Transform inverse(const Transform &transform)
-{
- Transform invertedTransform;
-
- Matrix<3,3,double> rotation;
- ColumnVector<3, double> position;
-
- position = transform.getTranslation();
- transform.getSubMatrix(1,1,rotation);
- invertedTransform.setSubMatrix(1,1,(transpose(rotation)));
- invertedTransform(1,4) = -dotProduct(position, rotation.getColumn(1));
- invertedTransform(2,4) = -dotProduct(position, rotation.getColumn(2));
- invertedTransform(3,4) = -dotProduct(position, rotation.getColumn(3));
-
- return invertedTransform;
-}
-
-
-//============================================================= 
-// translation
-//=============================================================  
-Transform translation(double x, double y, double z)
-{
- Transform translation;
- for (int row = 1; row <= 4; ++row)
- {
-  for (int column = 1; column <= 4; ++column)
-  { 
-   (row==column)?(translation(row,column)=1):(translation(row,column)=0);
-  }
- }
- translation(1,4) = x;
- translation(2,4) = y;
- translation(3,4) = z;
- return translation;
-}
-
-
-//============================================================= 
-// rpyRotation
-//=============================================================  
-Transform rpyRotation(double roll, double pitch, double yaw)
-{
- Transform rpyRotation;
- rpyRotation = (zRotation(roll) * yRotation(pitch)) * xRotation(yaw);
- return rpyRotation;
-}
-
-
-#endif
-
+//======================================================================== 
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Transform.hpp
+// Description          : Template class for homogeneous transformations
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+// 
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published 
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+// 
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+// 
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================  
+ 
+#ifndef INCLUDED_Transform_hpp
+#define INCLUDED_Transform_hpp
+
+#ifdef QMATH_DLL
+ #ifdef QMATH_DLL_EXPORT
+  #define QMATHDLL_API __declspec(dllexport)
+ #else
+  #define QMATHDLL_API __declspec(dllimport)
+ #endif
+#else
+ #define QMATHDLL_API
+#endif
+
+#include <float.h>
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+#include "RowVector.hpp"
+#include "FastMath.hpp"
+
+#ifdef _MSC_VER
+ #define finite(n) _finite(n)
+#endif
+
+
+//====================================================================
+// class TransformT
+// -------------------------------------------------------------------
+// \brief
+// The class \c TransformT represents a 4x4 homogeneous transformation
+// matrix with elements of type T. \c Transform is TransformT<double>.
+//
+// The functions that build transforms from angles and distances are
+// templates on the scalar type. Their scalar arguments do not take
+// part in template argument deduction (see NumericTraits::ScalarType),
+// so the type is given explicitly for other than double:
+// \code
+// TransformT<float> t = translation<float>(0.1, 0, 0.4) * rpyRotation<float>(0.3, 0, 0);
+// \endcode
+// Functions that take a transform or a vector deduce the type from it.
+// The double versions are prebuilt in libQMath, and are the ones
+// called when no type is given. A float transform holds half the bytes
+// of a double one, and the fast trigonometry (QMathTrig_fast) computes
+// the sines and cosines of eight float values for the cost of four
+// double ones.
+//
+// <b>Example Program:</b>
+// \include Transform.t.cpp
+//========================================================================
+
+template<class T = double>
+class TransformT : public Matrix <4, 4, T>
+{
+ public:
+  inline TransformT();
+   // The default constructor for the
+   // \c Transform object. The \c Transform
+   // matrix is initialized to the following form.
+   // \code
+   //	[1 0 0 0]
+   //	[0 1 0 0]
+   //	[0 0 1 0]
+   //	[0 0 0 1]
+   // \endcode
+
+  inline TransformT(const TransformT<T> &transform);
+   // Copy Constructor.
+
+  ~TransformT() {}
+   // The default destructor.
+
+  inline MatrixInitializer<T> operator=(const T &val);
+   // This function provides an overloaded assignment
+   // operator for initializing the elements of a Transform.
+   // The initialization of the Transform object can be
+   // done as a comma seperated list. For example:
+   // \code Transform myTransform;
+   // myTransform = cos(x), sin(x),...so on ; \endcode
+   //  val  The comma separated list of elements.
+
+  inline ColumnVector<3,T> getTranslation() const;
+   //  return  The position vector (last column) from the matrix.
+
+  inline void getRollPitchYaw(T &roll, T &pitch, T &yaw,
+                              QMathTrig_t trig = QMATH_TRIG) const;
+   // This function returns the roll (z), pitch (y) and yaw (x) angles from the
+   // homogeneous transformation matrix. The angles are defined as follows:
+   // The rotational part of the Transform matrix is obtained by
+   // first defining a rotation about X axis by \c yaw radians,
+   // then a rotation about the Y axis by \c pitch radians and
+   // finally a rotation about the Z axis by \c roll radians,
+   // all rotations being relative to a fixed XYZ frame. The definition follows
+   // the description in the following textbook:
+   // M. W. Spong, and M. Vidyasagar, Robot Dynamics and Control, John
+   // Wiley and Sons, ISBN: 047161243, 1989.
+   // <hr>NOTE: There are multiple solutions (combinations of angles) that
+   // result in the same rotation matrix, but are physically different
+   // orientations. This function returns a solution corresponding to
+   // cos(pitch) > 0, i.e., -pi/2 < pitch < pi/2. If the assumption that
+   // cos(pitch) > 0 does not hold, incorrect solutions are returned. Beware of
+   // gimbal lock that happens when cos(pitch) = 0, in which case, the roll and
+   // the yaw angles are indistinguishable.<hr>
+   //  roll, pitch, yaw  The angles extracted from the transformation matrix.
+   //  trig  With QMathTrig_fast, the three angles are computed together
+   //        by fastAtan2() (see FastMath.hpp), pitch as
+   //        atan2(-R31, sqrt(R11^2 + R21^2)), instead of by asin(), cos()
+   //        and two atan2().
+
+ private:
+};
+
+typedef TransformT<double> Transform;
+ // The transform of double elements.
+
+
+template<class T>
+inline TransformT<T> operator* (const TransformT<T> &firstTransfrom, const TransformT<T> &secondTransform);
+ // Overloading binary operator * for multiplication between two transforms.
+
+template<class T>
+inline TransformT<T> inverse(const TransformT<T> &t);
+ //  return  The inverse of the transform \a t.
+
+template<class T>
+inline TransformT<T> translation(typename NumericTraits<T>::ScalarType x,
+                                 typename NumericTraits<T>::ScalarType y,
+                                 typename NumericTraits<T>::ScalarType z);
+inline Transform translation(double x, double y, double z);
+ //  return  A \a Transform representing a translation of \a x, \a y and \a z
+ //          units in the X, Y and Z directions.
+
+template<class T>
+inline TransformT<T> xRotation(typename NumericTraits<T>::ScalarType theta);
+QMATHDLL_API Transform xRotation(double theta);
+ //  return  A \a Transform representing a rotation of angle
+ //          \a theta radians about the X axis.
+
+template<class T>
+inline TransformT<T> yRotation(typename NumericTraits<T>::ScalarType theta);
+QMATHDLL_API Transform yRotation(double theta);
+ //  return  A \a Transform representing a rotation
+ //          of angle \a theta about the Y axis.
+
+template<class T>
+inline TransformT<T> zRotation(typename NumericTraits<T>::ScalarType theta);
+QMATHDLL_API Transform zRotation(double theta);
+ //  return  A \a Transform representing a rotation of angle
+ //          \a theta radians about the Z axis.
+
+template<class T>
+inline TransformT<T> vectorRotation(const ColumnVector<3, T> &vector,
+                                    typename NumericTraits<T>::ScalarType theta,
+                                    QMathTrig_t trig = QMATH_TRIG);
+QMATHDLL_API Transform vectorRotation(const ColumnVector<3, double> &vector, double theta,
+                                      QMathTrig_t trig = QMATH_TRIG);
+ //  return  A \a Transform representing a rotation of angle \a theta
+ //          radians about an arbitrary vector \a vector (computed using
+ //          Rodrigues formula. The nine elements are computed in closed
+ //          form.
+
+template<class T>
+void vectorRotation(const ColumnVector<3, T> &vector, const T *theta,
+                    TransformT<T> *t, int count, QMathTrig_t trig = QMATH_TRIG);
+QMATHDLL_API void vectorRotation(const ColumnVector<3, double> &vector, const double *theta,
+                                 Transform *t, int count, QMathTrig_t trig = QMATH_TRIG);
+ // Computes t[i] = vectorRotation(vector, theta[i], trig) for i = 0 to
+ // count - 1, e.g. for the poses along a trajectory about a fixed axis.
+ // With QMathTrig_fast the sines and cosines are computed four at a time
+ // with fastSinCos() (see FastMath.hpp).
+
+template<class T>
+inline TransformT<T> rpyRotation(typename NumericTraits<T>::ScalarType roll,
+                                 typename NumericTraits<T>::ScalarType pitch,
+                                 typename NumericTraits<T>::ScalarType yaw,
+                                 QMathTrig_t trig = QMATH_TRIG);
+QMATHDLL_API Transform rpyRotation(double roll, double pitch, double yaw,
+                                   QMathTrig_t trig = QMATH_TRIG);
+ // Sets the rotational part of the transform matrix from the
+ // \c roll, \c pitch and \c yaw angles as described in the following:
+ // M. W. Spong, and M. Vidyasagar, Robot Dynamics and Control, John Wiley and
+ // Sons, ISBN: 047161243, 1989. The rotational part
+ // of the Transform matrix is obtained by first defining
+ // a rotation about X axis by \c yaw radians, then a rotation
+ // about the Y axis by \c pitch radians and finally a rotation
+ // about the Z axis by \c roll radians, all rotations being
+ // relative to a fixed XYZ frame.
+ //  yaw	Rotation about the X axis.
+ //  pitch	Successive rotation about the Y axis.
+ //  roll	Successive rotation about the Z axis.
+ //  return     A transformation matrix with the rotation matrix set.
+ // The nine elements are computed in closed form from one sine and
+ // cosine of each angle. With QMathTrig_fast (see FastMath.hpp) the
+ // sines and cosines of the three angles are computed together by
+ // fastSinCos(), otherwise by sinCos().
+
+template<class T>
+void rpyRotation(const T *roll, const T *pitch, const T *yaw,
+                 TransformT<T> *t, int count, QMathTrig_t trig = QMATH_TRIG);
+QMATHDLL_API void rpyRotation(const double *roll, const double *pitch, const double *yaw,
+                              Transform *t, int count, QMathTrig_t trig = QMATH_TRIG);
+ // Computes t[i] = rpyRotation(roll[i], pitch[i], yaw[i], trig) for i = 0
+ // to count - 1. With QMathTrig_fast the sines and cosines of four
+ // transforms are computed at a time.
+
+template<class T>
+void getRollPitchYaw(const TransformT<T> *t, T *roll, T *pitch, T *yaw,
+                     int count, QMathTrig_t trig = QMATH_TRIG);
+QMATHDLL_API void getRollPitchYaw(const Transform *t, double *roll, double *pitch, double *yaw,
+                                  int count, QMathTrig_t trig = QMATH_TRIG);
+ // Computes t[i].getRollPitchYaw(roll[i], pitch[i], yaw[i], trig) for
+ // i = 0 to count - 1. With QMathTrig_fast the angles of four
+ // transforms are computed at a time by fastAtan2().
+
+// ========== END OF INTERFACE ==========
+
+
+//=============================================================
+// TransformT::TransformT: Constructor of the TransformT class
+//=============================================================
+template<class T>
+TransformT<T>::TransformT() : Matrix<4,4,T>()
+{
+ for(int i = 0; i < 16; ++i)
+  this->d_element[i] = 0;
+ this->d_element[0] = 1;
+ this->d_element[5] = 1;
+ this->d_element[10] = 1;
+ this->d_element[15] = 1;
+}
+
+
+template<class T>
+TransformT<T>::TransformT(const TransformT<T> &t):Matrix<4,4,T>(t)
+{
+}
+
+
+//=============================================================
+// TransformT::operator=
+//=============================================================
+template<class T>
+MatrixInitializer<T> TransformT<T>::operator=(const T &elementValue)
+{
+ return this->Matrix<4, 4, T>::operator=(elementValue);
+}
+
+
+//=============================================================
+// TransformT::getTranslation
+//=============================================================
+template<class T>
+ColumnVector<3,T> TransformT<T>::getTranslation() const
+{
+ ColumnVector<3, T> translation;
+ for (int i = 0; i < 3; ++i)
+  translation(i+1) = this->d_element[i * 4 + 3];
+ return translation;
+}
+
+
+//=============================================================
+// TransformT::getRollPitchYaw
+//=============================================================
+template<class T>
+void TransformT<T>::getRollPitchYaw(T &roll, T &pitch, T &yaw, QMathTrig_t trig) const
+{
+ const T *e = this->d_element;
+ if(trig == QMathTrig_fast)
+ {
+  // cos(pitch) >= 0 as sqrt(R11^2 + R21^2); R12, R13 for yaw when it is 0
+  T cp = sqrt(e[0] * e[0] + e[4] * e[4]);
+  T a[4];
+  if(cp > 0)
+   fastAtan2(Simd4<T>::set(e[4], -e[8], e[9], 0),
+             Simd4<T>::set(e[0], cp, e[10], 1)).store(a);
+  else
+   fastAtan2(Simd4<T>::set(e[4], -e[8], e[1], 0),
+             Simd4<T>::set(e[0], cp, e[2], 1)).store(a);
+  roll = a[0];
+  pitch = a[1];
+  yaw = a[2];
+  return;
+ }
+
+ T cp;
+ pitch = -asin(e[8]); //[2][0]
+ cp = cos(pitch);
+ if( finite(1.0/cp) ) {
+  yaw = atan2(e[9]/cp, e[10]/cp); // R32/R33
+  roll = atan2(e[4]/cp, e[0]/cp); // R21/R11
+ } else { // gimbal lock
+  roll = 0;
+  yaw = atan2(e[1], e[2]); // R12/R13
+ }
+}
+
+
+//=============================================================
+// operator*
+//=============================================================
+template<class T>
+TransformT<T> operator* (const TransformT<T> &t1, const TransformT<T> &t2)
+{
+ TransformT<T> p;
+ for (int r = 1; r <= 4; ++r)
+ {
+  for (int c = 1; c <= 4; ++c)
+  {
+   T s = 0;
+   for (int cd = 1; cd <= 4; ++cd)
+    s += t1.getElement(r, cd) * t2.getElement(cd, c);
+   p(r, c) = s;
+  }
+ }
+ return p;
+}
+
+
+//=============================================================
+// inverse
+//=============================================================
+template<class T>
+TransformT<T> inverse(const TransformT<T> &transform)
+{
+ TransformT<T> invertedTransform;
+
+ Matrix<3,3,T> rotation;
+ ColumnVector<3, T> position;
+
+ position = transform.getTranslation();
+ transform.getSubMatrix(1,1,rotation);
+ invertedTransform.setSubMatrix(1,1,(transpose(rotation)));
+ invertedTransform(1,4) = -dotProduct(position, rotation.getColumn(1));
+ invertedTransform(2,4) = -dotProduct(position, rotation.getColumn(2));
+ invertedTransform(3,4) = -dotProduct(position, rotation.getColumn(3));
+
+ return invertedTransform;
+}
+
+
+//=============================================================
+// translation
+//=============================================================
+template<class T>
+TransformT<T> translation(typename NumericTraits<T>::ScalarType x,
+                          typename NumericTraits<T>::ScalarType y,
+                          typename NumericTraits<T>::ScalarType z)
+{
+ TransformT<T> translation;
+ translation(1,4) = x;
+ translation(2,4) = y;
+ translation(3,4) = z;
+ return translation;
+}
+
+Transform translation(double x, double y, double z)
+{
+ return translation<double>(x, y, z);
+}
+
+
+//=============================================================
+// TransformElements
+//   Internal. setRpyRotation() and setVectorRotation() write the
+//   rotation part of the elements e of a transform from the sines and
+//   cosines of the angles, leaving the rest of the elements as they
+//   are. setNoTranslation() writes the rest.
+//=============================================================
+template<class T>
+class TransformElements
+{
+ public:
+  static inline void setRpyRotation(T *e, T cr, T sr, T cp, T sp, T cy, T sy);
+  static inline void setNoTranslation(T *e);
+  static inline void setVectorRotation(T *e, const T *u, T c, T s);
+};
+
+
+template<class T>
+void TransformElements<T>::setRpyRotation(T *e, T cr, T sr, T cp, T sp, T cy, T sy)
+{
+ // Rz(roll) Ry(pitch) Rx(yaw)
+ e[0] = cr * cp;
+ e[1] = cr * sp * sy - sr * cy;
+ e[2] = cr * sp * cy + sr * sy;
+ e[4] = sr * cp;
+ e[5] = sr * sp * sy + cr * cy;
+ e[6] = sr * sp * cy - cr * sy;
+ e[8] = -sp;
+ e[9] = cp * sy;
+ e[10] = cp * cy;
+}
+
+template<class T>
+void TransformElements<T>::setNoTranslation(T *e)
+{
+ e[3] = 0;
+ e[7] = 0;
+ e[11] = 0;
+ e[12] = 0;
+ e[13] = 0;
+ e[14] = 0;
+ e[15] = 1;
+}
+
+template<class T>
+void TransformElements<T>::setVectorRotation(T *e, const T *u, T c, T s)
+{
+ // c I + s [u]x + (1 - c) u u'
+ T v = 1 - c;
+ T xv = u[0] * v, yv = u[1] * v, zv = u[2] * v;
+ T xs = u[0] * s, ys = u[1] * s, zs = u[2] * s;
+ T xy = u[0] * yv, xz = u[0] * zv, yz = u[1] * zv;
+ e[0] = c + u[0] * xv;
+ e[1] = xy - zs;
+ e[2] = xz + ys;
+ e[4] = xy + zs;
+ e[5] = c + u[1] * yv;
+ e[6] = yz - xs;
+ e[8] = xz - ys;
+ e[9] = yz + xs;
+ e[10] = c + u[2] * zv;
+}
+
+
+//=============================================================
+// xRotation
+//=============================================================
+template<class T>
+TransformT<T> xRotation(typename NumericTraits<T>::ScalarType theta)
+{
+ TransformT<T> xRotation;
+ T c, s;
+ sinCos(theta, s, c);
+ xRotation(1,1) = 1;
+ xRotation(2,2) = c;
+ xRotation(2,3) = -s;
+ xRotation(3,2) = -xRotation(2,3);
+ xRotation(3,3) = xRotation(2,2);
+ return xRotation;
+}
+
+
+//=============================================================
+// yRotation
+//=============================================================
+template<class T>
+TransformT<T> yRotation(typename NumericTraits<T>::ScalarType theta)
+{
+ TransformT<T> yRotation;
+ T c, s;
+ sinCos(theta, s, c);
+ yRotation(1,1) = c;
+ yRotation(1,3) = s;
+ yRotation(2,2) = 1;
+ yRotation(3,1) = -yRotation(1,3);
+ yRotation(3,3) = yRotation(1,1);
+ return yRotation;
+}
+
+
+//=============================================================
+// zRotation
+//=============================================================
+template<class T>
+TransformT<T> zRotation(typename NumericTraits<T>::ScalarType theta)
+{
+ TransformT<T> zRotation;
+ T c, s;
+ sinCos(theta, s, c);
+ zRotation(1,1) = c;
+ zRotation(1,2) = -s;
+ zRotation(2,1) = -zRotation(1,2);
+ zRotation(2,2) = zRotation(1,1);
+ zRotation(3,3) = 1;
+ return zRotation;
+}
+
+
+//=============================================================
+// vectorRotation
+//=============================================================
+template<class T>
+TransformT<T> vectorRotation(const ColumnVector<3, T> &u,
+                             typename NumericTraits<T>::ScalarType theta, QMathTrig_t trig)
+{
+ TransformT<T> t;
+ T c, s;
+ if(trig == QMathTrig_fast)
+ {
+  T a[4];
+  Simd4<T> sv, cv;
+  fastSinCos(Simd4<T>::broadcast(theta), sv, cv);
+  sv.store(a);
+  s = a[0];
+  cv.store(a);
+  c = a[0];
+ }
+ else
+  sinCos(theta, s, c);
+ TransformElements<T>::setVectorRotation(t.Matrix<4, 4, T>::getElementsPointer(),
+                                         u.Matrix<3, 1, T>::getElementsPointer(), c, s);
+ return t;
+}
+
+
+template<class T>
+void vectorRotation(const ColumnVector<3, T> &u, const T *theta,
+                    TransformT<T> *t, int count, QMathTrig_t trig)
+{
+ const T *v = u.Matrix<3, 1, T>::getElementsPointer();
+ int i = 0;
+ if(trig == QMathTrig_fast)
+  for(; i + 4 <= count; i += 4)
+  {
+   T c[4], s[4];
+   Simd4<T> sv, cv;
+   fastSinCos(Simd4<T>::load(theta + i), sv, cv);
+   sv.store(s);
+   cv.store(c);
+   for(int j = 0; j < 4; ++j)
+   {
+    T *e = t[i + j].Matrix<4, 4, T>::getElementsPointer();
+    TransformElements<T>::setVectorRotation(e, v, c[j], s[j]);
+    TransformElements<T>::setNoTranslation(e);
+   }
+  }
+ for(; i < count; ++i)
+  t[i] = vectorRotation<T>(u, theta[i], trig);
+}
+
+
+//=============================================================
+// rpyRotation
+//=============================================================
+template<class T>
+TransformT<T> rpyRotation(typename NumericTraits<T>::ScalarType roll,
+                          typename NumericTraits<T>::ScalarType pitch,
+                          typename NumericTraits<T>::ScalarType yaw, QMathTrig_t trig)
+{
+ TransformT<T> t;
+ T c[4], s[4];
+ if(trig == QMathTrig_fast)
+ {
+  Simd4<T> sv, cv;
+  fastSinCos(Simd4<T>::set(roll, pitch, yaw, 0), sv, cv);
+  sv.store(s);
+  cv.store(c);
+ }
+ else
+ {
+  sinCos(roll, s[0], c[0]);
+  sinCos(pitch, s[1], c[1]);
+  sinCos(yaw, s[2], c[2]);
+ }
+ TransformElements<T>::setRpyRotation(t.Matrix<4, 4, T>::getElementsPointer(),
+                                      c[0], s[0], c[1], s[1], c[2], s[2]);
+ return t;
+}
+
+
+template<class T>
+void rpyRotation(const T *roll, const T *pitch, const T *yaw,
+                 TransformT<T> *t, int count, QMathTrig_t trig)
+{
+ int i = 0;
+ if(trig == QMathTrig_fast)
+  for(; i + 4 <= count; i += 4)
+  {
+   T c[3][4], s[3][4];
+   Simd4<T> sv, cv;
+   fastSinCos(Simd4<T>::load(roll + i), sv, cv);
+   sv.store(s[0]);
+   cv.store(c[0]);
+   fastSinCos(Simd4<T>::load(pitch + i), sv, cv);
+   sv.store(s[1]);
+   cv.store(c[1]);
+   fastSinCos(Simd4<T>::load(yaw + i), sv, cv);
+   sv.store(s[2]);
+   cv.store(c[2]);
+   for(int j = 0; j < 4; ++j)
+   {
+    T *e = t[i + j].Matrix<4, 4, T>::getElementsPointer();
+    TransformElements<T>::setRpyRotation(e, c[0][j], s[0][j], c[1][j], s[1][j],
+                                         c[2][j], s[2][j]);
+    TransformElements<T>::setNoTranslation(e);
+   }
+  }
+ for(; i < count; ++i)
+  t[i] = rpyRotation<T>(roll[i], pitch[i], yaw[i], trig);
+}
+
+
+//=============================================================
+// getRollPitchYaw
+//   The fast version takes four transforms at a time, one per
+//   lane, as in TransformT::getRollPitchYaw.
+//=============================================================
+template<class T>
+void getRollPitchYaw(const TransformT<T> *t, T *roll, T *pitch, T *yaw,
+                     int count, QMathTrig_t trig)
+{
+ typedef Simd4<T> S;
+ int i = 0;
+ if(trig == QMathTrig_fast)
+  for(; i + 4 <= count; i += 4)
+  {
+   const T *a = t[i].Matrix<4, 4, T>::getElementsPointer();
+   const T *b = t[i + 1].Matrix<4, 4, T>::getElementsPointer();
+   const T *c = t[i + 2].Matrix<4, 4, T>::getElementsPointer();
+   const T *d = t[i + 3].Matrix<4, 4, T>::getElementsPointer();
+   S r11 = S::set(a[0], b[0], c[0], d[0]), r21 = S::set(a[4], b[4], c[4], d[4]);
+   S cp = (r11 * r11 + r21 * r21).sqrt();
+   S lock = S::broadcast(1) - cp.greater(S::broadcast(0));
+   S r32 = S::set(a[9], b[9], c[9], d[9]), r33 = S::set(a[10], b[10], c[10], d[10]);
+   S r12 = S::set(a[1], b[1], c[1], d[1]), r13 = S::set(a[2], b[2], c[2], d[2]);
+   fastAtan2(r21, r11).store(roll + i);
+   fastAtan2(S::set(-a[8], -b[8], -c[8], -d[8]), cp).store(pitch + i);
+   fastAtan2(r32 + lock * (r12 - r32), r33 + lock * (r13 - r33)).store(yaw + i);
+  }
+ for(; i < count; ++i)
+  t[i].getRollPitchYaw(roll[i], pitch[i], yaw[i], trig);
+}
+
+
+#endif
@@ -0,0 +1,346 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Unroll.hpp
+// Description          : Compile-time unrolled kernels on raw storage
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_Unroll_hpp
+#define INCLUDED_Unroll_hpp
+
+#include <math.h>
+#include "NumericTraits.hpp"
+
+#ifndef QMATH_UNROLL_LIMIT
+#define QMATH_UNROLL_LIMIT 64
+#endif
+ // Largest number of scalar operations that a kernel expands into
+ // straight-line code. Kernels on larger matrices use ordinary loops.
+ // Define before including any QMath header to change it; 0 disables
+ // unrolling.
+
+//========================================================================
+// Unrolled kernels
+// -----------------------------------------------------------------------
+// \brief
+// This file is used internally by the library. The classes below
+// implement the element loops of Matrix and the vector classes on the
+// row-major element storage. Since all dimensions are template
+// parameters, each kernel is expanded by template recursion into a
+// sequence of statements with constant offsets, without a loop counter
+// or a branch, when the operation count is at most QMATH_UNROLL_LIMIT.
+// Above that limit the same kernel is a plain loop. In both cases the
+// elements are accessed directly rather than through the virtual,
+// bounds-checked element accessors. Elements are visited in the same
+// order as the loops, so the results do not depend on the limit.
+//
+// The template parameter n of each kernel is the number of elements
+// still to be processed; the recursion ends at n = 0.
+//========================================================================
+
+//------------------------------------------------------------------------
+// UnrolledLoop: element-wise operations on n contiguous elements.
+//------------------------------------------------------------------------
+template<int n, bool unrolled = (n <= QMATH_UNROLL_LIMIT)>
+class UnrolledLoop
+{
+ public:
+  template<class X, class Y>
+  static inline void copy(X *d, const Y *s)
+  { d[0] = s[0]; UnrolledLoop<n - 1, true>::copy(d + 1, s + 1); }
+
+  template<class X, class Y>
+  static inline void fill(X *d, const Y &v)
+  { d[0] = v; UnrolledLoop<n - 1, true>::fill(d + 1, v); }
+
+  template<class X>
+  static inline void add(X *d, const X *s)
+  { d[0] += s[0]; UnrolledLoop<n - 1, true>::add(d + 1, s + 1); }
+
+  template<class X>
+  static inline void subtract(X *d, const X *s)
+  { d[0] -= s[0]; UnrolledLoop<n - 1, true>::subtract(d + 1, s + 1); }
+
+  template<class X, class Y>
+  static inline void scale(X *d, const Y &v)
+  { d[0] *= v; UnrolledLoop<n - 1, true>::scale(d + 1, v); }
+
+  template<class X>
+  static inline void multiply(X *d, const X *a, const X *b)
+  { d[0] = a[0] * b[0]; UnrolledLoop<n - 1, true>::multiply(d + 1, a + 1, b + 1); }
+   // Element-wise product d = a .* b.
+
+  template<class A, class X>
+  static inline void absSum(A &acc, const X *a)
+  { acc += (A)fabs(a[0]); UnrolledLoop<n - 1, true>::absSum(acc, a + 1); }
+   // acc += sum of |a[i]|.
+
+  template<class X>
+  static inline void absMax(X &m, const X *a)
+  { m = (fabs(a[0]) > m) ? (X)fabs(a[0]) : m; UnrolledLoop<n - 1, true>::absMax(m, a + 1); }
+   // m = max(m, |a[i]|).
+};
+
+template<>
+class UnrolledLoop<0, true>
+{
+ public:
+  template<class X, class Y> static inline void copy(X *, const Y *) {}
+  template<class X, class Y> static inline void fill(X *, const Y &) {}
+  template<class X> static inline void add(X *, const X *) {}
+  template<class X> static inline void subtract(X *, const X *) {}
+  template<class X, class Y> static inline void scale(X *, const Y &) {}
+  template<class X> static inline void multiply(X *, const X *, const X *) {}
+  template<class A, class X> static inline void absSum(A &, const X *) {}
+  template<class X> static inline void absMax(X &, const X *) {}
+};
+
+template<int n>
+class UnrolledLoop<n, false>
+{
+ public:
+  template<class X, class Y>
+  static inline void copy(X *d, const Y *s)
+  { for(int i = 0; i < n; ++i) d[i] = s[i]; }
+
+  template<class X, class Y>
+  static inline void fill(X *d, const Y &v)
+  { for(int i = 0; i < n; ++i) d[i] = v; }
+
+  template<class X>
+  static inline void add(X *d, const X *s)
+  { for(int i = 0; i < n; ++i) d[i] += s[i]; }
+
+  template<class X>
+  static inline void subtract(X *d, const X *s)
+  { for(int i = 0; i < n; ++i) d[i] -= s[i]; }
+
+  template<class X, class Y>
+  static inline void scale(X *d, const Y &v)
+  { for(int i = 0; i < n; ++i) d[i] *= v; }
+
+  template<class X>
+  static inline void multiply(X *d, const X *a, const X *b)
+  { for(int i = 0; i < n; ++i) d[i] = a[i] * b[i]; }
+
+  template<class A, class X>
+  static inline void absSum(A &acc, const X *a)
+  { for(int i = 0; i < n; ++i) acc += (A)fabs(a[i]); }
+
+  template<class X>
+  static inline void absMax(X &m, const X *a)
+  { for(int i = 0; i < n; ++i) m = (fabs(a[i]) > m) ? (X)fabs(a[i]) : m; }
+};
+
+
+//------------------------------------------------------------------------
+// UnrolledDot: acc += sum of a[i * sa] * b[i * sb] for i = 0..n-1.
+//------------------------------------------------------------------------
+template<int n, int sa, int sb, bool unrolled = (n <= QMATH_UNROLL_LIMIT)>
+class UnrolledDot
+{
+ public:
+  template<class A, class X>
+  static inline void dot(A &acc, const X *a, const X *b)
+  {
+   acc += (A)a[0] * b[0];
+   UnrolledDot<n - 1, sa, sb, true>::dot(acc, a + sa, b + sb);
+  }
+};
+
+template<int sa, int sb>
+class UnrolledDot<0, sa, sb, true>
+{
+ public:
+  template<class A, class X>
+  static inline void dot(A &, const X *, const X *) {}
+};
+
+template<int n, int sa, int sb>
+class UnrolledDot<n, sa, sb, false>
+{
+ public:
+  template<class A, class X>
+  static inline void dot(A &acc, const X *a, const X *b)
+  {
+   for(int i = 0; i < n; ++i)
+    acc += (A)a[i * sa] * b[i * sb];
+  }
+};
+
+
+//------------------------------------------------------------------------
+// UnrolledNorm: the p-norm (sum of |a[i]|^p)^(1/p) of n contiguous
+// elements, with sums accumulated in NumericTraits<X>::AccumulatorType.
+//------------------------------------------------------------------------
+template<int n, int p>
+class UnrolledNorm
+{
+ public:
+  template<class X>
+  static inline X norm(const X *a)
+  {
+   typedef typename NumericTraits<X>::AccumulatorType A;
+   A acc = 0;
+   for(int i = 0; i < n; ++i)
+   {
+    A x = (A)fabs(a[i]);
+    A xp = x;
+    for(int k = 1; k < p; ++k)
+     xp *= x;
+    acc += xp;
+   }
+   return (X)pow(acc, (A)1 / p);
+  }
+};
+
+template<int n>
+class UnrolledNorm<n, 1>
+{
+ public:
+  template<class X>
+  static inline X norm(const X *a)
+  {
+   typename NumericTraits<X>::AccumulatorType acc = 0;
+   UnrolledLoop<n>::absSum(acc, a);
+   return (X)acc;
+  }
+};
+
+template<int n>
+class UnrolledNorm<n, 2>
+{
+ public:
+  template<class X>
+  static inline X norm(const X *a)
+  {
+   typename NumericTraits<X>::AccumulatorType acc = 0;
+   UnrolledDot<n, 1, 1>::dot(acc, a, a);
+   return (X)sqrt(acc);
+  }
+};
+
+
+//------------------------------------------------------------------------
+// UnrolledProduct: p = a * b for an (r1 x c1r2) matrix a and a
+// (c1r2 x c2) matrix b. p must not overlap a or b.
+//------------------------------------------------------------------------
+template<int r1, int c1r2, int c2, int n = r1 * c2,
+         bool unrolled = (r1 * c1r2 * c2 <= QMATH_UNROLL_LIMIT)>
+class UnrolledProduct
+{
+ public:
+  template<class X>
+  static inline void multiply(X *p, const X *a, const X *b)
+  {
+   const int e = r1 * c2 - n;
+   typename NumericTraits<X>::AccumulatorType acc = 0;
+   UnrolledDot<c1r2, 1, c2, true>::dot(acc, a + (e / c2) * c1r2, b + (e % c2));
+   p[e] = (X)acc;
+   UnrolledProduct<r1, c1r2, c2, n - 1, true>::multiply(p, a, b);
+  }
+};
+
+template<int r1, int c1r2, int c2>
+class UnrolledProduct<r1, c1r2, c2, 0, true>
+{
+ public:
+  template<class X>
+  static inline void multiply(X *, const X *, const X *) {}
+};
+
+template<int r1, int c1r2, int c2, int n>
+class UnrolledProduct<r1, c1r2, c2, n, false>
+{
+ public:
+  template<class X>
+  static inline void multiply(X *p, const X *a, const X *b)
+  {
+   typedef typename NumericTraits<X>::AccumulatorType A;
+   for(int r = 0; r < r1; ++r)
+    for(int c = 0; c < c2; ++c)
+    {
+     A acc = 0;
+     for(int k = 0; k < c1r2; ++k)
+      acc += (A)a[r * c1r2 + k] * b[k * c2 + c];
+     p[r * c2 + c] = (X)acc;
+    }
+  }
+};
+
+
+//------------------------------------------------------------------------
+// UnrolledBlock: copies a (rows x cols) block between two row-major
+// arrays with row strides ds (destination) and ss (source). Used for
+// transposition (ds = 1 in the column direction) and sub-matrices.
+//------------------------------------------------------------------------
+template<int rows, int cols, int ds, int ss, int n = rows * cols,
+         bool unrolled = (rows * cols <= QMATH_UNROLL_LIMIT)>
+class UnrolledBlock
+{
+ public:
+  template<class X, class Y>
+  static inline void copy(X *d, const Y *s)
+  {
+   const int e = rows * cols - n;
+   d[(e / cols) * ds + (e % cols)] = s[(e / cols) * ss + (e % cols)];
+   UnrolledBlock<rows, cols, ds, ss, n - 1, true>::copy(d, s);
+  }
+
+  template<class X, class Y>
+  static inline void transpose(X *d, const Y *s)
+  {
+   const int e = rows * cols - n;
+   d[(e % cols) * rows + (e / cols)] = s[e];
+   UnrolledBlock<rows, cols, ds, ss, n - 1, true>::transpose(d, s);
+  }
+   // d (cols x rows) = transpose of s (rows x cols). Strides are unused.
+};
+
+template<int rows, int cols, int ds, int ss>
+class UnrolledBlock<rows, cols, ds, ss, 0, true>
+{
+ public:
+  template<class X, class Y> static inline void copy(X *, const Y *) {}
+  template<class X, class Y> static inline void transpose(X *, const Y *) {}
+};
+
+template<int rows, int cols, int ds, int ss, int n>
+class UnrolledBlock<rows, cols, ds, ss, n, false>
+{
+ public:
+  template<class X, class Y>
+  static inline void copy(X *d, const Y *s)
+  {
+   for(int r = 0; r < rows; ++r)
+    for(int c = 0; c < cols; ++c)
+     d[r * ds + c] = s[r * ss + c];
+  }
+
+  template<class X, class Y>
+  static inline void transpose(X *d, const Y *s)
+  {
+   for(int r = 0; r < rows; ++r)
+    for(int c = 0; c < cols; ++c)
+     d[c * rows + r] = s[r * cols + c];
+  }
+};
+
+
+#endif
@@ -0,0 +1,454 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Vec3.hpp
+// Description          : Compact 3-vector for geometry
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_Vec3_hpp
+#define INCLUDED_Vec3_hpp
+
+#include <iostream>
+#include <math.h>
+#include "Simd.hpp"
+#include "FastMath.hpp"
+#include "Transform.hpp"
+
+//====================================================================
+// class Vec3
+// -------------------------------------------------------------------
+// \brief
+// A compact 3-vector for geometric computations in tight loops.
+//
+// Unlike \c ColumnVector<3>, a \c Vec3 has no virtual functions and no
+// base classes: it is just the three elements followed by a fourth,
+// always zero, padding element. The padding lets every operation load
+// and process the vector as one group of four lanes (SSE for float,
+// SSE2 or AVX2 for double, see Simd.hpp), so that sums, products, dot
+// and cross products are short sequences of SIMD instructions. Element
+// access is not range checked. Use the explicit conversions to and from
+// \c ColumnVector<3> to combine it with the rest of the library, and the
+// functions at the end of this file to apply a \c Transform.
+//
+// <b>Example Program:</b>
+// \include Vec3.t.cpp
+//========================================================================
+
+template<class T = double>
+class QMATH_ALIGN16 Vec3
+{
+ public:
+  inline Vec3() { d_element[3] = 0; }
+   // The default constructor. The elements are not initialized.
+
+  inline Vec3(const T &x, const T &y, const T &z);
+   // Constructs the vector (x, y, z).
+
+  inline explicit Vec3(const ColumnVector<3, T> &v);
+   // Conversion from a \c ColumnVector.
+
+  inline ColumnVector<3, T> toColumnVector() const;
+   //  return  The vector as a \c ColumnVector.
+
+  inline T x() const { return d_element[0]; }
+  inline T y() const { return d_element[1]; }
+  inline T z() const { return d_element[2]; }
+  inline T &x() { return d_element[0]; }
+  inline T &y() { return d_element[1]; }
+  inline T &z() { return d_element[2]; }
+   // Access or assign the elements.
+
+  inline T operator()(int index) const { return d_element[index - 1]; }
+  inline T &operator()(int index) { return d_element[index - 1]; }
+   // Access or assign the element at the position specified by index
+   // (1, 2 or 3, not checked).
+
+  inline const T *getElementsPointer() const { return d_element; }
+  inline T *getElementsPointer() { return d_element; }
+   //  return  A pointer to the four elements (x, y, z, 0). The fourth
+   //          element must remain zero.
+
+  inline Vec3<T> &operator+=(const Vec3<T> &v);
+  inline Vec3<T> &operator-=(const Vec3<T> &v);
+   // Element-wise addition and subtraction.
+
+  inline Vec3<T> &operator*=(const typename NumericTraits<T>::ScalarType &s);
+   // Multiplication by a scalar.
+
+  inline Vec3<T> &operator/=(const typename NumericTraits<T>::ScalarType &s);
+   // Division by a scalar. Throws a divideByZero exception if |s| is
+   // less than NumericTraits<T>::epsilon().
+
+  inline T squaredNorm() const;
+   //  return  The sum of the squares of the elements.
+
+  inline T norm() const;
+   //  return  The 2-norm of the vector.
+
+  inline Vec3<T> &normalize();
+   // Scales the vector to unit 2-norm. Throws a divideByZero exception
+   // if the norm is less than NumericTraits<T>::epsilon().
+   //  return  Reference to this vector.
+
+  inline Vec3<T> normalized() const;
+   //  return  The vector scaled to unit 2-norm. See normalize().
+
+  inline Vec3<T> &fastNormalize();
+   // Same as normalize(), but scales by fastInverseSqrt() of the squared
+   // norm. See FastMath.hpp for the accuracy.
+
+ private:
+  T d_element[4];                                          // x, y, z, 0
+};
+
+template<class T>
+inline Vec3<T> operator+(const Vec3<T> &a, const Vec3<T> &b);
+template<class T>
+inline Vec3<T> operator-(const Vec3<T> &a, const Vec3<T> &b);
+template<class T>
+inline Vec3<T> operator-(const Vec3<T> &a);
+ // Element-wise sum, difference and negation.
+
+template<class T>
+inline Vec3<T> operator*(const Vec3<T> &v, const typename NumericTraits<T>::ScalarType &s);
+template<class T>
+inline Vec3<T> operator*(const typename NumericTraits<T>::ScalarType &s, const Vec3<T> &v);
+template<class T>
+inline Vec3<T> operator/(const Vec3<T> &v, const typename NumericTraits<T>::ScalarType &s);
+ // Multiplication and division by a scalar.
+
+template<class T>
+inline T dotProduct(const Vec3<T> &a, const Vec3<T> &b);
+ //  return  The dot (inner) product of \a a and \a b.
+
+template<class T>
+inline Vec3<T> crossProduct(const Vec3<T> &a, const Vec3<T> &b);
+ //  return  The cross product of \a a and \a b.
+
+template<class T>
+inline Vec3<T> elementProduct(const Vec3<T> &a, const Vec3<T> &b);
+ //  return  The element-by-element product of \a a and \a b.
+
+template<class T>
+std::ostream &operator<<(std::ostream &out, const Vec3<T> &v);
+ // Writes the elements separated by spaces.
+
+template<class T>
+inline Vec3<T> operator*(const TransformT<T> &t, const Vec3<T> &p);
+ //  return  The point \a p transformed by \a t (rotation and translation).
+
+template<class T>
+inline Vec3<T> rotate(const TransformT<T> &t, const Vec3<T> &v);
+ //  return  The direction \a v rotated by the rotational part of \a t.
+
+template<class T>
+inline Vec3<T> translationOf(const TransformT<T> &t);
+ //  return  The translation (last column) of \a t.
+
+template<class T>
+inline TransformT<T> translation(const Vec3<T> &d);
+ //  return  A \a Transform representing a translation by \a d.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// Vec3::Vec3
+//========================================================================
+template<class T>
+Vec3<T>::Vec3(const T &x, const T &y, const T &z)
+{
+ Simd4<T>::set(x, y, z, 0).store(d_element);
+}
+
+template<class T>
+Vec3<T>::Vec3(const ColumnVector<3, T> &v)
+{
+ const T *p = v.Matrix<3, 1, T>::getElementsPointer();
+ Simd4<T>::set(p[0], p[1], p[2], 0).store(d_element);
+}
+
+
+//========================================================================
+// Vec3::toColumnVector
+//========================================================================
+template<class T>
+ColumnVector<3, T> Vec3<T>::toColumnVector() const
+{
+ ColumnVector<3, T> v;
+ T *p = v.Matrix<3, 1, T>::getElementsPointer();
+ p[0] = d_element[0];
+ p[1] = d_element[1];
+ p[2] = d_element[2];
+ return v;
+}
+
+
+//========================================================================
+// Vec3::operator+=, operator-=, operator*=, operator/=
+//========================================================================
+template<class T>
+Vec3<T> &Vec3<T>::operator+=(const Vec3<T> &v)
+{
+ (Simd4<T>::load(d_element) + Simd4<T>::load(v.d_element)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec3<T> &Vec3<T>::operator-=(const Vec3<T> &v)
+{
+ (Simd4<T>::load(d_element) - Simd4<T>::load(v.d_element)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec3<T> &Vec3<T>::operator*=(const typename NumericTraits<T>::ScalarType &s)
+{
+ (Simd4<T>::load(d_element) * Simd4<T>::broadcast(s)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec3<T> &Vec3<T>::operator/=(const typename NumericTraits<T>::ScalarType &s)
+{
+ if(fabs(s) < NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ (Simd4<T>::load(d_element) * Simd4<T>::broadcast((T)1 / s)).store(d_element);
+ return *this;
+}
+
+
+//========================================================================
+// Vec3::squaredNorm, Vec3::norm
+//========================================================================
+template<class T>
+T Vec3<T>::squaredNorm() const
+{
+ Simd4<T> v = Simd4<T>::load(d_element);
+ return (v * v).sum();
+}
+
+template<class T>
+T Vec3<T>::norm() const
+{
+ return sqrt(squaredNorm());
+}
+
+
+//========================================================================
+// Vec3::normalize, Vec3::normalized, Vec3::fastNormalize
+//========================================================================
+template<class T>
+Vec3<T> &Vec3<T>::normalize()
+{
+ Simd4<T> v = Simd4<T>::load(d_element);
+ T n = sqrt((v * v).sum());
+ if(n < NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ (v * Simd4<T>::broadcast((T)1 / n)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec3<T> Vec3<T>::normalized() const
+{
+ Vec3<T> v(*this);
+ return v.normalize();
+}
+
+template<class T>
+Vec3<T> &Vec3<T>::fastNormalize()
+{
+ const T eps = NumericTraits<T>::epsilon();
+ Simd4<T> v = Simd4<T>::load(d_element);
+ T n2 = (v * v).sum();
+ if(n2 < eps * eps)
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ (v * Simd4<T>::broadcast(fastInverseSqrt(n2))).store(d_element);
+ return *this;
+}
+
+
+//========================================================================
+// operator+, operator-
+//========================================================================
+template<class T>
+Vec3<T> operator+(const Vec3<T> &a, const Vec3<T> &b)
+{
+ Vec3<T> r;
+ (Simd4<T>::load(a.getElementsPointer()) + Simd4<T>::load(b.getElementsPointer()))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec3<T> operator-(const Vec3<T> &a, const Vec3<T> &b)
+{
+ Vec3<T> r;
+ (Simd4<T>::load(a.getElementsPointer()) - Simd4<T>::load(b.getElementsPointer()))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec3<T> operator-(const Vec3<T> &a)
+{
+ Vec3<T> r;
+ (Simd4<T>::broadcast(0) - Simd4<T>::load(a.getElementsPointer())).store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// operator*, operator/
+//========================================================================
+template<class T>
+Vec3<T> operator*(const Vec3<T> &v, const typename NumericTraits<T>::ScalarType &s)
+{
+ Vec3<T> r;
+ (Simd4<T>::load(v.getElementsPointer()) * Simd4<T>::broadcast(s)).store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec3<T> operator*(const typename NumericTraits<T>::ScalarType &s, const Vec3<T> &v)
+{
+ return v * s;
+}
+
+template<class T>
+Vec3<T> operator/(const Vec3<T> &v, const typename NumericTraits<T>::ScalarType &s)
+{
+ Vec3<T> r(v);
+ r /= s;
+ return r;
+}
+
+
+//========================================================================
+// dotProduct
+//========================================================================
+template<class T>
+T dotProduct(const Vec3<T> &a, const Vec3<T> &b)
+{
+ return (Simd4<T>::load(a.getElementsPointer()) * Simd4<T>::load(b.getElementsPointer())).sum();
+}
+
+
+//========================================================================
+// crossProduct
+//========================================================================
+template<class T>
+Vec3<T> crossProduct(const Vec3<T> &a, const Vec3<T> &b)
+{
+ // a * (b1, b2, b0) - (a1, a2, a0) * b is (c2, c0, c1, 0)
+ Simd4<T> va = Simd4<T>::load(a.getElementsPointer());
+ Simd4<T> vb = Simd4<T>::load(b.getElementsPointer());
+ Vec3<T> r;
+ (va * vb.rotate() - va.rotate() * vb).rotate().store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// elementProduct
+//========================================================================
+template<class T>
+Vec3<T> elementProduct(const Vec3<T> &a, const Vec3<T> &b)
+{
+ Vec3<T> r;
+ (Simd4<T>::load(a.getElementsPointer()) * Simd4<T>::load(b.getElementsPointer()))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// operator<<
+//========================================================================
+template<class T>
+std::ostream &operator<<(std::ostream &out, const Vec3<T> &v)
+{
+ out << v.x() << " " << v.y() << " " << v.z();
+ return out;
+}
+
+
+//========================================================================
+// operator* (Transform, Vec3)
+//========================================================================
+template<class T>
+Vec3<T> operator*(const TransformT<T> &t, const Vec3<T> &p)
+{
+ typedef Simd4<T> S;
+ const T *m = t.Matrix<4, 4, T>::getElementsPointer();
+ S h = S::load(p.getElementsPointer()) + S::set(0, 0, 0, 1);
+ Vec3<T> r;
+ S::sums(S::load(m) * h, S::load(m + 4) * h, S::load(m + 8) * h, S::broadcast(0))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// rotate
+//========================================================================
+template<class T>
+Vec3<T> rotate(const TransformT<T> &t, const Vec3<T> &v)
+{
+ typedef Simd4<T> S;
+ const T *m = t.Matrix<4, 4, T>::getElementsPointer();
+ S u = S::load(v.getElementsPointer());
+ Vec3<T> r;
+ S::sums(S::load(m) * u, S::load(m + 4) * u, S::load(m + 8) * u, S::broadcast(0))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// translationOf, translation
+//========================================================================
+template<class T>
+Vec3<T> translationOf(const TransformT<T> &t)
+{
+ const T *m = t.Matrix<4, 4, T>::getElementsPointer();
+ return Vec3<T>(m[3], m[7], m[11]);
+}
+
+template<class T>
+TransformT<T> translation(const Vec3<T> &d)
+{
+ return translation<T>(d.x(), d.y(), d.z());
+}
+
+
+#endif
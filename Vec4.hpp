@@ -0,0 +1,367 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Vec4.hpp
+// Description          : Compact 4-vector for geometry
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_Vec4_hpp
+#define INCLUDED_Vec4_hpp
+
+#include "Vec3.hpp"
+
+//====================================================================
+// class Vec4
+// -------------------------------------------------------------------
+// \brief
+// A compact 4-vector, such as a point in homogeneous coordinates. Like
+// \c Vec3, it has no virtual functions, its elements fill one group of
+// four SIMD lanes, and element access is not range checked.
+//
+// <b>Example Program: </b>See the example of the class \c Vec3.
+//========================================================================
+
+template<class T = double>
+class QMATH_ALIGN16 Vec4
+{
+ public:
+  inline Vec4() {}
+   // The default constructor. The elements are not initialized.
+
+  inline Vec4(const T &x, const T &y, const T &z, const T &w);
+   // Constructs the vector (x, y, z, w).
+
+  inline Vec4(const Vec3<T> &v, const T &w);
+   // Constructs the vector (v, w), e.g. w = 1 for a point and w = 0
+   // for a direction.
+
+  inline explicit Vec4(const ColumnVector<4, T> &v);
+   // Conversion from a \c ColumnVector.
+
+  inline ColumnVector<4, T> toColumnVector() const;
+   //  return  The vector as a \c ColumnVector.
+
+  inline Vec3<T> toVec3() const;
+   //  return  The first three elements.
+
+  inline T x() const { return d_element[0]; }
+  inline T y() const { return d_element[1]; }
+  inline T z() const { return d_element[2]; }
+  inline T w() const { return d_element[3]; }
+  inline T &x() { return d_element[0]; }
+  inline T &y() { return d_element[1]; }
+  inline T &z() { return d_element[2]; }
+  inline T &w() { return d_element[3]; }
+   // Access or assign the elements.
+
+  inline T operator()(int index) const { return d_element[index - 1]; }
+  inline T &operator()(int index) { return d_element[index - 1]; }
+   // Access or assign the element at the position specified by index
+   // (1 to 4, not checked).
+
+  inline const T *getElementsPointer() const { return d_element; }
+  inline T *getElementsPointer() { return d_element; }
+   //  return  A pointer to the four elements.
+
+  inline Vec4<T> &operator+=(const Vec4<T> &v);
+  inline Vec4<T> &operator-=(const Vec4<T> &v);
+   // Element-wise addition and subtraction.
+
+  inline Vec4<T> &operator*=(const typename NumericTraits<T>::ScalarType &s);
+   // Multiplication by a scalar.
+
+  inline Vec4<T> &operator/=(const typename NumericTraits<T>::ScalarType &s);
+   // Division by a scalar. Throws a divideByZero exception if |s| is
+   // less than NumericTraits<T>::epsilon().
+
+  inline T squaredNorm() const;
+   //  return  The sum of the squares of the elements.
+
+  inline T norm() const;
+   //  return  The 2-norm of the vector.
+
+  inline Vec4<T> &normalize();
+   // Scales the vector to unit 2-norm. Throws a divideByZero exception
+   // if the norm is less than NumericTraits<T>::epsilon().
+   //  return  Reference to this vector.
+
+  inline Vec4<T> normalized() const;
+   //  return  The vector scaled to unit 2-norm. See normalize().
+
+ private:
+  T d_element[4];
+};
+
+template<class T>
+inline Vec4<T> operator+(const Vec4<T> &a, const Vec4<T> &b);
+template<class T>
+inline Vec4<T> operator-(const Vec4<T> &a, const Vec4<T> &b);
+template<class T>
+inline Vec4<T> operator-(const Vec4<T> &a);
+ // Element-wise sum, difference and negation.
+
+template<class T>
+inline Vec4<T> operator*(const Vec4<T> &v, const typename NumericTraits<T>::ScalarType &s);
+template<class T>
+inline Vec4<T> operator*(const typename NumericTraits<T>::ScalarType &s, const Vec4<T> &v);
+template<class T>
+inline Vec4<T> operator/(const Vec4<T> &v, const typename NumericTraits<T>::ScalarType &s);
+ // Multiplication and division by a scalar.
+
+template<class T>
+inline T dotProduct(const Vec4<T> &a, const Vec4<T> &b);
+ //  return  The dot (inner) product of \a a and \a b.
+
+template<class T>
+inline Vec4<T> elementProduct(const Vec4<T> &a, const Vec4<T> &b);
+ //  return  The element-by-element product of \a a and \a b.
+
+template<class T>
+std::ostream &operator<<(std::ostream &out, const Vec4<T> &v);
+ // Writes the elements separated by spaces.
+
+inline Vec4<double> operator*(const Transform &t, const Vec4<double> &p);
+ //  return  The product of the 4x4 matrix \a t and \a p.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// Vec4::Vec4
+//========================================================================
+template<class T>
+Vec4<T>::Vec4(const T &x, const T &y, const T &z, const T &w)
+{
+ Simd4<T>::set(x, y, z, w).store(d_element);
+}
+
+template<class T>
+Vec4<T>::Vec4(const Vec3<T> &v, const T &w)
+{
+ (Simd4<T>::load(v.getElementsPointer()) + Simd4<T>::set(0, 0, 0, w)).store(d_element);
+}
+
+template<class T>
+Vec4<T>::Vec4(const ColumnVector<4, T> &v)
+{
+ Simd4<T>::load(v.Matrix<4, 1, T>::getElementsPointer()).store(d_element);
+}
+
+
+//========================================================================
+// Vec4::toColumnVector, Vec4::toVec3
+//========================================================================
+template<class T>
+ColumnVector<4, T> Vec4<T>::toColumnVector() const
+{
+ ColumnVector<4, T> v;
+ Simd4<T>::load(d_element).store(v.Matrix<4, 1, T>::getElementsPointer());
+ return v;
+}
+
+template<class T>
+Vec3<T> Vec4<T>::toVec3() const
+{
+ return Vec3<T>(d_element[0], d_element[1], d_element[2]);
+}
+
+
+//========================================================================
+// Vec4::operator+=, operator-=, operator*=, operator/=
+//========================================================================
+template<class T>
+Vec4<T> &Vec4<T>::operator+=(const Vec4<T> &v)
+{
+ (Simd4<T>::load(d_element) + Simd4<T>::load(v.d_element)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec4<T> &Vec4<T>::operator-=(const Vec4<T> &v)
+{
+ (Simd4<T>::load(d_element) - Simd4<T>::load(v.d_element)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec4<T> &Vec4<T>::operator*=(const typename NumericTraits<T>::ScalarType &s)
+{
+ (Simd4<T>::load(d_element) * Simd4<T>::broadcast(s)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec4<T> &Vec4<T>::operator/=(const typename NumericTraits<T>::ScalarType &s)
+{
+ if(fabs(s) < NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ (Simd4<T>::load(d_element) * Simd4<T>::broadcast((T)1 / s)).store(d_element);
+ return *this;
+}
+
+
+//========================================================================
+// Vec4::squaredNorm, Vec4::norm
+//========================================================================
+template<class T>
+T Vec4<T>::squaredNorm() const
+{
+ Simd4<T> v = Simd4<T>::load(d_element);
+ return (v * v).sum();
+}
+
+template<class T>
+T Vec4<T>::norm() const
+{
+ return sqrt(squaredNorm());
+}
+
+
+//========================================================================
+// Vec4::normalize, Vec4::normalized
+//========================================================================
+template<class T>
+Vec4<T> &Vec4<T>::normalize()
+{
+ Simd4<T> v = Simd4<T>::load(d_element);
+ T n = sqrt((v * v).sum());
+ if(n < NumericTraits<T>::epsilon())
+ {
+  static MathException exception;
+  exception.setErrorType(QMathException_divideByZero);
+  throw exception;
+ }
+ (v * Simd4<T>::broadcast((T)1 / n)).store(d_element);
+ return *this;
+}
+
+template<class T>
+Vec4<T> Vec4<T>::normalized() const
+{
+ Vec4<T> v(*this);
+ return v.normalize();
+}
+
+
+//========================================================================
+// operator+, operator-
+//========================================================================
+template<class T>
+Vec4<T> operator+(const Vec4<T> &a, const Vec4<T> &b)
+{
+ Vec4<T> r;
+ (Simd4<T>::load(a.getElementsPointer()) + Simd4<T>::load(b.getElementsPointer()))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec4<T> operator-(const Vec4<T> &a, const Vec4<T> &b)
+{
+ Vec4<T> r;
+ (Simd4<T>::load(a.getElementsPointer()) - Simd4<T>::load(b.getElementsPointer()))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec4<T> operator-(const Vec4<T> &a)
+{
+ Vec4<T> r;
+ (Simd4<T>::broadcast(0) - Simd4<T>::load(a.getElementsPointer())).store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// operator*, operator/
+//========================================================================
+template<class T>
+Vec4<T> operator*(const Vec4<T> &v, const typename NumericTraits<T>::ScalarType &s)
+{
+ Vec4<T> r;
+ (Simd4<T>::load(v.getElementsPointer()) * Simd4<T>::broadcast(s)).store(r.getElementsPointer());
+ return r;
+}
+
+template<class T>
+Vec4<T> operator*(const typename NumericTraits<T>::ScalarType &s, const Vec4<T> &v)
+{
+ return v * s;
+}
+
+template<class T>
+Vec4<T> operator/(const Vec4<T> &v, const typename NumericTraits<T>::ScalarType &s)
+{
+ Vec4<T> r(v);
+ r /= s;
+ return r;
+}
+
+
+//========================================================================
+// dotProduct, elementProduct
+//========================================================================
+template<class T>
+T dotProduct(const Vec4<T> &a, const Vec4<T> &b)
+{
+ return (Simd4<T>::load(a.getElementsPointer()) * Simd4<T>::load(b.getElementsPointer())).sum();
+}
+
+template<class T>
+Vec4<T> elementProduct(const Vec4<T> &a, const Vec4<T> &b)
+{
+ Vec4<T> r;
+ (Simd4<T>::load(a.getElementsPointer()) * Simd4<T>::load(b.getElementsPointer()))
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+//========================================================================
+// operator<<
+//========================================================================
+template<class T>
+std::ostream &operator<<(std::ostream &out, const Vec4<T> &v)
+{
+ out << v.x() << " " << v.y() << " " << v.z() << " " << v.w();
+ return out;
+}
+
+
+//========================================================================
+// operator* (Transform, Vec4)
+//========================================================================
+Vec4<double> operator*(const Transform &t, const Vec4<double> &p)
+{
+ typedef Simd4<double> S;
+ const double *m = t.Matrix<4, 4, double>::getElementsPointer();
+ S v = S::load(p.getElementsPointer());
+ Vec4<double> r;
+ S::sums(S::load(m) * v, S::load(m + 4) * v, S::load(m + 8) * v, S::load(m + 12) * v)
+  .store(r.getElementsPointer());
+ return r;
+}
+
+
+#endif
@@ -0,0 +1,493 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : VectorBatch.hpp
+// Description          : Operations on arrays of 3-vectors
+//
+// Copyright (C) 2000 Vilas Chitrakaran
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation; either version 2 of the License, or (at
+// your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+//========================================================================
+
+#ifndef INCLUDED_VectorBatch_hpp
+#define INCLUDED_VectorBatch_hpp
+
+#include "Simd.hpp"
+#include "ColumnVector.hpp"
+
+#ifndef QMATH_BATCH_CHUNK
+#define QMATH_BATCH_CHUNK 256
+#endif
+ // Number of vectors handed to a processor core at a time by the
+ // functions below.
+
+//========================================================================
+// Batched vector operations
+// -----------------------------------------------------------------------
+// \brief
+// Cross, dot and element products and 2-norms for arrays of 3-vectors,
+// such as the points and normals of a point cloud.
+//
+// Each function takes the vectors either in structure-of-arrays form,
+// as three arrays x[], y[] and z[] of the components, or as an array of
+// \c ColumnVector<3,T>. The former is the faster layout: four vectors
+// are loaded, computed and stored at a time with SIMD instructions (see
+// Simd.hpp). In an array of \c ColumnVector the elements of each vector
+// follow a pointer to its virtual function table, and assembling them
+// into SIMD registers costs more than it saves. Those arrays are
+// therefore processed one vector at a time, directly on the element
+// storage. When the library is compiled with OpenMP (e.g. -fopenmp with
+// GCC, or useomp=yes with the makefiles of the examples), the arrays are
+// split into chunks of QMATH_BATCH_CHUNK vectors that are distributed
+// across processor cores.
+//
+// The results may be written over either operand (e.g. cx == ax,
+// cy == ay and cz == az), but must not otherwise overlap them.
+//
+// <b>Example Program:</b>
+// \include VectorBatch.t.cpp
+//========================================================================
+
+template<class T>
+void crossProduct(const T *ax, const T *ay, const T *az,
+                  const T *bx, const T *by, const T *bz,
+                  T *cx, T *cy, T *cz, int count);
+template<class T>
+void crossProduct(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                  ColumnVector<3, T> *c, int count);
+ // Computes c[i] = a[i] x b[i] for i = 0 to count - 1.
+ // Example:
+ // \code
+ // double tx[1000], ty[1000], tz[1000];   // tangents
+ // double bx[1000], by[1000], bz[1000];   // bitangents
+ // double nx[1000], ny[1000], nz[1000];   // normals
+ // crossProduct(tx, ty, tz, bx, by, bz, nx, ny, nz, 1000);
+ // \endcode
+
+template<class T>
+void dotProduct(const T *ax, const T *ay, const T *az,
+                const T *bx, const T *by, const T *bz, T *d, int count);
+template<class T>
+void dotProduct(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                T *d, int count);
+ // Computes d[i] = a[i] . b[i] for i = 0 to count - 1.
+
+template<class T>
+void elementProduct(const T *ax, const T *ay, const T *az,
+                    const T *bx, const T *by, const T *bz,
+                    T *cx, T *cy, T *cz, int count);
+template<class T>
+void elementProduct(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                    ColumnVector<3, T> *c, int count);
+ // Computes the element-by-element products c[i] = a[i] .* b[i] for
+ // i = 0 to count - 1.
+
+template<class T>
+void norm(const T *x, const T *y, const T *z, T *n, int count);
+template<class T>
+void norm(const ColumnVector<3, T> *v, T *n, int count);
+ // Computes the 2-norms n[i] = |v[i]| for i = 0 to count - 1.
+
+// ========== END OF INTERFACE ==========
+
+
+//========================================================================
+// BatchVector3
+//   Internal. Single threaded kernels for the functions above, working
+//   on n vectors. In structure-of-arrays form, groups of four vectors
+//   are processed with Simd4. The last incomplete group is copied into
+//   zero-padded arrays of four and processed the same way, so that every
+//   vector is computed with the same rounding.
+//========================================================================
+template<class T>
+class BatchVector3
+{
+ public:
+  enum { C = QMATH_BATCH_CHUNK };
+
+  static void cross(const T *ax, const T *ay, const T *az,
+                    const T *bx, const T *by, const T *bz,
+                    T *cx, T *cy, T *cz, int n);
+  static void dot(const T *ax, const T *ay, const T *az,
+                  const T *bx, const T *by, const T *bz, T *d, int n);
+  static void element(const T *ax, const T *ay, const T *az,
+                      const T *bx, const T *by, const T *bz,
+                      T *cx, T *cy, T *cz, int n);
+  static void norm(const T *x, const T *y, const T *z, T *d, int n);
+
+  static void cross(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                    ColumnVector<3, T> *c, int n);
+  static void dot(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b, T *d, int n);
+  static void element(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                      ColumnVector<3, T> *c, int n);
+  static void norm(const ColumnVector<3, T> *v, T *d, int n);
+
+ private:
+  static void pad(const T *src, int n, T *dst);
+   // Copies n < 4 elements and zero fills the rest of dst[4].
+};
+
+
+//========================================================================
+// BatchVector3::pad
+//========================================================================
+template<class T>
+void BatchVector3<T>::pad(const T *src, int n, T *dst)
+{
+ for(int i = 0; i < 4; ++i)
+  dst[i] = (i < n) ? src[i] : 0;
+}
+
+
+//========================================================================
+// BatchVector3::cross
+//========================================================================
+template<class T>
+void BatchVector3<T>::cross(const T *ax, const T *ay, const T *az,
+                            const T *bx, const T *by, const T *bz,
+                            T *cx, T *cy, T *cz, int n)
+{
+ typedef Simd4<T> S;
+ int i;
+ for(i = 0; i + 4 <= n; i += 4)
+ {
+  S x1 = S::load(ax + i), y1 = S::load(ay + i), z1 = S::load(az + i);
+  S x2 = S::load(bx + i), y2 = S::load(by + i), z2 = S::load(bz + i);
+  (y1 * z2 - z1 * y2).store(cx + i);
+  (z1 * x2 - x1 * z2).store(cy + i);
+  (x1 * y2 - y1 * x2).store(cz + i);
+ }
+ if(i < n)
+ {
+  T t[9][4];
+  int j, m = n - i;
+  pad(ax + i, m, t[0]); pad(ay + i, m, t[1]); pad(az + i, m, t[2]);
+  pad(bx + i, m, t[3]); pad(by + i, m, t[4]); pad(bz + i, m, t[5]);
+  cross(t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7], t[8], 4);
+  for(j = 0; j < m; ++j)
+  {
+   cx[i + j] = t[6][j];
+   cy[i + j] = t[7][j];
+   cz[i + j] = t[8][j];
+  }
+ }
+}
+
+
+//========================================================================
+// BatchVector3::dot
+//========================================================================
+template<class T>
+void BatchVector3<T>::dot(const T *ax, const T *ay, const T *az,
+                          const T *bx, const T *by, const T *bz, T *d, int n)
+{
+ typedef Simd4<T> S;
+ int i;
+ for(i = 0; i + 4 <= n; i += 4)
+  (S::load(ax + i) * S::load(bx + i) + S::load(ay + i) * S::load(by + i)
+   + S::load(az + i) * S::load(bz + i)).store(d + i);
+ if(i < n)
+ {
+  T t[7][4];
+  int j, m = n - i;
+  pad(ax + i, m, t[0]); pad(ay + i, m, t[1]); pad(az + i, m, t[2]);
+  pad(bx + i, m, t[3]); pad(by + i, m, t[4]); pad(bz + i, m, t[5]);
+  dot(t[0], t[1], t[2], t[3], t[4], t[5], t[6], 4);
+  for(j = 0; j < m; ++j)
+   d[i + j] = t[6][j];
+ }
+}
+
+
+//========================================================================
+// BatchVector3::element
+//========================================================================
+template<class T>
+void BatchVector3<T>::element(const T *ax, const T *ay, const T *az,
+                              const T *bx, const T *by, const T *bz,
+                              T *cx, T *cy, T *cz, int n)
+{
+ typedef Simd4<T> S;
+ int i;
+ for(i = 0; i + 4 <= n; i += 4)
+ {
+  (S::load(ax + i) * S::load(bx + i)).store(cx + i);
+  (S::load(ay + i) * S::load(by + i)).store(cy + i);
+  (S::load(az + i) * S::load(bz + i)).store(cz + i);
+ }
+ for(; i < n; ++i)
+ {
+  cx[i] = ax[i] * bx[i];
+  cy[i] = ay[i] * by[i];
+  cz[i] = az[i] * bz[i];
+ }
+}
+
+
+//========================================================================
+// BatchVector3::norm
+//========================================================================
+template<class T>
+void BatchVector3<T>::norm(const T *x, const T *y, const T *z, T *d, int n)
+{
+ typedef Simd4<T> S;
+ int i;
+ for(i = 0; i + 4 <= n; i += 4)
+ {
+  S x1 = S::load(x + i), y1 = S::load(y + i), z1 = S::load(z + i);
+  (x1 * x1 + y1 * y1 + z1 * z1).sqrt().store(d + i);
+ }
+ if(i < n)
+ {
+  T t[4][4];
+  int j, m = n - i;
+  pad(x + i, m, t[0]); pad(y + i, m, t[1]); pad(z + i, m, t[2]);
+  norm(t[0], t[1], t[2], t[3], 4);
+  for(j = 0; j < m; ++j)
+   d[i + j] = t[3][j];
+ }
+}
+
+
+//========================================================================
+// BatchVector3::cross, dot, element, norm (arrays of ColumnVector)
+//========================================================================
+template<class T>
+void BatchVector3<T>::cross(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                            ColumnVector<3, T> *c, int n)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  const T *p = a[i].Matrix<3, 1, T>::getElementsPointer(); // static calls
+  const T *q = b[i].Matrix<3, 1, T>::getElementsPointer();
+  T x = p[1] * q[2] - p[2] * q[1];
+  T y = p[2] * q[0] - p[0] * q[2];
+  T z = p[0] * q[1] - p[1] * q[0];
+  T *r = c[i].Matrix<3, 1, T>::getElementsPointer();
+  r[0] = x;
+  r[1] = y;
+  r[2] = z;
+ }
+}
+
+template<class T>
+void BatchVector3<T>::dot(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                          T *d, int n)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  const T *p = a[i].Matrix<3, 1, T>::getElementsPointer();
+  const T *q = b[i].Matrix<3, 1, T>::getElementsPointer();
+  d[i] = p[0] * q[0] + p[1] * q[1] + p[2] * q[2];
+ }
+}
+
+template<class T>
+void BatchVector3<T>::element(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                              ColumnVector<3, T> *c, int n)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  const T *p = a[i].Matrix<3, 1, T>::getElementsPointer();
+  const T *q = b[i].Matrix<3, 1, T>::getElementsPointer();
+  T *r = c[i].Matrix<3, 1, T>::getElementsPointer();
+  r[0] = p[0] * q[0];
+  r[1] = p[1] * q[1];
+  r[2] = p[2] * q[2];
+ }
+}
+
+template<class T>
+void BatchVector3<T>::norm(const ColumnVector<3, T> *v, T *d, int n)
+{
+ for(int i = 0; i < n; ++i)
+ {
+  const T *p = v[i].Matrix<3, 1, T>::getElementsPointer();
+  d[i] = sqrt(p[0] * p[0] + p[1] * p[1] + p[2] * p[2]);
+ }
+}
+
+
+//========================================================================
+// crossProduct
+//========================================================================
+template<class T>
+void crossProduct(const T *ax, const T *ay, const T *az,
+                  const T *bx, const T *by, const T *bz,
+                  T *cx, T *cy, T *cz, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::cross(ax + i, ay + i, az + i, bx + i, by + i, bz + i,
+                cx + i, cy + i, cz + i, n);
+ }
+}
+
+template<class T>
+void crossProduct(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                  ColumnVector<3, T> *c, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::cross(a + i, b + i, c + i, n);
+ }
+}
+
+
+//========================================================================
+// dotProduct
+//========================================================================
+template<class T>
+void dotProduct(const T *ax, const T *ay, const T *az,
+                const T *bx, const T *by, const T *bz, T *d, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::dot(ax + i, ay + i, az + i, bx + i, by + i, bz + i, d + i, n);
+ }
+}
+
+template<class T>
+void dotProduct(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                T *d, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::dot(a + i, b + i, d + i, n);
+ }
+}
+
+
+//========================================================================
+// elementProduct
+//========================================================================
+template<class T>
+void elementProduct(const T *ax, const T *ay, const T *az,
+                    const T *bx, const T *by, const T *bz,
+                    T *cx, T *cy, T *cz, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::element(ax + i, ay + i, az + i, bx + i, by + i, bz + i,
+                  cx + i, cy + i, cz + i, n);
+ }
+}
+
+template<class T>
+void elementProduct(const ColumnVector<3, T> *a, const ColumnVector<3, T> *b,
+                    ColumnVector<3, T> *c, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int n = (count - i < C) ? (count - i) : C;
+  Kernel::element(a + i, b + i, c + i, n);
+ }
+}
+
+
+//========================================================================
+// norm
+//========================================================================
+template<class T>
+void norm(const T *x, const T *y, const T *z, T *n, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int m = (count - i < C) ? (count - i) : C;
+  Kernel::norm(x + i, y + i, z + i, n + i, m);
+ }
+}
+
+template<class T>
+void norm(const ColumnVector<3, T> *v, T *n, int count)
+{
+ typedef BatchVector3<T> Kernel;
+ const int C = Kernel::C;
+ const int chunks = (count + C - 1) / C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+ for(int k = 0; k < chunks; ++k)
+ {
+  int i = k * C;
+  int m = (count - i < C) ? (count - i) : C;
+  Kernel::norm(v + i, n + i, m);
+ }
+}
+
+
+#endif
@@ -0,0 +1,67 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Benchmark.hpp
+// Description          : Timing utilities shared by the benchmark programs.
+//========================================================================
+
+#ifndef INCLUDED_Benchmark_hpp
+#define INCLUDED_Benchmark_hpp
+
+#include <iostream>
+#include <iomanip>
+#include <stdio.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+ #include <time.h>
+#else
+ #include <sys/time.h>
+#endif
+
+//========================================================================
+// class Stopwatch
+// -----------------------------------------------------------------------
+// \brief
+// Wall clock timer. Wall clock time (rather than processor time) is
+// measured so that multi-threaded benchmarks report real throughput.
+//========================================================================
+class Stopwatch
+{
+ public:
+  Stopwatch() { start(); }
+  void start() { d_start = now(); }
+  double elapsed() const { return now() - d_start; }
+   //  return  Seconds since start().
+
+ private:
+  static double now()
+  {
+#if defined(_WIN32)
+   return (double)clock() / CLOCKS_PER_SEC;
+#else
+   struct timeval tv;
+   gettimeofday(&tv, 0);
+   return tv.tv_sec + 1e-6 * tv.tv_usec;
+#endif
+  }
+  double d_start;
+};
+
+
+//========================================================================
+// report
+//   Prints one line of a benchmark table: the operation name, the
+//   number of operations per second and the time per operation.
+//========================================================================
+inline void report(const char *name, long operations, double seconds)
+{
+ if(seconds <= 0) seconds = 1e-9;
+ std::cout << std::setw(40) << std::left << name << std::right
+           << std::setw(12) << std::setprecision(4) << (operations / seconds) * 1e-6 << " Mop/s"
+           << std::setw(12) << std::setprecision(4) << (seconds / operations) * 1e9 << " ns/op"
+           << std::endl;
+}
+
+
+#endif
@@ -0,0 +1,112 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Elementwise.b.cpp
+// Description          : Reductions and element-by-element functions
+//                        against scalar loops.
+//========================================================================
+
+#include "Elementwise.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program computes the sum, the largest element, and the sine and
+// exponential of the elements of arrays of 1024 doubles and floats,
+// first with scalar loops calling the standard library, then with the
+// functions of Elementwise.hpp. Pass the number of passes over the
+// array as the first argument.
+//========================================================================
+
+volatile double sink;
+
+template<class T>
+void run(long passes, const char *type)
+{
+ const int count = 1024;
+ char name[64];
+ T *x = new T[count];
+ T *y = new T[count];
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+  x[i] = (T)(5 * sin(0.37 * i));
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  T s = 0, m = x[0];
+  for(i = 0; i < count; ++i)
+  {
+   s += x[i];
+   m = (x[i] > m) ? x[i] : m;
+  }
+  acc += s + m;
+ }
+ sprintf(name, "%s sum and max, loop", type);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+  acc += elementSum(x, count) + elementMax(x, count);
+ sprintf(name, "%s sum and max, Elementwise", type);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   y[i] = sin(x[i]);
+  acc += y[p & 1023];
+ }
+ sprintf(name, "%s sin, loop", type);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  elementSin(x, y, count);
+  acc += y[p & 1023];
+ }
+ sprintf(name, "%s sin, elementSin", type);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   y[i] = exp(x[i]);
+  acc += y[p & 1023];
+ }
+ sprintf(name, "%s exp, loop", type);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  elementExp(x, y, count);
+  acc += y[p & 1023];
+ }
+ sprintf(name, "%s exp, elementExp", type);
+ report(name, passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] x;
+ delete [] y;
+}
+
+
+int main(int argc, char **argv)
+{
+ long passes = 2000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ run<double>(passes, "double");
+ run<float>(passes, "float");
+ return 0;
+}
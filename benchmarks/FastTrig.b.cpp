@@ -0,0 +1,142 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FastTrig.b.cpp
+// Description          : Rotations and roll-pitch-yaw extraction with
+//                        the C library against the fast trigonometry.
+//========================================================================
+
+#include "Transform.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program builds the rotations of a trajectory of 1024 roll, pitch
+// and yaw angles with rpyRotation() and extracts the angles back with
+// getRollPitchYaw(), one at a time and batched, with QMathTrig_exact
+// and with QMathTrig_fast, then batched in float (TransformT<float>),
+// and prints the largest differences of the fast results from the
+// exact ones. Near pitch = +-pi/2 the fast angles
+// are the more accurate, as asin() is ill-conditioned there. Pass the
+// number of passes over the trajectory as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int count = 1024;
+ long passes = 500;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ double *roll = new double[6 * count];
+ double *pitch = roll + count, *yaw = roll + 2 * count;
+ double *r = roll + 3 * count, *p = roll + 4 * count, *y = roll + 5 * count;
+ Transform *t = new Transform[count];
+ Transform *exact = new Transform[count];
+ double acc = 0, rotationError = 0, angleError = 0;
+ long pass;
+ int i, j, k;
+
+ for(i = 0; i < count; ++i)
+ {
+  roll[i] = 0.006 * i - 3;
+  pitch[i] = 1.5 - 0.003 * i;
+  yaw[i] = 0.005 * i - 2;
+ }
+ QMathTrig_t trig[2] = {QMathTrig_exact, QMathTrig_fast};
+ const char *name[2] = {"exact", "fast"};
+
+ for(k = 0; k < 2; ++k)
+ {
+  Stopwatch watch;
+  for(pass = 0; pass < passes; ++pass)
+  {
+   for(i = 0; i < count; ++i)
+    t[i] = rpyRotation(roll[i], pitch[i], yaw[i], trig[k]);
+   acc += t[pass & 1023](1, 2);
+  }
+  report((string("rpyRotation, ") + name[k]).c_str(), passes * count, watch.elapsed());
+
+  watch.start();
+  for(pass = 0; pass < passes; ++pass)
+  {
+   rpyRotation(roll, pitch, yaw, t, count, trig[k]);
+   acc += t[pass & 1023](1, 2);
+  }
+  report((string("rpyRotation, batched, ") + name[k]).c_str(), passes * count, watch.elapsed());
+
+  watch.start();
+  for(pass = 0; pass < passes; ++pass)
+  {
+   for(i = 0; i < count; ++i)
+    t[i].getRollPitchYaw(r[i], p[i], y[i], trig[k]);
+   acc += r[pass & 1023];
+  }
+  report((string("getRollPitchYaw, ") + name[k]).c_str(), passes * count, watch.elapsed());
+
+  watch.start();
+  for(pass = 0; pass < passes; ++pass)
+  {
+   getRollPitchYaw(t, r, p, y, count, trig[k]);
+   acc += r[pass & 1023];
+  }
+  report((string("getRollPitchYaw, batched, ") + name[k]).c_str(), passes * count, watch.elapsed());
+
+  if(k == 0)
+   for(i = 0; i < count; ++i)
+    exact[i] = t[i];
+ }
+
+ float *froll = new float[6 * count];
+ float *fpitch = froll + count, *fyaw = froll + 2 * count;
+ float *fr = froll + 3 * count, *fp = froll + 4 * count, *fy = froll + 5 * count;
+ TransformT<float> *ft = new TransformT<float>[count];
+ for(i = 0; i < 6 * count; ++i)
+  froll[i] = (float)roll[i];
+ for(k = 0; k < 2; ++k)
+ {
+  Stopwatch watch;
+  for(pass = 0; pass < passes; ++pass)
+  {
+   rpyRotation(froll, fpitch, fyaw, ft, count, trig[k]);
+   acc += ft[pass & 1023](1, 2);
+  }
+  report((string("rpyRotation, batched, float, ") + name[k]).c_str(), passes * count, watch.elapsed());
+
+  watch.start();
+  for(pass = 0; pass < passes; ++pass)
+  {
+   getRollPitchYaw(ft, fr, fp, fy, count, trig[k]);
+   acc += fr[pass & 1023];
+  }
+  report((string("getRollPitchYaw, batched, float, ") + name[k]).c_str(), passes * count, watch.elapsed());
+ }
+ delete [] froll;
+ delete [] ft;
+
+ // t now holds the fast rotations, r, p, y the fast angles
+ for(i = 0; i < count; ++i)
+ {
+  double er, ep, ey;
+  exact[i].getRollPitchYaw(er, ep, ey, QMathTrig_exact);
+  if(fabs(r[i] - er) > angleError) angleError = fabs(r[i] - er);
+  if(fabs(p[i] - ep) > angleError) angleError = fabs(p[i] - ep);
+  if(fabs(y[i] - ey) > angleError) angleError = fabs(y[i] - ey);
+  for(j = 1; j <= 3; ++j)
+   for(int c = 1; c <= 3; ++c)
+    if(fabs(t[i](j, c) - exact[i](j, c)) > rotationError)
+     rotationError = fabs(t[i](j, c) - exact[i](j, c));
+ }
+ cout << "largest difference of the fast rotations: " << rotationError << endl;
+ cout << "largest difference of the fast angles: " << angleError << endl;
+
+ sink = acc;
+ delete [] roll;
+ delete [] t;
+ delete [] exact;
+ return 0;
+}
@@ -0,0 +1,106 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FrameGraph.b.cpp
+// Description          : Frame lookups composed by hand against
+//                        FrameGraph and FrameLookup.
+//========================================================================
+
+#include "FrameGraph.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program builds a tree of 200 frames (the parent of frame k is
+// frame k / 2, so paths are about seven edges long), records 32 poses
+// of every edge, and looks up the pose of one leaf relative to another:
+// first by composing the newest poses by hand as Transform, then with
+// FrameGraph::getTransform() for the newest poses and at a time between
+// recorded poses, and with a FrameLookup when nothing changes between
+// lookups and when one edge on the path is updated before every lookup.
+// Pass the number of lookups as the first argument.
+//========================================================================
+
+volatile double sink;
+
+const int n = 200;
+Transform edgePose(int k, double t)
+{
+ return translation(0.1 * k, 0.01 * t, 0.2) * rpyRotation(0.01 * k + 0.001 * t, 0.2, -0.1);
+}
+
+int main(int argc, char **argv)
+{
+ long lookups = 200000;
+ if(argc > 1)
+  lookups = atol(argv[1]);
+
+ FrameGraph<n> *graph = new FrameGraph<n>;
+ Transform *newest = new Transform[n + 1];
+ int k, j;
+ long c;
+ for(k = 2; k <= n; ++k)
+ {
+  graph->setParent(k, k / 2);
+  for(j = 0; j < 32; ++j)
+   graph->setTransform(k, j, edgePose(k, j));
+  newest[k] = edgePose(k, 31);
+ }
+ const int a = 150, b = 199;
+ double acc = 0;
+ Transform pose;
+
+ Stopwatch watch;
+ for(c = 0; c < lookups; ++c)
+ {
+  Transform ta, tb;
+  for(k = a; k > 1; k /= 2)
+   ta = newest[k] * ta;
+  for(k = b; k > 1; k /= 2)
+   tb = newest[k] * tb;
+  pose = inverse(ta) * tb;
+  acc += pose(1, 4);
+ }
+ report("composed by hand, newest", lookups, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < lookups; ++c)
+ {
+  graph->getTransform(a, b, pose);
+  acc += pose(1, 4);
+ }
+ report("FrameGraph, newest", lookups, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < lookups; ++c)
+ {
+  graph->getTransform(a, b, 20.5 + 1e-6 * (c % 1000), pose);
+  acc += pose(1, 4);
+ }
+ report("FrameGraph, interpolated", lookups, watch.elapsed());
+
+ FrameLookup<n> lookup(*graph);
+ watch.start();
+ for(c = 0; c < lookups; ++c)
+ {
+  lookup.getTransform(a, b, pose);
+  acc += pose(1, 4);
+ }
+ report("FrameLookup, newest, unchanged", lookups, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < lookups; ++c)
+ {
+  graph->setTransform(b, 32 + c, edgePose(b, 31));
+  lookup.getTransform(a, b, pose);
+  acc += pose(1, 4);
+ }
+ report("FrameLookup, newest, leaf updated", lookups, watch.elapsed());
+
+ sink = acc;
+ delete graph;
+ delete [] newest;
+ return 0;
+}
@@ -0,0 +1,145 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : KinematicChain.b.cpp
+// Description          : Forward kinematics with elementary transforms
+//                        against KinematicChain.
+//========================================================================
+
+#include "KinematicChain.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program computes the forward kinematics of a six-joint arm, as a
+// control loop would: first by chaining zRotation(), translation() and
+// xRotation() every cycle, then with KinematicChain when all joints
+// move and when only the last joint moves, and for a batch of
+// configurations with getTransforms(). It then builds the Jacobian from
+// the frame transforms with getSubMatrix(), crossProduct() and
+// setSubMatrix(), and with getJacobian(). KinematicChainOmp.b is
+// compiled with OpenMP and shares the batch among cores. Pass the
+// number of cycles as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ long cycles = 200000;
+ if(argc > 1)
+  cycles = atol(argv[1]);
+
+ const double a[6] = {0, 0.4318, 0.0203, 0, 0, 0};
+ const double alpha[6] = {M_PI / 2, 0, -M_PI / 2, M_PI / 2, -M_PI / 2, 0};
+ const double d[6] = {0, 0, 0.15005, 0.4318, 0, 0};
+ KinematicChain<6> arm;
+ ColumnVector<6> q;
+ double acc = 0;
+ long c;
+ int i;
+
+ for(i = 1; i <= 6; ++i)
+ {
+  arm.setLink(i, a[i - 1], alpha[i - 1], d[i - 1], 0);
+  q(i) = 0.1 * i;
+ }
+
+ Stopwatch watch;
+ for(c = 0; c < cycles; ++c)
+ {
+  Transform t;
+  q(1) = q(6) = 1e-6 * c;
+  for(i = 0; i < 6; ++i)
+   t = t * zRotation(q(i + 1)) * translation(0, 0, d[i]) * translation(a[i], 0, 0) * xRotation(alpha[i]);
+  acc += t(1, 4);
+ }
+ report("elementary transforms, 6 joints", cycles, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < cycles; ++c)
+ {
+  q(1) = q(6) = 1e-6 * c;
+  for(i = 1; i <= 6; ++i)
+   q(i) += 1e-9;
+  arm.setJointPositions(q);
+  acc += arm.getTransform()(1, 4);
+ }
+ report("KinematicChain, 6 joints moved", cycles, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < cycles; ++c)
+ {
+  arm.setJointPosition(6, 1e-6 * c);
+  acc += arm.getTransform()(1, 4);
+ }
+ report("KinematicChain, last joint moved", cycles, watch.elapsed());
+
+ const int count = 1000;
+ ColumnVector<6> *configurations = new ColumnVector<6>[count];
+ Transform *poses = new Transform[count];
+ for(c = 0; c < count; ++c)
+  for(i = 1; i <= 6; ++i)
+   configurations[c](i) = sin(0.3 * c + i);
+
+#ifdef _OPENMP
+ cout << "configurations split across cores (OpenMP)" << endl;
+#endif
+ watch.start();
+ for(c = 0; c < cycles / count; ++c)
+ {
+  arm.getTransforms(configurations, poses, count);
+  acc += poses[c % count](1, 4);
+ }
+ report("KinematicChain, batch of configurations", (cycles / count) * count, watch.elapsed());
+
+ // Jacobian
+ Transform frame[7];
+ Matrix<6,6> J, Jd;
+ ColumnVector<6> qd;
+ qd = 0.5, -1.0, 0.3, 2.0, 0.7, -1.5;
+ watch.start();
+ for(c = 0; c < cycles; ++c)
+ {
+  arm.setJointPosition(6, 1e-6 * c);
+  for(i = 0; i <= 6; ++i)
+   frame[i] = arm.getTransform(i);
+  ColumnVector<3> o = frame[6].getTranslation();
+  for(i = 0; i < 6; ++i)
+  {
+   Matrix<3,3> r;
+   frame[i].getSubMatrix(1, 1, r);
+   ColumnVector<3> z = r.getColumn(3);
+   ColumnVector<3> op = o - frame[i].getTranslation();
+   J.setSubMatrix(1, i + 1, crossProduct(z, op));
+   J.setSubMatrix(4, i + 1, z);
+  }
+  acc += J(1, 1);
+ }
+ report("Jacobian from frames", cycles, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < cycles; ++c)
+ {
+  arm.setJointPosition(6, 1e-6 * c);
+  arm.getJacobian(J);
+  acc += J(1, 1);
+ }
+ report("getJacobian", cycles, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < cycles; ++c)
+ {
+  arm.setJointPosition(6, 1e-6 * c);
+  arm.getJacobian(qd, J, Jd);
+  acc += J(1, 1) + Jd(1, 1);
+ }
+ report("getJacobian with derivative", cycles, watch.elapsed());
+
+ sink = acc;
+ delete [] configurations;
+ delete [] poses;
+ return 0;
+}
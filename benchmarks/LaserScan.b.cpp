@@ -0,0 +1,101 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LaserScan.b.cpp
+// Description          : Projection of a laser scan beam by beam against
+//                        LaserScan::project().
+//========================================================================
+
+#include "LaserScan.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program projects a scan of 1081 beams over 270 degrees, one in
+// 100 of them invalid, to the frame of a robot base: beam by beam with
+// cos(), sin() and the product of a Transform with a ColumnVector<4>,
+// and with LaserScan::project() for a Transform, an SE2 and in float.
+// Pass the number of passes over the scan as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int n = 1081;
+ long passes = 2000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ double *range = new double[4 * n];
+ double *x = range + n, *y = range + 2 * n, *z = range + 3 * n;
+ float *frange = new float[4 * n];
+ float *fx = frange + n, *fy = frange + 2 * n, *fz = frange + 3 * n;
+ double acc = 0;
+ long p;
+ int i, count = 0;
+
+ for(i = 0; i < n; ++i)
+ {
+  range[i] = (i % 100 == 50) ? 0 : 2 + sin(0.05 * i);
+  frange[i] = (float)range[i];
+ }
+ const double angleMin = -0.75 * M_PI, increment = 1.5 * M_PI / (n - 1);
+ Transform mount = translation(0.2, 0.0, 0.4) * rpyRotation(0.02, 0.05, 0.1);
+ SE2<> base(0.2, 0.0, 0.1);
+ LaserScan<n> scan(angleMin, increment, 0.05, 30);
+ LaserScan<n, float> fscan((float)angleMin, (float)increment, 0.05f, 30);
+ RigidTransform<float> fmount(translation<float>(0.2f, 0, 0.4f) * rpyRotation<float>(0.02f, 0.05f, 0.1f));
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  count = 0;
+  for(i = 0; i < n; ++i)
+  {
+   if(!(range[i] >= 0.05 && range[i] <= 30))
+    continue;
+   double a = angleMin + i * increment;
+   ColumnVector<4> h;
+   h = range[i] * cos(a), range[i] * sin(a), 0, 1;
+   ColumnVector<4> q = mount * h;
+   x[count] = q(1);
+   y[count] = q(2);
+   z[count] = q(3);
+   ++count;
+  }
+  acc += x[p % count];
+ }
+ report("beam by beam, Transform", passes * n, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  count = scan.project(range, mount, x, y, z);
+  acc += x[p % count];
+ }
+ report("project, Transform", passes * n, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  count = scan.project(range, base, x, y);
+  acc += x[p % count];
+ }
+ report("project, SE2", passes * n, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  count = fscan.project(frange, fmount, fx, fy, fz);
+  acc += fx[p % count];
+ }
+ report("project, RigidTransform, float", passes * n, watch.elapsed());
+
+ sink = acc;
+ delete [] range;
+ delete [] frange;
+ return 0;
+}
@@ -0,0 +1,99 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LieGroup.b.cpp
+// Description          : The exponential of twists by the matrix series
+//                        against the closed forms of LieGroup.hpp.
+//========================================================================
+
+#include "LieGroup.hpp"
+#include "MatrixExponential.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program maps 1024 twists (rotation angles from 0 to 3) to
+// transforms with expm() of the 4x4 twist matrix and with expSE3(),
+// maps the transforms back with logSE3(), and builds the left Jacobian
+// of SE(3) and its inverse. Pass the number of passes over the twists
+// as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int count = 1024;
+ long passes = 200;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ ColumnVector<6> *xi = new ColumnVector<6>[count];
+ Transform *t = new Transform[count];
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+ {
+  double theta = 3.0 * i / count;
+  xi[i] = 0.5, -0.2, 0.1 * i / count, 2 * theta / 3, -theta / 3, 2 * theta / 3;
+ }
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+  {
+   Matrix<4,4> m;
+   m = 0, -xi[i](6), xi[i](5), xi[i](1),
+       xi[i](6), 0, -xi[i](4), xi[i](2),
+       -xi[i](5), xi[i](4), 0, xi[i](3),
+       0, 0, 0, 0;
+   t[i].setSubMatrix(1, 1, expm(m));
+  }
+  acc += t[p & 1023](1, 4);
+ }
+ report("expm of the twist matrix", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   t[i] = expSE3(xi[i]);
+  acc += t[p & 1023](1, 4);
+ }
+ report("expSE3", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   xi[i] = logSE3(t[i]);
+  acc += xi[p & 1023](1);
+ }
+ report("logSE3", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   acc += leftJacobianSE3(xi[i])(1, 5);
+ }
+ report("leftJacobianSE3", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   acc += inverseLeftJacobianSE3(xi[i])(1, 5);
+ }
+ report("inverseLeftJacobianSE3", passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] xi;
+ delete [] t;
+ return 0;
+}
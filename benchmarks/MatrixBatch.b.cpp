@@ -0,0 +1,80 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : MatrixBatch.b.cpp
+// Description          : Batched against one-at-a-time inversion of
+//                        small matrices.
+//========================================================================
+
+#include "MatrixBatch.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program inverts an array of 3x3 and of 6x6 matrices, first by
+// calling inverse() on each matrix and then with the batched inverse().
+// MatrixBatch.b is the single threaded build, MatrixBatchOmp.b is
+// compiled with OpenMP and splits the batch across cores. The arrays
+// hold 1024 matrices, so that they stay in cache and the timing is not
+// limited by memory bandwidth. Pass the number of passes over the array
+// as the first argument.
+//========================================================================
+
+volatile double sink;
+
+template<int n>
+void run(long passes)
+{
+ const int count = 1024;
+ char name[64];
+ Matrix<n,n> *A = new Matrix<n,n>[count];
+ Matrix<n,n> *Ainv = new Matrix<n,n>[count];
+ double acc = 0;
+ long p;
+ int i, r, c;
+
+ for(i = 0; i < count; ++i)
+  for(r = 1; r <= n; ++r)
+   for(c = 1; c <= n; ++c)
+    A[i](r, c) = (r == c) ? n + 1 : sin(0.1 * i + r - 2.0 * c);
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   Ainv[i] = inverse(A[i]);
+  acc += Ainv[p & 1023](1,1);
+ }
+ sprintf(name, "%dx%d inverse, one at a time", n, n);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  inverse(A, Ainv, count);
+  acc += Ainv[p & 1023](1,1);
+ }
+ sprintf(name, "%dx%d inverse, batched", n, n);
+ report(name, passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] A;
+ delete [] Ainv;
+}
+
+
+int main(int argc, char **argv)
+{
+ long passes = 1000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+#ifdef _OPENMP
+ cout << "batches split across cores (OpenMP)" << endl;
+#endif
+ run<3>(passes);
+ run<6>(passes / 10);
+ return 0;
+}
@@ -0,0 +1,86 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Norm.b.cpp
+// Description          : Throughput of vector norms and normalization.
+//========================================================================
+
+#include "ColumnVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program normalizes an array of 3-vectors through the virtual 
+// VectorBase interface, with normalize() and with fastNormalize(), in 
+// float and double. On processors that pipeline square roots and 
+// divisions, such as x86 with SSE, fastNormalize() gains little; it is
+// meant for processors where these operations are slow. Pass the number
+// of passes over the array as the first argument.
+//========================================================================
+
+volatile double sink;
+
+template<class T>
+void run(const char *typeName, long passes)
+{
+ const int count = 1024;
+ char name[64];
+ ColumnVector<3,T> *v = new ColumnVector<3,T>[count];
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+  v[i] = (T)sin(0.1 * i), (T)cos(0.3 * i), (T)(1 + i % 7);
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+  {
+   const VectorBase<T> &b = v[i];
+   T s = 1 / b.norm();
+   v[i](1) *= s; v[i](2) *= s; v[i](3) *= s;
+  }
+  acc += v[p & 1023](1);
+ }
+ sprintf(name, "%s VectorBase::norm", typeName);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   v[i].normalize();
+  acc += v[p & 1023](1);
+ }
+ sprintf(name, "%s normalize", typeName);
+ report(name, passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   v[i].fastNormalize();
+  acc += v[p & 1023](1);
+ }
+ sprintf(name, "%s fastNormalize", typeName);
+ report(name, passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] v;
+}
+
+
+int main(int argc, char **argv)
+{
+ long passes = 10000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ run<float>("float ", passes);
+ run<double>("double", passes);
+ return 0;
+}
@@ -0,0 +1,119 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : PointBatch.b.cpp
+// Description          : Batched against one-at-a-time transformation
+//                        of points.
+//========================================================================
+
+#include "PointBatch.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program transforms a scan of 2^21 points (about the size of one
+// revolution of a multi-beam lidar) from the sensor frame, first one
+// point at a time as the product of a Transform and a ColumnVector<4>,
+// then with transformPoints() on the layouts it supports, in double and
+// single precision. The rates are in millions of points per second.
+// PointBatch.b is the single threaded build, PointBatchOmp.b is
+// compiled with OpenMP and splits the scan across cores. Build with
+// -mavx2 -mfma added to LDFLAGS to use AVX and fused multiply-add. Pass
+// the number of passes over the scan as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int count = 1 << 21;
+ long passes = 10;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ Transform T = rpyRotation(0.01, -0.02, 1.5) * translation(0.2, 0, 1.8);
+ double *x = new double[3 * count];
+ double *y = x + count, *z = x + 2 * count;
+ double *xyz = new double[3 * count];
+ float *f = new float[3 * count];
+ float *fxyz = new float[3 * count];
+ ColumnVector<4> *h = new ColumnVector<4>[count];
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+ {
+  x[i] = 20 * cos(0.001 * i);
+  y[i] = 20 * sin(0.001 * i);
+  z[i] = 0.1 * (i % 64) - 2;
+  xyz[3 * i] = x[i]; xyz[3 * i + 1] = y[i]; xyz[3 * i + 2] = z[i];
+  f[i] = (float)x[i]; f[count + i] = (float)y[i]; f[2 * count + i] = (float)z[i];
+  fxyz[3 * i] = f[i]; fxyz[3 * i + 1] = f[count + i]; fxyz[3 * i + 2] = f[2 * count + i];
+  h[i] = x[i], y[i], z[i], 1;
+ }
+
+#ifdef _OPENMP
+ cout << "scan split across cores (OpenMP)" << endl;
+#endif
+#ifdef QMATH_FMA
+ cout << "fused multiply-add" << endl;
+#endif
+
+ // the transform is applied forwards and then backwards, so that the
+ // points stay bounded over the passes
+ Transform I = inverse(T);
+ ColumnVector<4> q;
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  const Transform &t = (p & 1) ? I : T;
+  for(i = 0; i < count; ++i)
+   h[i] = t * h[i];
+  acc += h[p](1);
+ }
+ report("Transform * ColumnVector<4>, one at a time", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints((p & 1) ? I : T, x, y, z, x, y, z, count);
+  acc += x[p];
+ }
+ report("double, component arrays", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints((p & 1) ? I : T, xyz, xyz, count);
+  acc += xyz[p];
+ }
+ report("double, interleaved", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints((p & 1) ? I : T, f, f + count, f + 2 * count,
+                  f, f + count, f + 2 * count, count);
+  acc += f[p];
+ }
+ report("float, component arrays", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints((p & 1) ? I : T, fxyz, fxyz, count);
+  acc += fxyz[p];
+ }
+ report("float, interleaved", passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] x;
+ delete [] xyz;
+ delete [] f;
+ delete [] fxyz;
+ delete [] h;
+ return 0;
+}
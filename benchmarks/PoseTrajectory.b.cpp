@@ -0,0 +1,89 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : PoseTrajectory.b.cpp
+// Description          : Pose interpolation with slerp() against
+//                        PoseTrajectory.
+//========================================================================
+
+#include "PoseTrajectory.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program samples a trajectory through eight waypoints with a
+// quintic time scaling, as a planner sampling at 1 kHz would: first by
+// finding the segment, converting its waypoints to quaternions and
+// calling slerp() for every sample, then with PoseTrajectory::getPose()
+// and with getPoses(). All three write the poses into an array.
+// PoseTrajectoryOmp.b is compiled with OpenMP and shares the array
+// among cores. Pass the number of samples as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ long samples = 1000000;
+ if(argc > 1)
+  samples = atol(argv[1]);
+
+ const int n = 8;
+ const double step = 0.001;
+ Transform waypoint[n];
+ double time[n];
+ PoseTrajectory<n> trajectory(QMathTimeScaling_quintic);
+ int i;
+ long c;
+ for(i = 0; i < n; ++i)
+ {
+  time[i] = 0.5 * i;
+  waypoint[i] = translation(0.1 * i, sin(0.5 * i), 0.3) * rpyRotation(0.4 * i, 0.3 - 0.1 * i, -0.2 * i);
+  trajectory.setWaypoint(i + 1, time[i], waypoint[i]);
+ }
+ const double duration = time[n - 1];
+ double acc = 0;
+ const int count = (int)(duration / step);
+ Transform *poses = new Transform[count];
+
+ Stopwatch watch;
+ for(c = 0; c < samples; ++c)
+ {
+  double t = fmod(c * step, duration);
+  int k = (int)(t / 0.5);
+  double tau = (t - time[k]) / 0.5;
+  double s = tau * tau * tau * (10 + tau * (-15 + 6 * tau));
+  Quaternion<> q0(waypoint[k]), q1(waypoint[k + 1]);
+  Transform &pose = poses[c % count];
+  pose = slerp(q0, q1, s).toTransform();
+  for(i = 1; i <= 3; ++i)
+   pose(i, 4) = (1 - s) * waypoint[k](i, 4) + s * waypoint[k + 1](i, 4);
+  acc += pose(1, 4);
+ }
+ report("slerp and toTransform per sample", samples, watch.elapsed());
+
+ watch.start();
+ for(c = 0; c < samples; ++c)
+ {
+  poses[c % count] = trajectory.getPose(fmod(c * step, duration));
+  acc += poses[c % count](1, 4);
+ }
+ report("PoseTrajectory::getPose", samples, watch.elapsed());
+
+#ifdef _OPENMP
+ cout << "samples split across cores (OpenMP)" << endl;
+#endif
+ watch.start();
+ for(c = 0; c < samples / count; ++c)
+ {
+  trajectory.getPoses(0, step, poses, count);
+  acc += poses[c % count](1, 4);
+ }
+ report("PoseTrajectory::getPoses", (samples / count) * count, watch.elapsed());
+
+ sink = acc;
+ delete [] poses;
+ return 0;
+}
@@ -0,0 +1,122 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Precision.b.cpp
+// Description          : Throughput of the basic kernels in float and
+//                        double.
+//========================================================================
+
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program times matrix products, dot products, norms and linear
+// solves for float and double data. The makefile builds it twice:
+// Precision.b uses native accumulation, PrecisionMixed.b is compiled
+// with QMATH_MIXED_PRECISION so that float sums are accumulated in
+// double. Pass the number of repetitions as the first argument.
+//========================================================================
+
+volatile double sink;
+
+template<class T>
+void run(const char *typeName, long n)
+{
+ char name[64];
+ Matrix<4,4,T> A, B;
+ Matrix<6,6,T> M;
+ Matrix<6,1,T> rhs;
+ ColumnVector<3,T> u, v;
+ ColumnVector<64,T> x, y;
+ double acc = 0;
+ long i;
+
+ // a rotation, so that repeated products neither overflow nor underflow
+ A = 0.995, -0.0998, 0.0, 0.0,
+     0.0998, 0.995,  0.0, 0.0,
+     0.0,    0.0,    1.0, 0.0,
+     0.0,    0.0,    0.0, 1.0;
+ B = A;
+ M = 0;
+ for(int k = 1; k <= 6; ++k)
+ {
+  M(k, k) = 4;
+  if(k > 1) M(k, k - 1) = 1;
+  if(k < 6) M(k, k + 1) = 1;
+  rhs(k, 1) = k;
+ }
+ u = 1, 2, 3;
+ v = 0.5, -0.25, 0.125;
+ for(int k = 1; k <= 64; ++k)
+ {
+  x(k) = (T)(0.01 * k);
+  y(k) = (T)(1.0 / k);
+ }
+
+ Stopwatch watch;
+ for(i = 0; i < n; ++i)
+ {
+  B = A * B;
+  B(4,4) = (T)(i & 7);
+ }
+ acc += B(1,1);
+ sprintf(name, "%s 4x4 matrix product", typeName);
+ report(name, n, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < n; ++i)
+ {
+  acc += dotProduct(u, v);
+  u(1) = (T)(i & 3);
+ }
+ sprintf(name, "%s 3-vector dot product", typeName);
+ report(name, n, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < n; ++i)
+ {
+  acc += dotProduct(x, y);
+  x(1) = (T)(i & 3);
+ }
+ sprintf(name, "%s 64-vector dot product", typeName);
+ report(name, n, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < n; ++i)
+ {
+  acc += x.norm();
+  x(2) = (T)(i & 3);
+ }
+ sprintf(name, "%s 64-vector norm", typeName);
+ report(name, n, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < n / 10; ++i)
+ {
+  rhs(1, 1) = (T)(i & 7);
+  acc += solve(M, rhs)(6, 1);
+ }
+ sprintf(name, "%s 6x6 solve", typeName);
+ report(name, n / 10, watch.elapsed());
+
+ sink = acc;
+}
+
+
+int main(int argc, char **argv)
+{
+ long n = 1000000;
+ if(argc > 1)
+  n = atol(argv[1]);
+
+#ifdef QMATH_MIXED_PRECISION
+ cout << "float sums accumulated in double (QMATH_MIXED_PRECISION)" << endl;
+#endif
+ run<float>("float ", n);
+ run<double>("double", n);
+ return 0;
+}
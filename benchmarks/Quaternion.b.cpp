@@ -0,0 +1,84 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Quaternion.b.cpp
+// Description          : Transform against Quaternion composition and
+//                        interpolation of rotations.
+//========================================================================
+
+#include "Quaternion.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program composes the rotations of a six-joint chain and rotates
+// a vector by the result, once with Transform and once with Quaternion,
+// then interpolates between two orientations with slerp() and nlerp().
+// Pass the number of repetitions as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ long count = 1000000;
+ if(argc > 1)
+  count = atol(argv[1]);
+
+ const int links = 6;
+ Transform T[links];
+ Quaternion<> Q[links];
+ Vec3<> v(0.5, -1.5, 2);
+ double acc = 0;
+ long n;
+ int i;
+
+ for(i = 0; i < links; ++i)
+ {
+  T[i] = rpyRotation(0.3 * i, -0.2 + 0.1 * i, 0.7);
+  Q[i] = rpyQuaternion(0.3 * i, -0.2 + 0.1 * i, 0.7);
+ }
+
+ Stopwatch watch;
+ for(n = 0; n < count; ++n)
+ {
+  Transform t = T[0];
+  for(i = 1; i < links; ++i)
+   t = t * T[i];
+  acc += rotate(t, v).x();
+  v.x() += 1e-9;
+ }
+ report("Transform, 6 rotations and a vector", count, watch.elapsed());
+
+ watch.start();
+ for(n = 0; n < count; ++n)
+ {
+  Quaternion<> q = Q[0];
+  for(i = 1; i < links; ++i)
+   q = q * Q[i];
+  acc += rotate(q, v).x();
+  v.x() += 1e-9;
+ }
+ report("Quaternion, 6 rotations and a vector", count, watch.elapsed());
+
+ watch.start();
+ for(n = 0; n < count; ++n)
+ {
+  Quaternion<> q = slerp(Q[1], Q[4], (double)(n & 1023) / 1024);
+  acc += q.w();
+ }
+ report("slerp", count, watch.elapsed());
+
+ watch.start();
+ for(n = 0; n < count; ++n)
+ {
+  Quaternion<> q = nlerp(Q[1], Q[4], (double)(n & 1023) / 1024);
+  acc += q.w();
+ }
+ report("nlerp", count, watch.elapsed());
+
+ sink = acc;
+ return 0;
+}
@@ -0,0 +1,69 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : RigidTransform.b.cpp
+// Description          : Transform against RigidTransform composition
+//                        and inverse.
+//========================================================================
+
+#include "RigidTransform.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program composes the link transforms of a six-link chain and
+// inverts the result, as the forward kinematics of a kinematic tree
+// would, once with Transform and once with RigidTransform. Pass the
+// number of chains as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ long chains = 1000000;
+ if(argc > 1)
+  chains = atol(argv[1]);
+
+ const int links = 6;
+ Transform T[links];
+ RigidTransform<> R[links];
+ double acc = 0;
+ long n;
+ int i;
+
+ for(i = 0; i < links; ++i)
+ {
+  T[i] = rpyRotation(0.3 * i, -0.2 + 0.1 * i, 0.7) * translation(0.1, 0.2 * i, -0.3);
+  R[i] = RigidTransform<>(T[i]);
+ }
+
+ Stopwatch watch;
+ for(n = 0; n < chains; ++n)
+ {
+  Transform t = T[0];
+  for(i = 1; i < links; ++i)
+   t = t * T[i];
+  t = inverse(t);
+  acc += t(1, 4);
+  T[n % links](1, 4) += 1e-9;
+ }
+ report("Transform, 6 links and inverse", chains, watch.elapsed());
+
+ watch.start();
+ for(n = 0; n < chains; ++n)
+ {
+  RigidTransform<> r = R[0];
+  for(i = 1; i < links; ++i)
+   r = r * R[i];
+  r = inverse(r);
+  acc += r(1, 4);
+  R[n % links](1, 4) += 1e-9;
+ }
+ report("RigidTransform, 6 links and inverse", chains, watch.elapsed());
+
+ sink = acc;
+ return 0;
+}
@@ -0,0 +1,125 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Rotation.b.cpp
+// Description          : Products of elementary rotations against the
+//                        closed form and batched rotations.
+//========================================================================
+
+#include "Transform.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program builds the rotations of a trajectory of 1024 roll, pitch
+// and yaw angles and of 1024 angles about a fixed axis: as products of
+// xRotation(), yRotation() and zRotation() and with the Rodrigues
+// formula on matrices (as rpyRotation() and vectorRotation() used to
+// be computed), with the closed form rpyRotation() and
+// vectorRotation(), and with their batched versions. Pass the number of
+// passes over the trajectory as the first argument.
+//========================================================================
+
+volatile double sink;
+
+// vectorRotation() as it was computed before the closed form
+Transform matrixVectorRotation(const ColumnVector<3> &u, double theta)
+{
+ Transform t;
+ double c = cos(theta), s = sin(theta);
+ Matrix<3,3> r;
+ r = 0, -u(3) * s, u(2) * s,
+     u(3) * s, 0, -u(1) * s,
+     -u(2) * s, u(1) * s, 0;
+ r += u * transpose(u) * (1 - c);
+ r(1,1) += c;
+ r(2,2) += c;
+ r(3,3) += c;
+ t.setSubMatrix(1, 1, r);
+ return t;
+}
+
+int main(int argc, char **argv)
+{
+ const int count = 1024;
+ long passes = 500;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ double *roll = new double[4 * count];
+ double *pitch = roll + count, *yaw = roll + 2 * count, *theta = roll + 3 * count;
+ Transform *t = new Transform[count];
+ ColumnVector<3> u;
+ u = 2, -1, 2;
+ u = u / 3;
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+ {
+  roll[i] = 0.001 * i;
+  pitch[i] = 0.5 - 0.002 * i;
+  yaw[i] = 0.003 * i - 1;
+  theta[i] = 0.006 * i;
+ }
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   t[i] = (zRotation(roll[i]) * yRotation(pitch[i])) * xRotation(yaw[i]);
+  acc += t[p & 1023](1, 2);
+ }
+ report("roll-pitch-yaw, product of rotations", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   t[i] = rpyRotation(roll[i], pitch[i], yaw[i]);
+  acc += t[p & 1023](1, 2);
+ }
+ report("rpyRotation", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  rpyRotation(roll, pitch, yaw, t, count);
+  acc += t[p & 1023](1, 2);
+ }
+ report("rpyRotation, batched", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   t[i] = matrixVectorRotation(u, theta[i]);
+  acc += t[p & 1023](1, 2);
+ }
+ report("axis-angle, Rodrigues on matrices", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   t[i] = vectorRotation(u, theta[i]);
+  acc += t[p & 1023](1, 2);
+ }
+ report("vectorRotation", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  vectorRotation(u, theta, t, count);
+  acc += t[p & 1023](1, 2);
+ }
+ report("vectorRotation, batched", passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] roll;
+ delete [] t;
+ return 0;
+}
@@ -0,0 +1,107 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SE2.b.cpp
+// Description          : Planar odometry and 2D scan transformation with
+//                        SE2 against Transform.
+//========================================================================
+
+#include "SE2.hpp"
+#include "PointBatch.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program integrates 1024 odometry increments into a pose with
+// 4x4 Transform products and with SE2 products, and transforms a scan
+// of 1024 points with transformPoints() of a Transform (with z = 0)
+// and of an SE2, in structure-of-arrays and interleaved form. Pass the
+// number of passes as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int count = 1024;
+ long passes = 2000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ SE2<> *delta = new SE2<>[count];
+ Transform *deltaT = new Transform[count];
+ double *x = new double[8 * count];
+ double *y = x + count, *z = x + 2 * count, *tx = x + 3 * count, *ty = x + 4 * count;
+ double *tz = x + 5 * count, *xy = x + 6 * count;
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+ {
+  ColumnVector<3> xi;
+  xi = 0.002, 0.0001 * (i % 7), 0.005 - 0.00001 * i;
+  delta[i] = expSE2(xi);
+  deltaT[i] = delta[i].toTransform();
+  x[i] = 5 * cos(0.004 * i);
+  y[i] = 5 * sin(0.004 * i);
+  z[i] = 0;
+  xy[2 * i] = x[i];
+  xy[2 * i + 1] = y[i];
+ }
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  Transform pose;
+  for(i = 0; i < count; ++i)
+   pose = pose * deltaT[i];
+  acc += pose(1, 4);
+ }
+ report("odometry, Transform product", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  SE2<> pose;
+  for(i = 0; i < count; ++i)
+   pose = pose * delta[i];
+  acc += pose.x();
+ }
+ report("odometry, SE2 product", passes * count, watch.elapsed());
+
+ Transform frame = translation(0.3, -0.1, 0.0) * zRotation(0.4);
+ SE2<> frame2(frame);
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints(frame, x, y, z, tx, ty, tz, count);
+  acc += tx[p & 1023];
+ }
+ report("scan, Transform", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints(frame2, x, y, tx, ty, count);
+  acc += tx[p & 1023];
+ }
+ report("scan, SE2", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  transformPoints(frame2, xy, tz, count);
+  acc += tz[p & 1023];
+ }
+ report("scan, SE2, interleaved", passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] delta;
+ delete [] deltaT;
+ delete [] x;
+ return 0;
+}
@@ -0,0 +1,109 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SmallMatrix.b.cpp
+// Description          : Throughput of fixed-size matrix kernels.
+//========================================================================
+
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program times the element loops of small matrices. The makefile
+// builds it twice: SmallMatrix.b with the default QMATH_UNROLL_LIMIT,
+// and SmallMatrixLoop.b with QMATH_UNROLL_LIMIT=0, which keeps every
+// kernel as a loop. Pass the number of repetitions as the first
+// argument.
+//========================================================================
+
+volatile double sink;
+
+template<int n>
+void product(long count)
+{
+ char name[64];
+ Matrix<n, n> A, B;
+
+ // a rotation, so that repeated products neither overflow nor underflow
+ A = unitMatrix<n>();
+ A(1, 1) = A(2, 2) = cos(0.1);
+ A(1, 2) = -sin(0.1);
+ A(2, 1) = sin(0.1);
+ B = A;
+ Stopwatch watch;
+ for(long i = 0; i < count; ++i)
+ {
+  B = A * B;
+  B(n, n) = (double)(i & 7);
+ }
+ sprintf(name, "%dx%d matrix product", n, n);
+ report(name, count, watch.elapsed());
+ sink = B(1, 1);
+}
+
+
+int main(int argc, char **argv)
+{
+ long count = 2000000;
+ long i;
+ if(argc > 1)
+  count = atol(argv[1]);
+
+ cout << "QMATH_UNROLL_LIMIT = " << QMATH_UNROLL_LIMIT << endl;
+ product<3>(count);
+ product<4>(count);
+ product<6>(count / 4);
+
+ Matrix<4,4> A, B, C;
+ Matrix<3,3> R;
+ ColumnVector<4> u, v;
+ A = 1, 2, 3, 4,
+     5, 6, 7, 8,
+     9, 10, 11, 12,
+     13, 14, 15, 16;
+ B = A;
+ u = 1, 2, 3, 4;
+ v = 4, 3, 2, 1;
+ double acc = 0;
+
+ Stopwatch watch;
+ for(i = 0; i < count; ++i)
+ {
+  C = transpose(B);
+  acc += C(1, 2);
+  B(2, 1) = (double)(i & 3);
+ }
+ report("4x4 transpose", count, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < count; ++i)
+ {
+  B += A;
+  B(1, 1) = (double)(i & 3);
+ }
+ report("4x4 addition", count, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < count; ++i)
+ {
+  B.getSubMatrix(1, 1, R);
+  acc += R(3, 3);
+  B(3, 3) = (double)(i & 3);
+ }
+ report("3x3 sub-matrix of 4x4", count, watch.elapsed());
+
+ watch.start();
+ for(i = 0; i < count; ++i)
+ {
+  u = elementProduct(u, v);
+  u(1) = (double)(i & 3);
+ }
+ report("4-vector element product", count, watch.elapsed());
+
+ sink = acc + B(2, 2) + u(2);
+ return 0;
+}
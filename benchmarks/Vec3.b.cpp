@@ -0,0 +1,81 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Vec3.b.cpp
+// Description          : ColumnVector<3> against Vec3 in a geometry loop.
+//========================================================================
+
+#include "Vec3.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program computes normalized cross products and transformed 
+// points for an array of 3-vectors, once with ColumnVector<3> and
+// Transform products, and once with Vec3. With SSE2 only, a double
+// Vec3 takes two registers and runs at about the speed of the unrolled
+// ColumnVector<3> code; build with -mavx2 added to LDFLAGS to process
+// all four lanes at once. Pass the number of passes over the array as
+// the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int count = 1024;
+ long passes = 2000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ ColumnVector<3> *u = new ColumnVector<3>[count];
+ Vec3<> *v = new Vec3<>[count];
+ Transform T = translation(0.1, 0.2, 0.3) * rpyRotation(0.01, 0.02, 0.03);
+ ColumnVector<3> axis;
+ axis = 0, 0, 1;
+ Vec3<> vaxis(axis);
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+ {
+  u[i] = sin(0.1 * i), cos(0.3 * i), 1 + i % 7;
+  v[i] = Vec3<>(u[i]);
+ }
+
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+  {
+   ColumnVector<4> h;
+   h = u[i](1), u[i](2), u[i](3), 1;
+   ColumnVector<4> t = T * h;
+   ColumnVector<3> n = crossProduct(u[i], axis);
+   u[i] = t(1) + n(1) / n.norm(), t(2), t(3) - 0.3;
+  }
+  acc += u[p & 1023](1);
+ }
+ report("ColumnVector<3> and Transform", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+  {
+   Vec3<> t = T * v[i];
+   Vec3<> n = crossProduct(v[i], vaxis);
+   v[i] = Vec3<>(t.x() + n.x() / n.norm(), t.y(), t.z() - 0.3);
+  }
+  acc += v[p & 1023].x();
+ }
+ report("Vec3", passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] u;
+ delete [] v;
+ return 0;
+}
@@ -0,0 +1,129 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : VectorBatch.b.cpp
+// Description          : Batched against one-at-a-time products of
+//                        3-vectors.
+//========================================================================
+
+#include "VectorBatch.hpp"
+#include "Benchmark.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program computes the cross products, dot products and norms of
+// an array of 3-vectors, first with the single-vector functions on an
+// array of ColumnVector<3>, then with the batched functions on the same
+// array and on component (x[], y[], z[]) arrays. VectorBatch.b is the
+// single threaded build, VectorBatchOmp.b is compiled with OpenMP and
+// splits the arrays across cores. The arrays hold 1024 vectors, so that
+// they stay in cache; with a point cloud of 10^6 points the batched
+// functions are limited by memory bandwidth instead. Pass the number of
+// passes over the array as the first argument.
+//========================================================================
+
+volatile double sink;
+
+int main(int argc, char **argv)
+{
+ const int count = 1024;
+ long passes = 2000;
+ if(argc > 1)
+  passes = atol(argv[1]);
+
+ ColumnVector<3> *a = new ColumnVector<3>[count];
+ ColumnVector<3> *b = new ColumnVector<3>[count];
+ ColumnVector<3> *c = new ColumnVector<3>[count];
+ double *x = new double[9 * count];
+ double *ax = x, *ay = x + count, *az = x + 2 * count;
+ double *bx = x + 3 * count, *by = x + 4 * count, *bz = x + 5 * count;
+ double *cx = x + 6 * count, *cy = x + 7 * count, *cz = x + 8 * count;
+ double *d = new double[count];
+ double acc = 0;
+ long p;
+ int i;
+
+ for(i = 0; i < count; ++i)
+ {
+  a[i] = sin(0.1 * i), cos(0.3 * i), 1 + i % 7;
+  b[i] = 0.5 - cos(0.2 * i), 2 * sin(0.7 * i), 0.1 * i;
+  ax[i] = a[i](1); ay[i] = a[i](2); az[i] = a[i](3);
+  bx[i] = b[i](1); by[i] = b[i](2); bz[i] = b[i](3);
+ }
+
+#ifdef _OPENMP
+ cout << "arrays split across cores (OpenMP)" << endl;
+#endif
+
+ // cross products
+ Stopwatch watch;
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   c[i] = crossProduct(a[i], b[i]);
+  acc += c[p & 1023](1);
+ }
+ report("cross product, one at a time", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  crossProduct(a, b, c, count);
+  acc += c[p & 1023](1);
+ }
+ report("cross product, ColumnVector array", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  crossProduct(ax, ay, az, bx, by, bz, cx, cy, cz, count);
+  acc += cx[p & 1023];
+ }
+ report("cross product, component arrays", passes * count, watch.elapsed());
+
+ // dot products
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   d[i] = dotProduct(a[i], b[i]);
+  acc += d[p & 1023];
+ }
+ report("dot product, one at a time", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  dotProduct(ax, ay, az, bx, by, bz, d, count);
+  acc += d[p & 1023];
+ }
+ report("dot product, component arrays", passes * count, watch.elapsed());
+
+ // norms
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  for(i = 0; i < count; ++i)
+   d[i] = a[i].norm();
+  acc += d[p & 1023];
+ }
+ report("norm, one at a time", passes * count, watch.elapsed());
+
+ watch.start();
+ for(p = 0; p < passes; ++p)
+ {
+  norm(ax, ay, az, d, count);
+  acc += d[p & 1023];
+ }
+ report("norm, component arrays", passes * count, watch.elapsed());
+
+ sink = acc;
+ delete [] a;
+ delete [] b;
+ delete [] c;
+ delete [] x;
+ delete [] d;
+ return 0;
+}
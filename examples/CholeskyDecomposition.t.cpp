@@ -0,0 +1,74 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : CholeskyDecomposition.t.cpp
+// Description          : Example program for the class 
+//                        CholeskyDecomposition.
+//========================================================================
+
+#include "CholeskyDecomposition.hpp"
+#include "RowVector.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example keeps the Cholesky factor of a covariance matrix up to
+// date through rank-1 updates and downdates, and compares the result
+// with a factorization computed from scratch.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_CholeskyDecomposition(argc, argv) main(argc, argv)
+#endif
+
+int test_CholeskyDecomposition(int argc, char **argv)
+{
+ Matrix<3,3> P;
+ ColumnVector<3> x1, x2, b;
+ double error = 0;
+
+ P = 4.0, 1.2, 0.4,
+     1.2, 3.0, 0.6,
+     0.4, 0.6, 2.0;
+ x1 = 0.5, -1.0, 0.3;
+ x2 = 0.2, 0.4, -0.1;
+ b = 1, 2, 3;
+
+ CholeskyDecomposition<3> chol(P);
+
+ // P + x1 x1' - x2 x2', without refactorizing
+ chol.update(x1);
+ chol.downdate(x2);
+
+ Matrix<3,3> Pnew = P + x1 * transpose(x1) - x2 * transpose(x2);
+ CholeskyDecomposition<3> reference(Pnew);
+
+ Matrix<3,3> dL = chol.getL() - reference.getL();
+ for(int r = 1; r <= 3; ++r)
+  for(int c = 1; c <= 3; ++c)
+   if(fabs(dL(r,c)) > error) error = fabs(dL(r,c));
+ cout << "updated factor L:" << endl << chol.getL() << endl;
+
+ ColumnVector<3> x = chol.solve(b);
+ ColumnVector<3> r = Pnew * x - b;
+ if(r.norm() > error) error = r.norm();
+ cout << "solution of Pnew x = b: " << transpose(x) << endl;
+
+ // downdating to an indefinite matrix is refused
+ try
+ {
+  ColumnVector<3> big;
+  big = 10, 0, 0;
+  chol.downdate(big);
+  error = 1;
+ }
+ catch (MathException &ex)
+ {
+  cout << "downdate: " << ex.getErrorMessage() << endl;
+ }
+
+ cout << "largest error: " << error << endl;
+ return (error < 1e-12) ? 0 : 1;
+}
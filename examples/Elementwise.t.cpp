@@ -0,0 +1,112 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Elementwise.t.cpp
+// Description          : Example program for reductions and
+//                        element-by-element functions.
+//========================================================================
+
+#include "Elementwise.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example computes reductions of a matrix, a vector and part of a
+// large array, clamps a vector, and compares the element-by-element
+// sine, cosine and exponential with the standard library against the
+// accuracy documented in FastMath.hpp.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_Elementwise(argc, argv) main(argc, argv)
+#endif
+
+int test_Elementwise(int argc, char **argv)
+{
+ int failures = 0;
+ int i, r, c;
+
+ // reductions of a matrix and a vector
+ Matrix<3,5> M;
+ M = 4,  -2, 7, 0.5, 3,
+     1,   9, -6, 2,  9,
+     -6, 0.25, 8, 5, 1;
+ double total = 0;
+ for(r = 1; r <= 3; ++r)
+  for(c = 1; c <= 5; ++c)
+   total += M(r, c);
+ cout << "M = " << endl << M << endl;
+ cout << "sum: " << elementSum(M) << ", mean: " << elementMean(M)
+      << ", min: " << elementMin(M) << ", max: " << elementMax(M) << endl;
+ if(fabs(elementSum(M) - total) > 1e-12 || fabs(elementMean(M) - total / 15) > 1e-12) ++failures;
+ if(elementMin(M) != -6 || elementMax(M) != 9) ++failures;
+
+ elementMinIndex(M, r, c);
+ cout << "first smallest element at (" << r << ", " << c << ")";
+ if(r != 2 || c != 3) ++failures;
+ elementMaxIndex(M, r, c);
+ cout << ", first largest element at (" << r << ", " << c << ")" << endl;
+ if(r != 2 || c != 2) ++failures;
+
+ ColumnVector<6> torque;
+ torque = 12.5, -3, 0, -40, 9.9, 10.1;
+ torque = elementClamp(torque, -10, 10);
+ cout << "clamped torque: " << transpose(torque) << endl;
+ if(elementMax(torque) != 10 || elementMin(torque) != -10 ||
+    elementMaxIndex(torque) != 1 || elementMinIndex(torque) != 4) ++failures;
+ if(fabs(elementSum(elementAbs(torque)) - 42.9) > 1e-12) ++failures;
+
+ // a view of 999 elements of a large array
+ const int count = 1000;
+ double x[count], y[count];
+ for(i = 0; i < count; ++i)
+  x[i] = 20 * sin(0.37 * i) + 0.01 * i;
+ double s = 0, lo = x[1], hi = x[1];
+ int ilo = 0, ihi = 0;
+ for(i = 1; i < count; ++i)
+ {
+  s += x[i];
+  if(x[i] < lo) { lo = x[i]; ilo = i - 1; }
+  if(x[i] > hi) { hi = x[i]; ihi = i - 1; }
+ }
+ if(fabs(elementSum(x + 1, count - 1) - s) > 1e-9 || elementMin(x + 1, count - 1) != lo ||
+    elementMax(x + 1, count - 1) != hi || elementMinIndex(x + 1, count - 1) != ilo ||
+    elementMaxIndex(x + 1, count - 1) != ihi) ++failures;
+
+ // element-by-element functions against the standard library
+ double sinError = 0, cosError = 0, expError = 0;
+ elementSin(x, y, count);
+ for(i = 0; i < count; ++i)
+  if(fabs(y[i] - sin(x[i])) > sinError) sinError = fabs(y[i] - sin(x[i]));
+ elementCos(x, y, count);
+ for(i = 0; i < count; ++i)
+  if(fabs(y[i] - cos(x[i])) > cosError) cosError = fabs(y[i] - cos(x[i]));
+ elementExp(x, y, count);
+ for(i = 0; i < count; ++i)
+  if(fabs(y[i] - exp(x[i])) > expError * exp(x[i])) expError = fabs(y[i] - exp(x[i])) / exp(x[i]);
+ cout << "double: largest error of sin " << sinError << ", cos " << cosError
+      << ", relative error of exp " << expError << endl;
+ if(sinError > 1e-15 || cosError > 1e-15 || expError > 5e-16) ++failures;
+
+ Matrix<4,4,float> A;
+ for(r = 1; r <= 4; ++r)
+  for(c = 1; c <= 4; ++c)
+   A(r, c) = 0.7f * r - 1.3f * c;
+ Matrix<4,4,float> S = elementSin(A), C = elementCos(A), E = elementExp(A);
+ sinError = cosError = expError = 0;
+ for(r = 1; r <= 4; ++r)
+  for(c = 1; c <= 4; ++c)
+  {
+   double a = A(r, c);
+   if(fabs(S(r, c) - sin(a)) > sinError) sinError = fabs(S(r, c) - sin(a));
+   if(fabs(C(r, c) - cos(a)) > cosError) cosError = fabs(C(r, c) - cos(a));
+   if(fabs(E(r, c) - exp(a)) / exp(a) > expError) expError = fabs(E(r, c) - exp(a)) / exp(a);
+  }
+ cout << "float:  largest error of sin " << sinError << ", cos " << cosError
+      << ", relative error of exp " << expError << endl;
+ if(sinError > 5e-7 || cosError > 5e-7 || expError > 3e-7) ++failures;
+
+ return failures;
+}
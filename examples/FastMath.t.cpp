@@ -0,0 +1,114 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FastMath.t.cpp
+// Description          : Example program for fast approximations.
+//========================================================================
+
+#include "FastMath.hpp"
+#include "ColumnVector.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example measures the largest relative error of fastInverseSqrt()
+// over a wide range of arguments, compares it with the documented bound,
+// and normalizes a vector with the exact and the fast method. It then
+// measures the largest absolute errors of fastSinCos(), fastAtan2() and
+// fastAsin() against the C library, in float and double.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_FastMath(argc, argv) main(argc, argv)
+#endif
+
+// Largest absolute differences of the fast trigonometry from the C
+// library for four arguments: sin and cos of x, atan2(y, z) and asin(w).
+template<class T>
+void trigError(const T *x, const T *y, const T *z, const T *w, double *error)
+{
+ T s[4], c[4], a[4], b[4];
+ Simd4<T> ss, cc;
+ fastSinCos(Simd4<T>::load(x), ss, cc);
+ ss.store(s);
+ cc.store(c);
+ fastAtan2(Simd4<T>::load(y), Simd4<T>::load(z)).store(a);
+ fastAsin(Simd4<T>::load(w)).store(b);
+ for(int k = 0; k < 4; ++k)
+ {
+  double e = fabs(s[k] - sin((double)x[k]));
+  if(fabs(c[k] - cos((double)x[k])) > e) e = fabs(c[k] - cos((double)x[k]));
+  if(e > error[0]) error[0] = e;
+  e = fabs(a[k] - atan2((double)y[k], (double)z[k]));
+  if(e > error[1]) error[1] = e;
+  e = fabs(b[k] - asin((double)w[k]));
+  if(e > error[2]) error[2] = e;
+ }
+}
+
+int test_FastMath(int argc, char **argv)
+{
+ int failures = 0;
+ double floatError = 0, doubleError = 0;
+
+ for(double x = 1e-30; x < 1e30; x *= 1.001)
+ {
+  float xf = (float)x;
+  double exact = 1.0 / sqrt((double)xf);
+  double e = fabs(fastInverseSqrt(xf) - exact) / exact;
+  if(e > floatError) floatError = e;
+  exact = 1.0 / sqrt(x);
+  e = fabs(fastInverseSqrt(x) - exact) / exact;
+  if(e > doubleError) doubleError = e;
+ }
+#ifdef QMATH_SSE
+ cout << "SSE estimate" << endl;
+#endif
+ cout << "largest relative error of fastInverseSqrt: float " << floatError
+      << ", double " << doubleError << endl;
+ if(floatError > 5e-6 || doubleError > 1e-15) ++failures;
+
+ ColumnVector<3, float> exact, fast;
+ exact = 3.0f, -1.5f, 0.25f;
+ fast = exact;
+ exact.normalize();
+ fast.fastNormalize();
+ cout << "normalized: " << exact(1) << " " << exact(2) << " " << exact(3) << endl;
+ cout << "fast:       " << fast(1) << " " << fast(2) << " " << fast(3) << endl;
+ if( ColumnVector<3, float>(exact - fast).infNorm() > 1e-5 ) ++failures;
+
+ // angles in [-100, 100), points all around the origin (and on the
+ // axes), sines in [-1, 1]
+ double floatTrig[3] = {0, 0, 0}, doubleTrig[3] = {0, 0, 0};
+ double x[4], y[4], z[4], w[4];
+ float xf[4], yf[4], zf[4], wf[4];
+ for(int i = 0; i < 40000; ++i)
+ {
+  for(int k = 0; k < 4; ++k)
+  {
+   int j = 4 * i + k;
+   x[k] = 0.00125 * j - 100;
+   y[k] = (j % 97 == 0) ? 0 : sin(0.37 * j) * (1 + 1e-4 * j);
+   z[k] = (j % 89 == 0) ? 0 : cos(0.53 * j) * (1 + 1e-4 * j);
+   w[k] = 1.25e-5 * j - 1;
+   xf[k] = (float)x[k];
+   yf[k] = (float)y[k];
+   zf[k] = (float)z[k];
+   wf[k] = (float)w[k];
+  }
+  trigError(x, y, z, w, doubleTrig);
+  trigError(xf, yf, zf, wf, floatTrig);
+ }
+ cout << "largest error of fastSinCos: float " << floatTrig[0]
+      << ", double " << doubleTrig[0] << endl;
+ cout << "largest error of fastAtan2: float " << floatTrig[1]
+      << ", double " << doubleTrig[1] << endl;
+ cout << "largest error of fastAsin: float " << floatTrig[2]
+      << ", double " << doubleTrig[2] << endl;
+ if(doubleTrig[0] > 1e-15 || doubleTrig[1] > 5e-16 || doubleTrig[2] > 5e-16) ++failures;
+ if(floatTrig[0] > 5e-7 || floatTrig[1] > 4e-7 || floatTrig[2] > 3e-7) ++failures;
+
+ return failures;
+}
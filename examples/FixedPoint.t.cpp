@@ -0,0 +1,102 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FixedPoint.t.cpp
+// Description          : Example program for fixed-point numbers.
+//========================================================================
+
+#include "FixedPoint.hpp"
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+#include "LowpassFilter.hpp"
+#include "Integrator.hpp"
+#include "Differentiator.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example runs saturating arithmetic, a matrix-vector product, a
+// low pass filter, an integrator and a differentiator on fixed-point
+// data, and compares the results with the same computations in double.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_FixedPoint(argc, argv) main(argc, argv)
+#endif
+
+int test_FixedPoint(int argc, char **argv)
+{
+ int failures = 0;
+
+ // saturation instead of wrap-around
+ Q15 a = 0.75, b = 0.5;
+ cout << "Q15: 0.75 + 0.5 = " << a + b << ", 0.75 * 0.5 = " << a * b
+      << ", -0.75 - 0.5 = " << -a - b << endl;
+ if( (a + b) != Q15::maxValue() || (-a - b) != Q15::minValue() ) ++failures;
+ if( (a * b).toDouble() != 0.375 ) ++failures;
+
+ // 16.16 numbers
+ FixedPoint<16> two = 2;
+ cout << "sqrt(2) in 16.16: " << sqrt(two) << endl;
+ if( fabs(sqrt(two).toDouble() - sqrt(2.0)) > 2.0 / 65536 ) ++failures;
+
+ // rotation of a vector in Q31
+ Matrix<2,2,Q31> R;
+ ColumnVector<2,Q31> v, w;
+ double c = cos(0.3), s = sin(0.3);
+ R = c, -s,
+     s,  c;
+ v = 0.5, -0.25;
+ w = R * v;
+ cout << "rotated vector (Q31): " << w(1) << " " << w(2) << endl;
+ if( fabs(w(1).toDouble() - (0.5 * c + 0.25 * s)) > 1e-8 ) ++failures;
+ if( fabs(w(2).toDouble() - (0.5 * s - 0.25 * c)) > 1e-8 ) ++failures;
+
+ // low pass filter on Q15 samples against the same filter in double
+ LowpassFilter<Q15> fixedFilter(5, 0.01);
+ LowpassFilter<double> floatFilter(5, 0.01);
+ double filterError = 0;
+ for(int i = 0; i < 200; ++i)
+ {
+  double x = (i < 100) ? 0.5 : -0.3;
+  double e = fabs(fixedFilter.filter(x).toDouble() - floatFilter.filter(x));
+  if(e > filterError) filterError = e;
+ }
+ cout << "largest low pass filter error (Q15): " << filterError << endl;
+ if(filterError > 1e-3) ++failures;
+
+ // integrate and differentiate a ramp in 16.16
+ Integrator<FixedPoint<16> > integrator(0.01, 0);
+ Differentiator<FixedPoint<16> > differentiator(0.01);
+ FixedPoint<16> integral, slope;
+ differentiator.disableFilter();
+ for(int i = 0; i <= 100; ++i)
+ {
+  integral = integrator.integrate(1);
+  slope = differentiator.differentiate(0.02 * i);
+ }
+ cout << "integral of 1 over 1.01s: " << integral << ", slope of 2t: " << slope << endl;
+ if( fabs(integral.toDouble() - 1.005) > 1e-3 ) ++failures;
+ if( fabs(slope.toDouble() - 2.0) > 1e-2 ) ++failures;
+
+ // at the default period of 1 ms, 1/p = 1000 is beyond the range of
+ // the coefficients; the slope of a unit ramp stays within the rounding
+ // of the input (2^-16 / 0.001) and is exact on average
+ Differentiator<FixedPoint<16> > fastDifferentiator;
+ fastDifferentiator.disableFilter();
+ double slopeError = 0, slopeSum = 0;
+ for(int i = 0; i <= 1000; ++i)
+ {
+  slope = fastDifferentiator.differentiate(0.001 * i);
+  if(i == 0) continue;
+  if( fabs(slope.toDouble() - 1.0) > slopeError ) slopeError = fabs(slope.toDouble() - 1.0);
+  slopeSum += slope.toDouble();
+ }
+ cout << "largest error of the slope of t at 1 ms: " << slopeError
+      << ", mean slope: " << slopeSum / 1000 << endl;
+ if( slopeError > 1.6e-2 || fabs(slopeSum / 1000 - 1.0) > 1e-4 ) ++failures;
+
+ return failures;
+}
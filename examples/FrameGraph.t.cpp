@@ -0,0 +1,152 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : FrameGraph.t.cpp
+// Description          : Example program for the classes FrameGraph and
+//                        FrameLookup.
+//========================================================================
+
+#include "FrameGraph.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example builds a small tree of frames (world, a mobile base, an
+// arm on the base, a camera fixed to the arm, and a marker in the
+// world), records their poses over time and looks up the pose of the
+// marker relative to the camera between the recorded times, directly
+// and through a FrameLookup, comparing both with the poses composed by
+// hand. When compiled with OpenMP (useomp=yes), a writer thread also
+// records poses while a reader thread looks them up.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_FrameGraph(argc, argv) main(argc, argv)
+#endif
+
+enum { world = 1, base, arm, camera, marker, other };
+
+static double largestDifference(const Matrix<4,4> &a, const Matrix<4,4> &b)
+{
+ double error = 0;
+ for(int r = 1; r <= 4; ++r)
+  for(int c = 1; c <= 4; ++c)
+   if(fabs(a(r, c) - b(r, c)) > error) error = fabs(a(r, c) - b(r, c));
+ return error;
+}
+
+// The poses of the moving frames relative to their parents. The
+// rotations are about a fixed axis at a constant rate and the origins
+// move along straight lines, so that interpolating between any two
+// times gives these poses exactly.
+Transform basePose(double t) { return translation(0.5 * t, 0.2 * t, 0) * zRotation(0.3 * t); }
+Transform armPose(double t) { return translation(0.1, 0, 0.4) * yRotation(-0.2 * t); }
+Transform markerPose(double t) { return translation(2, 1 - 0.1 * t, 0.3) * xRotation(0.5 * t); }
+Transform cameraPose() { return translation(0, 0.05, 0.1) * rpyRotation(0.1, -0.2, 0.3); }
+
+int test_FrameGraph(int argc, char **argv)
+{
+ int failures = 0;
+ int i;
+ double error;
+ Transform pose, expected;
+
+ FrameGraph<6, 8> *graph = new FrameGraph<6, 8>;
+ graph->setParent(base, world);
+ graph->setParent(arm, base);
+ graph->setParent(camera, arm);
+ graph->setParent(marker, world);
+ graph->setStaticTransform(camera, cameraPose());
+ for(i = 0; i < 5; ++i)
+ {
+  graph->setTransform(base, i, basePose(i));
+  graph->setTransform(arm, i, armPose(i));
+  graph->setTransform(marker, 0.25 + i, markerPose(0.25 + i));
+ }
+ if(graph->setTransform(base, 2.0, basePose(2.0))) ++failures;   // older than the newest
+
+ // the camera sees the marker, between recorded times
+ FrameLookup<6, 8> lookup(*graph);
+ error = 0;
+ for(i = 0; i <= 8; ++i)
+ {
+  double t = 0.25 + 0.25 * i;
+  expected = inverse(basePose(t) * armPose(t) * cameraPose()) * markerPose(t);
+  if(!graph->getTransform(camera, marker, t, pose)) ++failures;
+  if(largestDifference(pose, expected) > error) error = largestDifference(pose, expected);
+  if(!lookup.getTransform(camera, marker, t, pose)) ++failures;
+  if(largestDifference(pose, expected) > error) error = largestDifference(pose, expected);
+ }
+ cout << "camera to marker at t = 2.25:" << endl << pose << endl;
+ cout << "largest error of interpolated lookups: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // outside the recorded times, and between trees
+ if(graph->getTransform(camera, marker, 0.1, pose)) ++failures;
+ if(graph->getTransform(camera, marker, 4.5, pose)) ++failures;
+ if(lookup.getTransform(camera, other, 1.0, pose)) ++failures;
+
+ // the newest poses; a new pose of the base invalidates the cached
+ // arm and camera poses but not the marker
+ lookup.getTransform(camera, marker, pose);
+ expected = inverse(basePose(4) * armPose(4) * cameraPose()) * markerPose(4.25);
+ error = largestDifference(pose, expected);
+ graph->setTransform(base, 5, basePose(5));
+ lookup.getTransform(camera, marker, pose);
+ expected = inverse(basePose(5) * armPose(4) * cameraPose()) * markerPose(4.25);
+ if(largestDifference(pose, expected) > error) error = largestDifference(pose, expected);
+ graph->getTransform(camera, marker, pose);
+ if(largestDifference(pose, expected) > error) error = largestDifference(pose, expected);
+ cout << "largest error of newest lookups: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // the ring buffer keeps the last 8 poses
+ for(i = 6; i < 20; ++i)
+  graph->setTransform(base, i, basePose(i));
+ if(graph->getTransform(world, base, 11.5, pose)) ++failures;
+ if(!graph->getTransform(world, base, 12.5, pose)) ++failures;
+ if(largestDifference(pose, basePose(12.5)) > 1e-14) ++failures;
+
+ try
+ {
+  graph->setParent(world, camera);
+  ++failures;
+ }
+ catch(MathException &e)
+ {
+  cout << "cycle: " << e.getErrorMessage() << endl;
+ }
+
+#ifdef _OPENMP
+ // one thread records, another reads the newest pose: the rotation
+ // angle must always agree with the translation it was recorded with
+ const int count = 200000;
+ int torn = 0;
+#pragma omp parallel sections num_threads(2)
+ {
+#pragma omp section
+  {
+   for(int k = 20; k < count; ++k)
+    graph->setTransform(base, k, translation(k, 0, 0) * zRotation(1e-5 * k));
+  }
+#pragma omp section
+  {
+   FrameLookup<6, 8> reader(*graph);
+   Transform t;
+   for(int k = 0; k < count; ++k)
+   {
+    reader.getTransform(world, base, t);
+    if(fabs(atan2(t(2, 1), t(1, 1)) - 1e-5 * t(1, 4)) > 1e-12 && t(1, 4) >= 20)
+     ++torn;
+   }
+  }
+ }
+ cout << "inconsistent reads while writing: " << torn << endl;
+ if(torn) ++failures;
+#endif
+
+ delete graph;
+ return failures;
+}
@@ -0,0 +1,191 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : KinematicChain.t.cpp
+// Description          : Example program for the class KinematicChain.
+//========================================================================
+
+#include "KinematicChain.hpp"
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+using namespace std;
+
+//========================================================================
+// This example describes a six-joint arm (the link parameters of a PUMA
+// 560) in both Denavit-Hartenberg conventions, moves some of the joints
+// and compares the forward kinematics with products of elementary
+// transforms. It also checks the intermediate frames and evaluates a
+// set of configurations at once.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_KinematicChain(argc, argv) main(argc, argv)
+#endif
+
+static const double a[6] = {0, 0.4318, 0.0203, 0, 0, 0};
+static const double alpha[6] = {M_PI / 2, 0, -M_PI / 2, M_PI / 2, -M_PI / 2, 0};
+static const double d[6] = {0, 0, 0.15005, 0.4318, 0, 0};
+
+// the forward kinematics as a product of elementary transforms
+static Transform standardDH(const ColumnVector<6> &q)
+{
+ Transform t;
+ for(int i = 0; i < 6; ++i)
+  t = t * zRotation(q(i + 1)) * translation(0, 0, d[i]) * translation(a[i], 0, 0) * xRotation(alpha[i]);
+ return t;
+}
+
+static Transform modifiedDH(const ColumnVector<6> &q)
+{
+ Transform t;
+ for(int i = 0; i < 6; ++i)
+ {
+  double ap = (i > 0) ? a[i - 1] : 0, alphap = (i > 0) ? alpha[i - 1] : 0;
+  t = t * xRotation(alphap) * translation(ap, 0, 0) * zRotation(q(i + 1)) * translation(0, 0, d[i]);
+ }
+ return t;
+}
+
+static double largestDifference(const Matrix<4,4> &a, const Matrix<4,4> &b)
+{
+ double error = 0;
+ for(int r = 1; r <= 4; ++r)
+  for(int c = 1; c <= 4; ++c)
+   if(fabs(a(r, c) - b(r, c)) > error) error = fabs(a(r, c) - b(r, c));
+ return error;
+}
+
+int test_KinematicChain(int argc, char **argv)
+{
+ int failures = 0;
+ int i, k;
+ double error = 0;
+
+ KinematicChain<6> arm, craig(QMathDH_modified);
+ for(i = 1; i <= 6; ++i)
+ {
+  arm.setLink(i, a[i - 1], alpha[i - 1], d[i - 1], 0);
+  craig.setLink(i, (i > 1) ? a[i - 2] : 0, (i > 1) ? alpha[i - 2] : 0, d[i - 1], 0);
+ }
+
+ ColumnVector<6> q;
+ q = 0.1, -0.7, 0.4, 1.2, -0.3, 2.0;
+ arm.setJointPositions(q);
+ craig.setJointPositions(q);
+ cout << "0T6 = " << endl << arm.getTransform() << endl;
+ error = largestDifference(arm.getTransform(), standardDH(q));
+ if(largestDifference(craig.getTransform(), modifiedDH(q)) > error)
+  error = largestDifference(craig.getTransform(), modifiedDH(q));
+
+ // move the wrist only, then one joint of the arm
+ arm.setJointPosition(5, 0.8);
+ q(5) = 0.8;
+ if(largestDifference(arm.getTransform(), standardDH(q)) > error)
+  error = largestDifference(arm.getTransform(), standardDH(q));
+ arm.setJointPosition(2, -0.2);
+ q(2) = -0.2;
+ if(largestDifference(arm.getTransform(), standardDH(q)) > error)
+  error = largestDifference(arm.getTransform(), standardDH(q));
+ cout << "largest error of the forward kinematics: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // every intermediate frame: 0Ti iTn = 0Tn, 0Ti = 0Ti-1 Ai
+ error = 0;
+ arm.setJointPosition(4, -1.0);
+ for(i = 0; i <= 6; ++i)
+ {
+  Transform t = arm.getTransform(i) * arm.getTransformToEnd(i);
+  if(largestDifference(t, arm.getTransform()) > error)
+   error = largestDifference(t, arm.getTransform());
+  if(i > 0 && largestDifference(arm.getTransform(i - 1) * arm.getLinkTransform(i), arm.getTransform(i)) > error)
+   error = largestDifference(arm.getTransform(i - 1) * arm.getLinkTransform(i), arm.getTransform(i));
+ }
+ cout << "largest error of the intermediate frames: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // a prismatic joint
+ KinematicChain<2> slide;
+ slide.setLink(1, 0, 0, 0.5, 0, QMathJoint_prismatic);
+ slide.setLink(2, 1, 0, 0, 0);
+ slide.setJointPosition(1, 0.25);
+ slide.setJointPosition(2, M_PI / 2);
+ Transform s = slide.getTransform();
+ if(fabs(s(1, 4)) > 1e-15 || fabs(s(2, 4) - 1) > 1e-15 || fabs(s(3, 4) - 0.75) > 1e-15) ++failures;
+
+ // many configurations at once
+ const int count = 50;
+ ColumnVector<6> configurations[count];
+ Transform poses[count];
+ for(k = 0; k < count; ++k)
+  for(i = 1; i <= 6; ++i)
+   configurations[k](i) = sin(0.3 * k + i);
+ arm.getTransforms(configurations, poses, count);
+ error = 0;
+ for(k = 0; k < count; ++k)
+  if(largestDifference(poses[k], standardDH(configurations[k])) > error)
+   error = largestDifference(poses[k], standardDH(configurations[k]));
+ cout << "largest error of " << count << " configurations: " << error << endl;
+ if(error > 1e-14) ++failures;
+ if(arm.getJointPosition(2) != -0.2) ++failures;   // left unchanged
+
+ // the Jacobian and its derivative against finite differences, for a
+ // chain in each convention with a prismatic joint in the middle
+ arm.setLink(3, a[2], alpha[2], 0.2, 0, QMathJoint_prismatic);
+ craig.setLink(3, a[1], alpha[1], 0.2, 0, QMathJoint_prismatic);
+ ColumnVector<6> qd;
+ qd = 0.5, -1.0, 0.3, 2.0, 0.7, -1.5;
+ const double h = 1e-6;
+ double jError = 0, dError = 0;
+ for(k = 0; k < 2; ++k)
+ {
+  KinematicChain<6> &chain = (k == 0) ? arm : craig;
+  Matrix<6,6> J, Jd, Jp, Jm;
+  chain.getJacobian(qd, J, Jd);
+  ColumnVector<6> q0 = chain.getJointPositions();
+  for(i = 1; i <= 6; ++i)
+  {
+   // column i: the velocity of the last frame when joint i moves
+   chain.setJointPosition(i, q0(i) + h);
+   Transform tp = chain.getTransform();
+   chain.setJointPosition(i, q0(i) - h);
+   Transform tm = chain.getTransform();
+   chain.setJointPosition(i, q0(i));
+   Matrix<4,4> dt = (tp - tm) * (1 / (2 * h));
+   Matrix<3,3> dR, R;
+   dt.getSubMatrix(1, 1, dR);
+   chain.getTransform().getSubMatrix(1, 1, R);
+   Matrix<3,3> w = dR * transpose(R);                       // skew(angular velocity)
+   double column[6] = {dt(1, 4), dt(2, 4), dt(3, 4), w(3, 2), w(1, 3), w(2, 1)};
+   for(int r = 1; r <= 6; ++r)
+    if(fabs(J(r, i) - column[r - 1]) > jError) jError = fabs(J(r, i) - column[r - 1]);
+  }
+  // the derivative: along the joint velocities
+  chain.setJointPositions(q0 + qd * h);
+  chain.getJacobian(Jp);
+  chain.setJointPositions(q0 - qd * h);
+  chain.getJacobian(Jm);
+  chain.setJointPositions(q0);
+  Matrix<6,6> D = (Jp - Jm) * (1 / (2 * h)) - Jd;
+  for(i = 1; i <= 6; ++i)
+   for(int r = 1; r <= 6; ++r)
+    if(fabs(D(r, i)) > dError) dError = fabs(D(r, i));
+ }
+ cout << "largest error of the Jacobian " << jError << ", of its derivative " << dError << endl;
+ if(jError > 1e-8 || dError > 1e-8) ++failures;
+
+ try
+ {
+  arm.setJointPosition(7, 0);
+  ++failures;
+ }
+ catch(MathException &e)
+ {
+  cout << "joint 7: " << e.getErrorMessage() << endl;
+ }
+
+ return failures;
+}
@@ -0,0 +1,67 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LUDecomposition.t.cpp
+// Description          : Example program for the class LUDecomposition.
+//========================================================================
+
+#include "LUDecomposition.hpp"
+#include "RowVector.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example factorizes a matrix once and reuses the factors for
+// several right hand sides, then applies a rank-1 change to an explicit
+// inverse with the Sherman-Morrison formula.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_LUDecomposition(argc, argv) main(argc, argv)
+#endif
+
+int test_LUDecomposition(int argc, char **argv)
+{
+ Matrix<4,4> A;
+ ColumnVector<4> b[3];
+ ColumnVector<4> x[3];
+ double error = 0;
+
+ A = 4, 1, 0, 2,
+     1, 5, 1, 0,
+     0, 1, 6, 1,
+     2, 0, 1, 7;
+ b[0] = 1, 0, 0, 0;
+ b[1] = 0, 1, 2, 3;
+ b[2] = 1, 1, 1, 1;
+
+ // factorize once, solve many times
+ LUDecomposition<4> lu(A);
+ lu.solve(b, x, 3);
+ for(int i = 0; i < 3; ++i)
+ {
+  cout << "x" << i << " = " << transpose(x[i]) << endl;
+  ColumnVector<4> r = A * x[i] - b[i];
+  if(r.norm() > error) error = r.norm();
+ }
+ cout << "det(A) = " << lu.determinant() << endl;
+
+ // inverse(A + u v') from inverse(A) in O(n^2)
+ Matrix<4,4> Ainv = lu.inverse();
+ ColumnVector<4> u, v;
+ u = 1, 0, 2, 0;
+ v = 0, 1, 0, 1;
+ shermanMorrisonUpdate(Ainv, u, v);
+
+ Matrix<4,4> I = (A + u * transpose(v)) * Ainv;
+ for(int r = 1; r <= 4; ++r)
+  for(int c = 1; c <= 4; ++c)
+   if(fabs(I(r,c) - ((r == c) ? 1 : 0)) > error) 
+    error = fabs(I(r,c) - ((r == c) ? 1 : 0));
+ cout << "(A + u v') * updated inverse:" << endl << I << endl;
+
+ cout << "largest error: " << error << endl;
+ return (error < 1e-12) ? 0 : 1;
+}
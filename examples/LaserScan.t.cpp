@@ -0,0 +1,127 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LaserScan.t.cpp
+// Description          : Example program for the class LaserScan.
+//========================================================================
+
+#include "LaserScan.hpp"
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+using namespace std;
+
+//========================================================================
+// This example projects a scan of 541 beams over 270 degrees, some of
+// which are missing (NaN, infinity or out of the valid ranges), to the
+// frame of a robot base on which the sensor is mounted tilted, in three
+// dimensions with a Transform and a RigidTransform, and in the plane
+// with an SE2, in double and in float. The points are compared with
+// those computed beam by beam with cos(), sin() and a Transform.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_LaserScan(argc, argv) main(argc, argv)
+#endif
+
+int test_LaserScan(int argc, char **argv)
+{
+ const int n = 541;
+ int failures = 0;
+ int i, count;
+ double range[n];
+ float frange[n];
+
+ for(i = 0; i < n; ++i)
+  range[i] = 2 + sin(0.05 * i);
+ range[0] = 0.01;                    // below the minimum range
+ range[7] = 35;                      // beyond the maximum range
+ range[100] = range[101] = range[102] = range[103] = sqrt(-1.0);
+ range[250] = HUGE_VAL;
+ range[n - 1] = sqrt(-1.0);
+ for(i = 0; i < n; ++i)
+  frange[i] = (float)range[i];
+
+ LaserScan<n> scan(-0.75 * M_PI, 1.5 * M_PI / (n - 1), 0.05, 30);
+ Transform mount = translation(0.2, 0.0, 0.4) * rpyRotation(0.02, 0.05, 0.1);
+ SE2<> base(0.2, 0.0, 0.1);
+
+ // beam by beam
+ double ex[n], ey[n], ez[n], px[n], py[n];
+ int expected = 0;
+ for(i = 0; i < n; ++i)
+ {
+  if(!(range[i] >= 0.05 && range[i] <= 30))
+   continue;
+  double a = -0.75 * M_PI + i * 1.5 * M_PI / (n - 1);
+  ColumnVector<4> p;
+  p = range[i] * cos(a), range[i] * sin(a), 0, 1;
+  ColumnVector<4> q = mount * p;
+  ColumnVector<4> q2 = base.toTransform() * p;
+  ex[expected] = q(1);
+  ey[expected] = q(2);
+  ez[expected] = q(3);
+  px[expected] = q2(1);
+  py[expected] = q2(2);
+  ++expected;
+ }
+
+ double x[n], y[n], z[n], error = 0;
+ int beam[n];
+ count = scan.project(range, mount, x, y, z, beam);
+ cout << count << " of " << n << " beams valid, expected " << expected << endl;
+ if(count != expected || beam[0] != 1 || beam[6] != 8) ++failures;
+ for(i = 0; i < count; ++i)
+ {
+  double d[] = {x[i] - ex[i], y[i] - ey[i], z[i] - ez[i]};
+  for(int k = 0; k < 3; ++k)
+   if(fabs(d[k]) > error) error = fabs(d[k]);
+ }
+ if(scan.project(range, RigidTransform<>(mount), x, y, z) != expected) ++failures;
+ for(i = 0; i < count; ++i)
+ {
+  double d[] = {x[i] - ex[i], y[i] - ey[i], z[i] - ez[i]};
+  for(int k = 0; k < 3; ++k)
+   if(fabs(d[k]) > error) error = fabs(d[k]);
+ }
+ if(scan.project(range, base, x, y) != expected) ++failures;
+ for(i = 0; i < count; ++i)
+ {
+  if(fabs(x[i] - px[i]) > error) error = fabs(x[i] - px[i]);
+  if(fabs(y[i] - py[i]) > error) error = fabs(y[i] - py[i]);
+ }
+ cout << "largest error of the points: " << error << endl;
+ if(error > 1e-13) ++failures;
+
+ // in the frame of the sensor, and in float
+ LaserScan<n, float> fscan(-0.75f * (float)M_PI, 1.5f * (float)M_PI / (n - 1), 0.05f, 30);
+ float fx[n], fy[n], fz[n];
+ double floatError = 0;
+ if(fscan.project(frange, RigidTransform<float>(translation<float>(0.2f, 0, 0.4f)
+                                                * rpyRotation<float>(0.02f, 0.05f, 0.1f)),
+                  fx, fy, fz) != expected) ++failures;
+ for(i = 0; i < count; ++i)
+ {
+  double d[] = {fx[i] - ex[i], fy[i] - ey[i], fz[i] - ez[i]};
+  for(int k = 0; k < 3; ++k)
+   if(fabs(d[k]) > floatError) floatError = fabs(d[k]);
+ }
+ cout << "largest error of the points in float: " << floatError << endl;
+ if(floatError > 1e-5) ++failures;
+
+ count = scan.project(range, x, y, beam);
+ error = 0;
+ for(i = 0; i < count; ++i)
+ {
+  double a = -0.75 * M_PI + beam[i] * 1.5 * M_PI / (n - 1);
+  if(fabs(x[i] - range[beam[i]] * cos(a)) > error) error = fabs(x[i] - range[beam[i]] * cos(a));
+  if(fabs(y[i] - range[beam[i]] * sin(a)) > error) error = fabs(y[i] - range[beam[i]] * sin(a));
+ }
+ cout << "largest error in the sensor frame: " << error << endl;
+ if(count != expected || error > 1e-14) ++failures;
+
+ return failures;
+}
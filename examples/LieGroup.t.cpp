@@ -0,0 +1,139 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : LieGroup.t.cpp
+// Description          : Example program for the exponential and
+//                        logarithm maps of SO(3) and SE(3).
+//========================================================================
+
+#include "LieGroup.hpp"
+#include "MatrixExponential.hpp"
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+using namespace std;
+
+//========================================================================
+// This example maps twists with rotation angles from zero to pi to
+// transforms and back. It compares expSE3() with the matrix exponential
+// of the 4x4 twist matrix and expSO3() with vectorRotation(), checks
+// the adjoint on a conjugated twist, and compares the left Jacobians
+// with finite differences and with their inverses.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_LieGroup(argc, argv) main(argc, argv)
+#endif
+
+template<int r, int c>
+static double largestDifference(const Matrix<r, c> &a, const Matrix<r, c> &b)
+{
+ double error = 0;
+ for(int i = 1; i <= r; ++i)
+  for(int j = 1; j <= c; ++j)
+   if(fabs(a(i, j) - b(i, j)) > error) error = fabs(a(i, j) - b(i, j));
+ return error;
+}
+
+// the 4x4 matrix [K rho; 0 0] of a twist, K the cross product matrix of phi
+static Matrix<4,4> twistMatrix(const ColumnVector<6> &xi)
+{
+ Matrix<4,4> m;
+ m = 0, -xi(6), xi(5), xi(1),
+     xi(6), 0, -xi(4), xi(2),
+     -xi(5), xi(4), 0, xi(3),
+     0, 0, 0, 0;
+ return m;
+}
+
+int test_LieGroup(int argc, char **argv)
+{
+ int failures = 0;
+ int i, k;
+ double error, expError = 0, logError = 0, adjointError = 0, jacobianError = 0;
+ const double angle[] = {0, 1e-9, 1e-4, 0.3, 0.999, 1.001, 2, 3, M_PI - 1e-6, M_PI};
+ const int count = sizeof(angle) / sizeof(angle[0]);
+
+ ColumnVector<3> axis, phi;
+ axis = 2, -1, 2;
+ axis = axis / 3;
+ Transform frame = translation(0.3, -1.2, 0.5) * rpyRotation(0.4, -0.7, 1.9);
+
+ for(i = 0; i < count; ++i)
+ {
+  ColumnVector<6> xi, back;
+  xi = 0.5, -0.2 + 0.1 * i, 1.1, 0, 0, 0;
+  phi = angle[i] * axis;
+  for(k = 1; k <= 3; ++k)
+   xi(k + 3) = phi(k);
+
+  // exponential against the matrix series and the rotation about an axis
+  Transform t = expSE3(xi);
+  error = largestDifference(t, expm(twistMatrix(xi)));
+  if(error > expError) expError = error;
+  error = largestDifference(expSO3(phi), vectorRotation(axis, angle[i]));
+  if(error > expError) expError = error;
+
+  // logarithm; at pi the twist is not unique, so compare the transforms
+  back = logSE3(t);
+  error = (angle[i] < 3.1) ? largestDifference(back, xi) : largestDifference(expSE3(back), t);
+  if(error > logError) logError = error;
+
+  // adjoint
+  error = largestDifference(expSE3(adjointSE3(frame) * xi), frame * t * inverse(frame));
+  if(error > adjointError) adjointError = error;
+
+  // left Jacobians: exp(xi + h d) exp(xi)^-1 = exp(h J d) to first order,
+  // against central differences, and times their inverses
+  Matrix<6,6> J = leftJacobianSE3(xi), difference;
+  const double h = 1e-6;
+  for(k = 1; k <= 6; ++k)
+  {
+   ColumnVector<6> d;
+   d = 0, 0, 0, 0, 0, 0;
+   d(k) = h;
+   ColumnVector<6> plus = logSE3(expSE3(xi + d) * inverse(t));
+   ColumnVector<6> minus = logSE3(expSE3(xi - d) * inverse(t));
+   for(int r = 1; r <= 6; ++r)
+    difference(r, k) = (plus(r) - minus(r)) / (2 * h);
+  }
+  if(angle[i] < 3)
+  {
+   error = largestDifference(J, difference) * 1e-3;    // finite differences lose about 1e-9
+   if(error > jacobianError) jacobianError = error;
+   error = largestDifference(inverseLeftJacobianSE3(xi) * J, unitMatrix<6, double>());
+   if(error > jacobianError) jacobianError = error;
+   error = largestDifference(inverseLeftJacobianSO3(phi) * leftJacobianSO3(phi),
+                             unitMatrix<3, double>());
+   if(error > jacobianError) jacobianError = error;
+  }
+  if(i == 6)
+   cout << "exp of twist " << transpose(xi) << ":" << endl << t << endl;
+ }
+ cout << "largest error of exp: " << expError << endl;
+ cout << "largest error of log: " << logError << endl;
+ cout << "largest error of the adjoint: " << adjointError << endl;
+ cout << "largest error of the Jacobians (finite differences scaled by 1e-3): "
+      << jacobianError << endl;
+ if(expError > 1e-14 || logError > 1e-14 || adjointError > 1e-14 || jacobianError > 1e-12)
+  ++failures;
+
+ // the Jacobians are continuous where the series meets the closed form
+ ColumnVector<6> below, above;
+ below = 0.2, -0.4, 0.3, 0, 0, 1 - 1e-15;
+ above = 0.2, -0.4, 0.3, 0, 0, 1 + 1e-15;
+ error = largestDifference(leftJacobianSE3(below), leftJacobianSE3(above));
+ cout << "Jacobian across theta = 1: " << error << endl;
+ if(error > 1e-14) ++failures;
+ phi = 1e-3 - 1e-16, 0, 0;
+ Matrix<3,3> jBelow = leftJacobianSO3(phi);
+ phi = 1e-3 + 1e-16, 0, 0;
+ error = largestDifference(jBelow, leftJacobianSO3(phi));
+ cout << "Jacobian across theta = 1e-3: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ return failures;
+}
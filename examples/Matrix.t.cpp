@@ -1,47 +1,62 @@
-//======================================================================== 
-// Package		: QMath - Template Math Library
-// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
-// Compatibility	: GCC 2.95.3 and above, MSVS 2005
-// File                 : Matrix.t.cpp
-// Description          : Example program for the class Matrix.
-//========================================================================
-
-#include "Matrix.hpp"
-#include "ColumnVector.hpp"
-#include "RowVector.hpp" 
-
-using namespace std;
-
-//========================================================================
-// This example demonstrates solving the foll. simultaneous eqns
-// 2 * x1 + 8 * x2 + 5 * x3 = 5,
-// 1 * x1 + 1 * x2 + 1 * x3 = -2,
-// 1 * x1 + 2 * x2 - 1 * x3 = 2.
-//========================================================================
-// If using GNUC makefile, just compile main function here. If using 
-// MS Visual C++, the main function is in examples_main.cpp
-#if defined(__GNUC__)
-    #define test_Matrix(argc, argv) main(argc, argv)
-#endif
-
-int test_Matrix(int argc, char **argv)
-
-{
- Matrix<3,3> A;
- Matrix<2,3> A1;
- ColumnVector<3> x;
- ColumnVector<3> b;
-
- // Write in Ax = b form
- A = 2, 8, 5,
-     1, 1, 1, 
-     1, 2, -1;
-
- b = 5, -2, 2;
- 
- // solve for x
- x = inverse(A) * b;
- cout << "solution: " << transpose(x) << endl;
-
- return 0;
-}
+//======================================================================== 
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Matrix.t.cpp
+// Description          : Example program for the class Matrix.
+//========================================================================
+
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+#include "RowVector.hpp" 
+
+using namespace std;
+
+//========================================================================
+// This example demonstrates solving the foll. simultaneous eqns
+// 2 * x1 + 8 * x2 + 5 * x3 = 5,
+// 1 * x1 + 1 * x2 + 1 * x3 = -2,
+// 1 * x1 + 2 * x2 - 1 * x3 = 2.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using 
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_Matrix(argc, argv) main(argc, argv)
+#endif
+
+int test_Matrix(int argc, char **argv)
+
+{
+ Matrix<3,3> A;
+ Matrix<2,3> A1;
+ ColumnVector<3> x;
+ ColumnVector<3> b;
+
+ // Write in Ax = b form
+ A = 2, 8, 5,
+     1, 1, 1, 
+     1, 2, -1;
+
+ b = 5, -2, 2;
+ 
+ // solve for x (without forming the inverse of A)
+ x = solve(A, b);
+ cout << "solution: " << transpose(x) << endl;
+
+ // several right hand sides at once: A * X = B
+ Matrix<3,2> B;
+ B = 5, 1,
+    -2, 0,
+     2, 1;
+ cout << "solutions (columns):" << endl << solve(A, B) << endl;
+
+ // larger systems are solved by LU decomposition
+ Matrix<6,6> C;
+ for (int r = 1; r <= 6; ++r)
+  for (int c = 1; c <= 6; ++c)
+   C(r, c) = (r == c) ? 4.0 : 1.0/(r + c);
+ Matrix<6,6> I = C * inverse(C);
+ cout << "C * inverse(C):" << endl << I << endl;
+
+ return 0;
+}
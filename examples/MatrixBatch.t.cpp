@@ -0,0 +1,147 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : MatrixBatch.t.cpp
+// Description          : Example program for batched matrix operations.
+//========================================================================
+
+#include "MatrixBatch.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example inverts arrays of 3x3 and 6x6 matrices, some of which are
+// singular, solves a batch of linear systems and computes determinants,
+// and compares the results with the single-matrix functions.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_MatrixBatch(argc, argv) main(argc, argv)
+#endif
+
+int test_MatrixBatch(int argc, char **argv)
+{
+ const int count = 101;
+ int failures = 0;
+ int i, r, c;
+
+ // well conditioned matrices, every tenth one made singular
+ Matrix<3,3> A3[count], A3inv[count];
+ Matrix<6,6> A6[count], A6inv[count];
+ Matrix<6,2> B6[count], X6[count];
+ double det3[count], det6[count];
+ bool singular3[count], singular6[count];
+ for(i = 0; i < count; ++i)
+ {
+  for(r = 1; r <= 6; ++r)
+  {
+   for(c = 1; c <= 6; ++c)
+    A6[i](r, c) = (r == c) ? 4 + 0.1 * i : sin(0.3 * i + r - 2.0 * c);
+   B6[i](r, 1) = r;
+   B6[i](r, 2) = cos(0.1 * i * r);
+  }
+  A6[i].getSubMatrix(1, 1, A3[i]);
+  if(i % 10 == 3)
+  {
+   for(r = 1; r <= 3; ++r)
+    A3[i](r, 3) = 2.0 * A3[i](r, 1);
+   for(c = 1; c <= 6; ++c)
+    A6[i](5, c) = A6[i](2, c);
+  }
+ }
+
+ int failed3 = inverse(A3, A3inv, count, singular3);
+ int failed6 = inverse(A6, A6inv, count, singular6);
+ determinant(A3, det3, count);
+ determinant(A6, det6, count);
+ cout << "singular 3x3 matrices: " << failed3
+      << ", singular 6x6 matrices: " << failed6 << endl;
+ if(failed3 != 10 || failed6 != 10) ++failures;
+
+ // compare with the single matrix functions
+ double error = 0;
+ for(i = 0; i < count; ++i)
+ {
+  if( singular3[i] != (i % 10 == 3) || singular6[i] != (i % 10 == 3) )
+   ++failures;
+  if(singular3[i])
+  {
+   if(fabs(det3[i]) > 1e-12) ++failures;
+   continue;
+  }
+  Matrix<3,3> E3 = A3inv[i] - inverse(A3[i]);
+  Matrix<6,6> E6 = A6inv[i] - inverse(A6[i]);
+  for(r = 1; r <= 3; ++r)
+   for(c = 1; c <= 3; ++c)
+    if(fabs(E3(r, c)) > error) error = fabs(E3(r, c));
+  for(r = 1; r <= 6; ++r)
+   for(c = 1; c <= 6; ++c)
+    if(fabs(E6(r, c)) > error) error = fabs(E6(r, c));
+  if(fabs(det3[i] - determinant(A3[i])) > 1e-9 * fabs(det3[i])) ++failures;
+  if(fabs(det6[i] - determinant(A6[i])) > 1e-9 * fabs(det6[i])) ++failures;
+ }
+ cout << "largest difference from inverse(): " << error << endl;
+ if(error > 1e-12) ++failures;
+
+ // solve in place; singular systems keep their right hand side
+ Matrix<6,2> B6copy[count];
+ bool singular[count];
+ for(i = 0; i < count; ++i)
+  B6copy[i] = B6[i];
+ int failedSolve = solve(A6, B6, B6, count, singular);
+ error = 0;
+ for(i = 0; i < count; ++i)
+ {
+  Matrix<6,2> E;
+  if(singular[i])
+   E = B6[i] - B6copy[i];
+  else
+   E = A6[i] * B6[i] - B6copy[i];
+  for(r = 1; r <= 6; ++r)
+   for(c = 1; c <= 2; ++c)
+    if(fabs(E(r, c)) > error) error = fabs(E(r, c));
+ }
+ cout << "singular systems: " << failedSolve
+      << ", largest residual: " << error << endl;
+ if(failedSolve != 10 || error > 1e-12) ++failures;
+
+ // nearly singular 4x4 and 3x3 matrices L U, U = diag(1, h, 2, 3) with
+ // h below the singularity threshold: the batch determinants are the
+ // small ones of determinant(), at every size
+ const double h[] = {3e-13, -1e-14, 1e-17, 0};
+ Matrix<4,4> L, U, A4[4];
+ Matrix<3,3> N3[4];
+ double det4[4], detN3[4];
+ L = 1, 0, 0, 0,
+     0.5, 1, 0, 0,
+     -0.25, 0.75, 1, 0,
+     0.8, -0.6, 0.4, 1;
+ for(i = 0; i < 4; ++i)
+ {
+  U = 1, 0.3, -0.2, 0.5,
+      0, h[i], 0.7, -0.4,
+      0, 0, 2, 0.1,
+      0, 0, 0, 3;
+  A4[i] = L * U;
+  A4[i].getSubMatrix(1, 1, N3[i]);
+ }
+ determinant(A4, det4, 4);
+ determinant(N3, detN3, 4);
+ error = 0;
+ for(i = 0; i < 4; ++i)
+ {
+  cout << "det(L U) with h = " << h[i] << ": " << det4[i]
+       << ", single: " << determinant(A4[i]) << endl;
+  if(fabs(det4[i] - 6 * h[i]) > error) error = fabs(det4[i] - 6 * h[i]);
+  if(fabs(det4[i] - determinant(A4[i])) > error) error = fabs(det4[i] - determinant(A4[i]));
+  if(fabs(detN3[i] - determinant(N3[i])) > error) error = fabs(detN3[i] - determinant(N3[i]));
+ }
+ cout << "largest error of the nearly singular determinants: " << error << endl;
+ if(error > 1e-15 || det4[0] == 0 || det4[1] == 0) ++failures;
+
+ cout << "A6[0]^-1 = " << endl << A6inv[0] << endl;
+
+ return failures;
+}
@@ -0,0 +1,74 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : MatrixExponential.t.cpp
+// Description          : Example program for the matrix exponential.
+//========================================================================
+
+#include <math.h>
+#include "MatrixExponential.hpp"
+#include "Vector.hpp"
+#include "RowVector.hpp"
+
+using namespace std;
+
+//========================================================================
+// This program propagates the mass-spring-damper of the ODESolverRK4
+// example with its exact discrete-time transition matrix, and compares
+// the result with the analytical solution. It then discretizes the same
+// plant with a force input using a zero-order hold.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_MatrixExponential(argc, argv) main(argc, argv)
+#endif
+
+int test_MatrixExponential(int argc, char **argv)
+{
+ double dt = 0.001;
+ double M = 1.0;  // mass (kg)
+ double K = 10.0; // spring stiffness coefficient (N/m)
+ double f = 2.0;  // viscous friction coefficient (Ns/m)
+
+ // state [velocity; position]
+ Matrix<2,2> A;
+ Matrix<2,1> B;
+ A = -f/M, -K/M,
+     1.0, 0.0;
+ B = 1.0/M, 0.0;
+
+ // computed once, reused every step
+ Matrix<2,2> Ad = expm(A * dt);
+
+ Vector<2> y;
+ y = 2.0, 4.0;
+ double error = 0;
+ for(int k = 1; k <= 10000; ++k)
+ {
+  y = Ad * y;
+  double t = k * dt;
+  double analytical = exp(-t)*(4*cos(3 * t) + 2 * sin(3 * t));
+  if(fabs(analytical - y(2)) > error) error = fabs(analytical - y(2));
+ }
+ cout << "transition matrix over " << dt << "s:" << endl << Ad << endl;
+ cout << "largest error against analytical solution: " << error << endl;
+
+ // x(k+1) = Ad x(k) + Bd u(k) for a force held over each period
+ Matrix<2,2> Ad2;
+ Matrix<2,1> Bd;
+ zeroOrderHold(A, B, 0.1, Ad2, Bd);
+ cout << "zero-order hold over 0.1s:" << endl << "Ad = " << endl << Ad2 << endl 
+      << "Bd = " << transpose(Bd) << endl;
+
+ // the steady state of a unit step is the static deflection 1/K
+ Vector<2> x;
+ x = 0, 0;
+ for(int k = 0; k < 200; ++k)
+  x = Ad2 * x + Bd * 1.0;
+ cout << "step response after 20s: " << transpose(x) << endl;
+ if(fabs(x(2) - 1.0/K) > error) error = fabs(x(2) - 1.0/K);
+
+ return (error < 1e-9) ? 0 : 1;
+}
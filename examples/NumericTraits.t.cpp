@@ -0,0 +1,99 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : NumericTraits.t.cpp
+// Description          : Example program for single precision data and
+//                        type-dependent tolerances.
+//========================================================================
+
+#define QMATH_MIXED_PRECISION
+#include "Matrix.hpp"
+#include "ColumnVector.hpp"
+#include "RowVector.hpp"
+#include "Integrator.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example uses the library with float data: a matrix inverse, a
+// vector integrator, and a long dot product accumulated in double
+// (QMATH_MIXED_PRECISION is defined above). It also shows that the
+// singularity threshold depends on the data type.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_NumericTraits(argc, argv) main(argc, argv)
+#endif
+
+int test_NumericTraits(int argc, char **argv)
+{
+ int failures = 0;
+
+ // float matrices, scaled by double constants
+ Matrix<3,3,float> A, Ainv, E;
+ A = 4, 1, 0,
+     1, 3, 1,
+     0, 1, 2;
+ Ainv = inverse(0.5 * A) * 0.5;
+ E = A * Ainv - unitMatrix<3,float>();
+ float err = 0;
+ for(int r = 1; r <= 3; ++r)
+  for(int c = 1; c <= 3; ++c)
+   if(fabs(E(r,c)) > err) err = fabs(E(r,c));
+ cout << "float inverse error: " << err << endl;
+ if(err > 1e-5) ++failures;
+
+ // the same nearly singular matrix in float and double
+ Matrix<2,2,float> Sf;
+ Matrix<2,2,double> Sd;
+ Sf = 1, 1,
+      1, 1.0000001;
+ Sd = 1, 1,
+      1, 1.0000001;
+ try
+ {
+  inverse(Sf);
+  cout << "float: inverted (unexpected)" << endl;
+  ++failures;
+ }
+ catch(MathException &e)
+ {
+  cout << "float: " << e.getErrorMessage() << endl;
+ }
+ try
+ {
+  inverse(Sd);
+  cout << "double: inverted, determinant " << determinant(Sd) << endl;
+ }
+ catch(MathException &e)
+ {
+  cout << "double: " << e.getErrorMessage() << " (unexpected)" << endl;
+  ++failures;
+ }
+
+ // filters and integrators work on float vectors
+ Integrator<ColumnVector<3,float> > integrator;
+ ColumnVector<3,float> rate, angle;
+ rate = 1, 2, 3;
+ for(int i = 0; i < 1000; ++i)
+  angle = integrator.integrate(rate);
+ cout << "integrated rate over 1s: " << transpose(angle) << endl;
+ if(fabs(angle(3) - 2.9985) > 1e-3) ++failures;
+
+ // long dot product, accumulated in double
+ ColumnVector<4096,float> x, y;
+ double reference = 0;
+ for(int i = 1; i <= 4096; ++i)
+ {
+  x(i) = 0.1f;
+  y(i) = 1.0f / i;
+  reference += (double)x(i) * (double)y(i);
+ }
+ float dp = dotProduct(x, y);
+ cout << "dot product: " << dp << " reference: " << reference << endl;
+ if(fabs(dp - reference) > 1e-6 * reference) ++failures;
+
+ return failures;
+}
@@ -0,0 +1,107 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : PointBatch.t.cpp
+// Description          : Example program for batched point
+//                        transformation.
+//========================================================================
+
+#include "PointBatch.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example transforms a set of points in each of the supported
+// layouts, in place and out of place, and compares every result with
+// the product of the Transform and a homogeneous ColumnVector<4>.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_PointBatch(argc, argv) main(argc, argv)
+#endif
+
+int test_PointBatch(int argc, char **argv)
+{
+ int failures = 0;
+ int i, r;
+ const int count = 1001;   // not a multiple of four or of QMATH_BATCH_CHUNK
+
+ Transform T = rpyRotation(0.3, -1.2, 2.1) * translation(1.5, -0.5, 3);
+ RigidTransform<> R(T);
+
+ double *x = new double[count], *y = new double[count], *z = new double[count];
+ double *tx = new double[count], *ty = new double[count], *tz = new double[count];
+ double *xyz = new double[3 * count];
+ Vec3<> *v = new Vec3<>[count];
+ ColumnVector<3> *c = new ColumnVector<3>[count], *tc = new ColumnVector<3>[count];
+ ColumnVector<4> *expected = new ColumnVector<4>[count];
+ ColumnVector<4> h;
+ for(i = 0; i < count; ++i)
+ {
+  x[i] = 10 * sin(0.1 * i);
+  y[i] = 5 * cos(0.37 * i);
+  z[i] = 0.01 * i - 3;
+  xyz[3 * i] = x[i];
+  xyz[3 * i + 1] = y[i];
+  xyz[3 * i + 2] = z[i];
+  v[i] = Vec3<>(x[i], y[i], z[i]);
+  c[i] = x[i], y[i], z[i];
+  h = x[i], y[i], z[i], 1;
+  expected[i] = T * h;
+ }
+
+ // out of place, component arrays
+ transformPoints(T, x, y, z, tx, ty, tz, count);
+ double error = 0;
+ for(i = 0; i < count; ++i)
+ {
+  if(fabs(tx[i] - expected[i](1)) > error) error = fabs(tx[i] - expected[i](1));
+  if(fabs(ty[i] - expected[i](2)) > error) error = fabs(ty[i] - expected[i](2));
+  if(fabs(tz[i] - expected[i](3)) > error) error = fabs(tz[i] - expected[i](3));
+ }
+ cout << "component arrays: largest error " << error << endl;
+ if(error > 1e-13) ++failures;
+
+ // in place, the other layouts
+ transformPoints(R, xyz, xyz, count);
+ transformPoints(T, v, v, count);
+ transformPoints(R, c, tc, count);
+ error = 0;
+ for(i = 0; i < count; ++i)
+  for(r = 1; r <= 3; ++r)
+  {
+   double e = expected[i](r);
+   if(fabs(xyz[3 * i + r - 1] - e) > error) error = fabs(xyz[3 * i + r - 1] - e);
+   if(fabs(v[i](r) - e) > error) error = fabs(v[i](r) - e);
+   if(fabs(tc[i](r) - e) > error) error = fabs(tc[i](r) - e);
+  }
+ cout << "interleaved, Vec3 and ColumnVector arrays: largest error " << error << endl;
+ if(error > 1e-13) ++failures;
+ for(i = 0; i < count; ++i)
+  if(v[i].getElementsPointer()[3] != 0) ++failures;   // padding stays zero
+
+ // single precision, in place
+ float *f = new float[3 * count];
+ for(i = 0; i < count; ++i)
+ {
+  f[i] = (float)x[i];
+  f[count + i] = (float)y[i];
+  f[2 * count + i] = (float)z[i];
+ }
+ transformPoints(T, f, f + count, f + 2 * count, f, f + count, f + 2 * count, count);
+ error = 0;
+ for(i = 0; i < count; ++i)
+  for(r = 1; r <= 3; ++r)
+   if(fabs(f[(r - 1) * count + i] - expected[i](r)) > error)
+    error = fabs(f[(r - 1) * count + i] - expected[i](r));
+ cout << "float component arrays: largest error " << error << endl;
+ if(error > 1e-5) ++failures;
+
+ delete [] x; delete [] y; delete [] z;
+ delete [] tx; delete [] ty; delete [] tz;
+ delete [] xyz; delete [] v; delete [] c; delete [] tc;
+ delete [] expected; delete [] f;
+ return failures;
+}
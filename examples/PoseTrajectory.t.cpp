@@ -0,0 +1,129 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : PoseTrajectory.t.cpp
+// Description          : Example program for the class PoseTrajectory.
+//========================================================================
+
+#include "PoseTrajectory.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example interpolates a trajectory through three waypoints, checks
+// that it passes through the waypoints, that the orientation follows
+// slerp() and the position the straight line, that the cubic and
+// quintic time scalings start and stop at rest, and that the batched
+// sampling gives the same poses as getPose().
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_PoseTrajectory(argc, argv) main(argc, argv)
+#endif
+
+static double largestDifference(const Matrix<4,4> &a, const Matrix<4,4> &b)
+{
+ double error = 0;
+ for(int r = 1; r <= 4; ++r)
+  for(int c = 1; c <= 4; ++c)
+   if(fabs(a(r, c) - b(r, c)) > error) error = fabs(a(r, c) - b(r, c));
+ return error;
+}
+
+int test_PoseTrajectory(int argc, char **argv)
+{
+ int failures = 0;
+ int i;
+ double error;
+
+ Transform w[3];
+ w[0] = translation(0, 0, 0.5);
+ w[1] = translation(0.4, -0.2, 0.8) * rpyRotation(1.2, -0.4, 0.9);
+ w[2] = translation(0.6, 0.3, 0.2) * rpyRotation(-2.5, 0.3, 2.8);
+ double time[3] = {1.0, 3.0, 3.5};
+
+ PoseTrajectory<3> trajectory;
+ for(i = 0; i < 3; ++i)
+  trajectory.setWaypoint(i + 1, time[i], w[i]);
+ cout << "pose at t = 2:" << endl << trajectory.getPose(2.0) << endl;
+
+ // through the waypoints, and at rest before and after
+ error = 0;
+ for(i = 0; i < 3; ++i)
+ {
+  double e = largestDifference(trajectory.getPose(time[i]), w[i]);
+  if(e > error) error = e;
+ }
+ if(largestDifference(trajectory.getPose(0.0), w[0]) > error)
+  error = largestDifference(trajectory.getPose(0.0), w[0]);
+ if(largestDifference(trajectory.getPose(9.0), w[2]) > error)
+  error = largestDifference(trajectory.getPose(9.0), w[2]);
+ cout << "largest error at the waypoints: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // orientation follows slerp, position the straight line
+ Quaternion<> q0(w[1]), q1(w[2]);
+ error = 0;
+ for(i = 0; i <= 10; ++i)
+ {
+  double s = 0.1 * i;
+  Transform expected = slerp(q0, q1, s).toTransform();
+  for(int r = 1; r <= 3; ++r)
+   expected(r, 4) = (1 - s) * w[1](r, 4) + s * w[2](r, 4);
+  double e = largestDifference(trajectory.getPose(3.0 + 0.5 * s), expected);
+  if(e > error) error = e;
+ }
+ cout << "largest difference from slerp: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // cubic and quintic: halfway at the middle, at rest at the waypoints
+ QMathTimeScaling_t scaling[2] = {QMathTimeScaling_cubic, QMathTimeScaling_quintic};
+ for(i = 0; i < 2; ++i)
+ {
+  trajectory.setTimeScaling(QMathTimeScaling_linear);
+  Transform linear = trajectory.getPose(3.25);
+  trajectory.setTimeScaling(scaling[i]);
+  error = largestDifference(trajectory.getPose(3.25), linear);
+  double h = 1e-4;
+  double v0 = largestDifference(trajectory.getPose(1.0 + h), w[0]) / h;
+  double v1 = largestDifference(trajectory.getPose(3.0 - h), w[1]) / h;
+  cout << (i ? "quintic" : "cubic") << ": difference at the middle " << error
+       << ", speed near the waypoints " << v0 << ", " << v1 << endl;
+  if(error > 1e-14 || v0 > 1e-3 || v1 > 1e-3) ++failures;
+ }
+
+ // batched sampling
+ const int count = 600;
+ Transform poses[count];
+ double times[count];
+ trajectory.getPoses(0.5, 0.005, poses, count);
+ error = 0;
+ for(i = 0; i < count; ++i)
+ {
+  times[count - 1 - i] = 0.5 + 0.005 * i;
+  double e = largestDifference(poses[i], trajectory.getPose(0.5 + 0.005 * i));
+  if(e > error) error = e;
+ }
+ trajectory.getPoses(times, poses, count);
+ for(i = 0; i < count; ++i)
+ {
+  double e = largestDifference(poses[i], trajectory.getPose(times[i]));
+  if(e > error) error = e;
+ }
+ cout << "largest difference of batched sampling: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ try
+ {
+  trajectory.setWaypoint(4, 5.0, w[0]);
+  ++failures;
+ }
+ catch(MathException &e)
+ {
+  cout << "waypoint 4: " << e.getErrorMessage() << endl;
+ }
+
+ return failures;
+}
@@ -0,0 +1,128 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Quaternion.t.cpp
+// Description          : Example program for the class Quaternion.
+//========================================================================
+
+#include "Quaternion.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example composes rotations as quaternions and as transforms and
+// compares the results, converts between quaternions, transforms and
+// roll-pitch-yaw angles, rotates a vector, and interpolates between two
+// orientations.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_Quaternion(argc, argv) main(argc, argv)
+#endif
+
+static double largestDifference(const Matrix<4,4> &a, const Matrix<4,4> &b)
+{
+ double error = 0;
+ for(int r = 1; r <= 4; ++r)
+  for(int c = 1; c <= 4; ++c)
+   if(fabs(a(r, c) - b(r, c)) > error) error = fabs(a(r, c) - b(r, c));
+ return error;
+}
+
+int test_Quaternion(int argc, char **argv)
+{
+ int failures = 0;
+ int i, r;
+ double error;
+
+ // roll-pitch-yaw, and composition
+ Quaternion<> q = rpyQuaternion(0.4, -0.3, 1.1);
+ cout << "q = " << q << endl;
+ error = largestDifference(q.toTransform(), rpyRotation(0.4, -0.3, 1.1));
+ cout << "difference from rpyRotation: " << error << endl;
+ if(error > 1e-15) ++failures;
+
+ ColumnVector<3> axis;
+ axis = 1, -2, 2;
+ axis = axis / 3;
+ Quaternion<> p(axis, 2.5);
+ Transform T = vectorRotation(axis, 2.5) * rpyRotation(0.4, -0.3, 1.1);
+ error = largestDifference((p * q).toTransform(), T);
+ cout << "difference of the product from Transform product: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // conversions back
+ double roll, pitch, yaw;
+ q.getRollPitchYaw(roll, pitch, yaw);
+ cout << "roll, pitch, yaw = " << roll << ", " << pitch << ", " << yaw << endl;
+ if(fabs(roll - 0.4) > 1e-15 || fabs(pitch + 0.3) > 1e-15 || fabs(yaw - 1.1) > 1e-15) ++failures;
+
+ error = 0;
+ for(i = 0; i < 16; ++i)  // rotations of all sizes, to reach every case of the conversion
+ {
+  Quaternion<> a = rpyQuaternion(0.4 * i, 0.2 * i - 1.5, 3.0 - 0.5 * i);
+  Quaternion<> b(a.toTransform());
+  if(dotProduct(a, b) < 0) b = Quaternion<>(-b.w(), -b.x(), -b.y(), -b.z());
+  for(r = 0; r < 4; ++r)
+   if(fabs(a.getElementsPointer()[r] - b.getElementsPointer()[r]) > error)
+    error = fabs(a.getElementsPointer()[r] - b.getElementsPointer()[r]);
+ }
+ cout << "largest error of conversion from Transform: " << error << endl;
+ if(error > 1e-15) ++failures;
+
+ // rotating a vector
+ ColumnVector<3> v;
+ v = 0.5, -1.5, 2;
+ ColumnVector<3> v1 = rotate(p * q, v);
+ Vec3<> v2 = rotate(p * q, Vec3<>(v));
+ Vec3<> v3 = rotate(T, Vec3<>(v));
+ error = 0;
+ for(r = 1; r <= 3; ++r)
+ {
+  if(fabs(v1(r) - v3(r)) > error) error = fabs(v1(r) - v3(r));
+  if(fabs(v2(r) - v3(r)) > error) error = fabs(v2(r) - v3(r));
+ }
+ cout << "largest error of rotated vector: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // the conjugate undoes the rotation
+ Quaternion<> e = conjugate(q) * q;
+ if(fabs(e.w() - 1) > 1e-15 || fabs(e.x()) > 1e-15 || fabs(e.y()) > 1e-15 || fabs(e.z()) > 1e-15)
+  ++failures;
+
+ // normalization after many products
+ Quaternion<> step = rpyQuaternion(0.01, 0.02, -0.03), s;
+ for(i = 0; i < 10000; ++i)
+  s = s * step;
+ cout << "norm after 10000 products: " << s.norm() << endl;
+ s.normalize();
+ if(fabs(s.norm() - 1) > 1e-15) ++failures;
+
+ // interpolation: the angle from the start grows uniformly with slerp
+ Quaternion<> a = rpyQuaternion(0.1, 0.2, 0.3);
+ Quaternion<> b = rpyQuaternion(1.2, -0.4, 0.9);
+ double total = 2 * acos(fabs(dotProduct(a, b)));
+ error = 0;
+ for(i = 0; i <= 10; ++i)
+ {
+  Quaternion<> c = slerp(a, b, 0.1 * i);
+  double d = fabs(dotProduct(a, c));
+  double angle = 2 * acos(d > 1 ? 1 : d);
+  if(fabs(angle - 0.1 * i * total) > error) error = fabs(angle - 0.1 * i * total);
+ }
+ cout << "largest angle error of slerp: " << error << endl;
+ if(error > 1e-7) ++failures;
+
+ Quaternion<> m1 = slerp(a, b, 0.5), m2 = nlerp(a, b, 0.5);
+ cout << "slerp halfway: " << m1 << endl << "nlerp halfway: " << m2 << endl;
+ if(fabs(fabs(dotProduct(m1, m2)) - 1) > 1e-15) ++failures;  // equal at the midpoint
+ if(fabs(slerp(a, a, 0.3).w() - a.w()) > 1e-15) ++failures;
+
+ // slerp takes the shorter arc when given -b, the same rotation as b
+ Quaternion<> nb(-b.w(), -b.x(), -b.y(), -b.z());
+ if(fabs(fabs(dotProduct(slerp(a, nb, 0.5), m1)) - 1) > 1e-15) ++failures;
+
+ return failures;
+}
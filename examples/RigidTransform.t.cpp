@@ -0,0 +1,91 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : RigidTransform.t.cpp
+// Description          : Example program for the class RigidTransform.
+//========================================================================
+
+#include "RigidTransform.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example builds a chain of link transforms, composes it both as
+// RigidTransform and as Transform, and compares the results, the
+// inverses and transformed points. It also checks that converting a
+// Transform to a RigidTransform and back is exact.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_RigidTransform(argc, argv) main(argc, argv)
+#endif
+
+int test_RigidTransform(int argc, char **argv)
+{
+ int failures = 0;
+ int i, r, c;
+
+ // a chain of six links
+ Transform T;
+ RigidTransform<> R;
+ for(i = 0; i < 6; ++i)
+ {
+  Transform link = rpyRotation(0.3 * i, -0.2 + 0.1 * i, 0.7) * translation(0.1, 0.2 * i, -0.3);
+  T = T * link;
+  R = R * RigidTransform<>(link);
+ }
+ cout << "composed RigidTransform = " << endl << R;
+
+ double error = 0;
+ Matrix<4,4> D = R.toTransform() - T;
+ for(r = 1; r <= 4; ++r)
+  for(c = 1; c <= 4; ++c)
+   if(fabs(D(r, c)) > error) error = fabs(D(r, c));
+ cout << "largest difference from Transform product: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // inverse
+ error = 0;
+ RigidTransform<> I = R * inverse(R);
+ D = inverse(R).toTransform() - inverse(T);
+ for(r = 1; r <= 3; ++r)
+  for(c = 1; c <= 4; ++c)
+  {
+   if(fabs(I(r, c) - ((r == c) ? 1 : 0)) > error) error = fabs(I(r, c) - ((r == c) ? 1 : 0));
+   if(fabs(D(r, c)) > error) error = fabs(D(r, c));
+  }
+ cout << "largest error of the inverse: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // points
+ ColumnVector<3> p;
+ p = 0.5, -1.5, 2;
+ ColumnVector<4> h;
+ h = 0.5, -1.5, 2, 1;
+ ColumnVector<4> q = T * h;
+ ColumnVector<3> p1 = R * p;
+ Vec3<> p2 = R * Vec3<>(p);
+ Vec3<> d = rotate(R, Vec3<>(p));
+ ColumnVector<3> d1 = R.getRotation() * p;
+ error = 0;
+ for(r = 1; r <= 3; ++r)
+ {
+  if(fabs(p1(r) - q(r)) > error) error = fabs(p1(r) - q(r));
+  if(fabs(p2(r) - q(r)) > error) error = fabs(p2(r) - q(r));
+  if(fabs(d(r) - d1(r)) > error) error = fabs(d(r) - d1(r));
+ }
+ cout << "largest error of transformed points: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // conversion is loss-free
+ Transform back = RigidTransform<>(T).toTransform();
+ if(back != T) ++failures;
+ Matrix<3,3> rotation;
+ T.getSubMatrix(1, 1, rotation);
+ RigidTransform<> parts(rotation, T.getTranslation());
+ if(parts.toTransform() != T) ++failures;
+
+ return failures;
+}
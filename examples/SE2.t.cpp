@@ -0,0 +1,146 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SE2.t.cpp
+// Description          : Example program for the class SE2.
+//========================================================================
+
+#include "SE2.hpp"
+#include "LieGroup.hpp"
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+using namespace std;
+
+//========================================================================
+// This example integrates the odometry of a base driving on a circle
+// and compares the pose with the exponential of the whole twist and
+// with the same products of Transform. It compares expSE2() with
+// expSE3() and maps the poses back with logSE2() for angles from zero
+// to pi, and transforms a scan of 2D points one at a time and batched,
+// in double and in float.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_SE2(argc, argv) main(argc, argv)
+#endif
+
+template<int r, int c>
+static double largestDifference(const Matrix<r, c> &a, const Matrix<r, c> &b)
+{
+ double error = 0;
+ for(int i = 1; i <= r; ++i)
+  for(int j = 1; j <= c; ++j)
+   if(fabs(a(i, j) - b(i, j)) > error) error = fabs(a(i, j) - b(i, j));
+ return error;
+}
+
+int test_SE2(int argc, char **argv)
+{
+ int failures = 0;
+ int i;
+ double error;
+
+ // odometry: 1000 steps of 0.2 m/s and 0.5 rad/s over 10 ms each
+ ColumnVector<3> step, whole;
+ step = 0.002, 0, 0.005;
+ whole = 1000.0 * step;
+ SE2<> delta = expSE2(step), pose;
+ Transform T;
+ for(i = 0; i < 1000; ++i)
+ {
+  pose = pose * delta;
+  T = T * delta.toTransform();
+ }
+ pose.normalize();
+ cout << "pose after 1000 steps (x, y, theta): " << pose;
+ error = largestDifference(pose.toTransform(), expSE2(whole).toTransform());
+ cout << "largest difference from the exponential: " << error << endl;
+ if(error > 1e-13) ++failures;
+ error = largestDifference(pose.toTransform(), T);
+ cout << "largest difference from the Transform product: " << error << endl;
+ if(error > 1e-13) ++failures;
+
+ // inverse, and the round trip through a Transform
+ error = largestDifference((pose * inverse(pose)).toTransform(), Transform());
+ error += largestDifference(inverse(pose).toTransform(), inverse(T));
+ cout << "largest error of the inverse: " << error << endl;
+ if(error > 1e-13) ++failures;
+ Transform P = pose.toTransform();
+ if(SE2<>(P).toTransform() != P) ++failures;
+
+ // exponential against SE(3), logarithm back
+ const double angle[] = {0, 1e-9, -1e-4, 0.01, 0.3, -1, 2, 3, M_PI - 1e-6, -M_PI + 1e-9};
+ double expError = 0, logError = 0;
+ for(i = 0; i < (int)(sizeof(angle) / sizeof(angle[0])); ++i)
+ {
+  ColumnVector<3> xi;
+  ColumnVector<6> xi6;
+  xi = 0.7, -0.4 + 0.1 * i, angle[i];
+  xi6 = xi(1), xi(2), 0, 0, 0, xi(3);
+  error = largestDifference(expSE2(xi).toTransform(), expSE3(xi6));
+  if(error > expError) expError = error;
+  error = largestDifference(logSE2(expSE2(xi)), xi);
+  if(error > logError) logError = error;
+ }
+ cout << "largest error of exp: " << expError << endl;
+ cout << "largest error of log: " << logError << endl;
+ if(expError > 1e-15 || logError > 1e-13) ++failures;
+
+ // the series meet the closed forms continuously at omega = 0.01
+ ColumnVector<3> below, above;
+ below = 0.3, 0.2, 0.01 - 1e-16;
+ above = 0.3, 0.2, 0.01 + 1e-16;
+ error = largestDifference(expSE2(below).toTransform(), expSE2(above).toTransform());
+ error += largestDifference(logSE2(SE2<>(0.3, 0.2, 0.01 - 1e-16)),
+                            logSE2(SE2<>(0.3, 0.2, 0.01 + 1e-16)));
+ cout << "maps across omega = 0.01: " << error << endl;
+ if(error > 1e-15) ++failures;
+
+ // a scan of 11 points, one at a time and batched
+ const int count = 11;
+ double x[count], y[count], tx[count], ty[count], xy[2 * count];
+ float fx[count], fy[count], fxy[2 * count];
+ for(i = 0; i < count; ++i)
+ {
+  x[i] = 2 * cos(0.2 * i);
+  y[i] = sin(0.2 * i) - 0.5;
+  xy[2 * i] = x[i];
+  xy[2 * i + 1] = y[i];
+  fx[i] = (float)x[i];
+  fy[i] = (float)y[i];
+  fxy[2 * i] = fx[i];
+  fxy[2 * i + 1] = fy[i];
+ }
+ SE2<float> fpose((float)pose.x(), (float)pose.y(), (float)pose.angle());
+ transformPoints(pose, x, y, tx, ty, count);
+ transformPoints(pose, xy, xy, count);
+ transformPoints(fpose, fx, fy, fx, fy, count);
+ transformPoints(fpose, fxy, fxy, count);
+ double floatError = 0;
+ error = 0;
+ for(i = 0; i < count; ++i)
+ {
+  ColumnVector<4> h;
+  h = 2 * cos(0.2 * i), sin(0.2 * i) - 0.5, 0, 1;
+  ColumnVector<4> q = T * h;
+  ColumnVector<2> p;
+  p = h(1), h(2);
+  p = pose * p;
+  double d[] = {p(1) - q(1), p(2) - q(2), tx[i] - q(1), ty[i] - q(2),
+                xy[2 * i] - q(1), xy[2 * i + 1] - q(2)};
+  for(int k = 0; k < 6; ++k)
+   if(fabs(d[k]) > error) error = fabs(d[k]);
+  double f[] = {fx[i] - q(1), fy[i] - q(2), fxy[2 * i] - q(1), fxy[2 * i + 1] - q(2)};
+  for(int k = 0; k < 4; ++k)
+   if(fabs(f[k]) > floatError) floatError = fabs(f[k]);
+ }
+ cout << "largest error of transformed points: " << error << endl;
+ cout << "largest error of transformed points in float: " << floatError << endl;
+ if(error > 1e-14 || floatError > 1e-5) ++failures;
+
+ return failures;
+}
@@ -0,0 +1,94 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SimdLinkage.t.cpp
+// Description          : Example program that mixes the SIMD code of
+//                        libQMath with that of a program compiled for
+//                        other instruction sets.
+//========================================================================
+
+#include "Transform.hpp"
+
+using namespace std;
+
+//========================================================================
+// The makefile compiles this example with -mavx2 -mfma and links it
+// with the static library libQMath.a, which is compiled for SSE2. The
+// example instantiates the SIMD functions that the library uses
+// internally (Simd4<double>, fastSinCos(), fastAtan2()) by calling the
+// templates itself, then calls the prebuilt double versions of
+// rpyRotation(), vectorRotation() and the batched getRollPitchYaw()
+// with QMathTrig_fast, and checks the angles they return. Each side
+// must keep its own copies of the SIMD functions (see Simd.hpp).
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_SimdLinkage(argc, argv) main(argc, argv)
+#endif
+
+int test_SimdLinkage(int argc, char **argv)
+{
+ int failures = 0;
+ const int count = 8;
+ int i;
+
+#if defined(QMATH_AVX2) && defined(__GNUC__)
+ if(!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma"))
+ {
+  cout << "the processor has no AVX2 and FMA, nothing to check" << endl;
+  return 0;
+ }
+#endif
+
+ double roll[count], pitch[count], yaw[count], r[count], p[count], y[count];
+ TransformT<double> t[count];
+ for(i = 0; i < count; ++i)
+ {
+  roll[i] = 0.3 * i - 1;
+  pitch[i] = 0.1 * i - 0.4;
+  yaw[i] = 0.2 * i + 0.1;
+ }
+
+ // the templates, compiled here
+ double error = 0;
+ rpyRotation<double>(roll, pitch, yaw, t, count, QMathTrig_fast);
+ getRollPitchYaw<double>(t, r, p, y, count, QMathTrig_fast);
+ for(i = 0; i < count; ++i)
+ {
+  double a, b, c;
+  t[i].getRollPitchYaw(a, b, c, QMathTrig_fast);
+  error += fabs(a - r[i]) + fabs(b - p[i]) + fabs(c - y[i]);
+ }
+
+ // the double versions, compiled in the library
+ for(i = 0; i < count; ++i)
+  t[i] = rpyRotation(roll[i], pitch[i], yaw[i], QMathTrig_fast);
+ getRollPitchYaw(t, r, p, y, count, QMathTrig_fast);
+ for(i = 0; i < count; ++i)
+ {
+  double e = fabs(r[i] - roll[i]) + fabs(p[i] - pitch[i]) + fabs(y[i] - yaw[i]);
+  if(e > error) error = e;
+ }
+ rpyRotation(roll, pitch, yaw, t, count, QMathTrig_fast);
+ getRollPitchYaw(t, r, p, y, count, QMathTrig_fast);
+ for(i = 0; i < count; ++i)
+ {
+  double e = fabs(r[i] - roll[i]) + fabs(p[i] - pitch[i]) + fabs(y[i] - yaw[i]);
+  if(e > error) error = e;
+ }
+
+ ColumnVector<3> axis;
+ axis = 0, 0, 1;
+ vectorRotation(axis, yaw, t, count, QMathTrig_fast);
+ for(i = 0; i < count; ++i)
+ {
+  double e = fabs(t[i](2, 1) - sin(yaw[i])) + fabs(t[i](1, 1) - cos(yaw[i]));
+  if(e > error) error = e;
+ }
+ cout << "largest error of the fast angles: " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ return failures;
+}
@@ -0,0 +1,83 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : SymmetricEigen.t.cpp
+// Description          : Example program for symmetric eigen-decomposition.
+//========================================================================
+
+#include "SymmetricEigen.hpp"
+#include "RowVector.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example computes the principal moments and axes of inertia of a
+// rigid body, and the eigenvalues of a 4 x 4 symmetric matrix, and
+// checks that A * v = lambda * v for every eigenpair.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_SymmetricEigen(argc, argv) main(argc, argv)
+#endif
+
+int test_SymmetricEigen(int argc, char **argv)
+{
+ Matrix<3,3> inertia;
+ Matrix<3,3> axes;
+ ColumnVector<3> moments;
+ double residual = 0;
+
+ inertia = 2.0, -0.5, 0.1,
+          -0.5,  3.0, 0.2,
+           0.1,  0.2, 4.0;
+
+ eigenSymmetric(inertia, moments, axes);
+ cout << "principal moments: " << transpose(moments) << endl;
+ cout << "principal axes (columns):" << endl << axes << endl;
+
+ for(int i = 1; i <= 3; ++i)
+ {
+  ColumnVector<3> v = axes.getColumn(i);
+  ColumnVector<3> r = inertia * v - moments(i) * v;
+  if(r.norm() > residual) residual = r.norm();
+ }
+
+ // repeated eigenvalues: the closed form falls back to Jacobi rotations
+ Matrix<3,3> cylinder;
+ cylinder = 5, 0, 0,
+            0, 5, 0,
+            0, 0, 1;
+ eigenSymmetric(cylinder, moments, axes);
+ cout << "moments of a cylinder: " << transpose(moments) << endl;
+
+ // larger matrices use cyclic Jacobi rotations
+ Matrix<4,4> A;
+ Matrix<4,4> V;
+ ColumnVector<4> lambda;
+ A = 4, 1, 2, 0.5,
+     1, 3, 0, 1,
+     2, 0, 5, 1,
+     0.5, 1, 1, 2;
+ eigenSymmetric(A, lambda, V);
+ cout << "eigenvalues of A: " << transpose(lambda) << endl;
+ for(int i = 1; i <= 4; ++i)
+ {
+  ColumnVector<4> v = V.getColumn(i);
+  ColumnVector<4> r = A * v - lambda(i) * v;
+  if(r.norm() > residual) residual = r.norm();
+ }
+
+ // eigenvalues only, for a batch of covariance matrices
+ Matrix<3,3> covariance[2];
+ ColumnVector<3> variances[2];
+ covariance[0] = inertia;
+ covariance[1] = cylinder;
+ eigenValuesSymmetric(covariance, variances, 2);
+ cout << "batch eigenvalues: " << transpose(variances[0]) << "; "
+      << transpose(variances[1]) << endl;
+
+ cout << "largest residual |A v - lambda v|: " << residual << endl;
+ return (residual < 1e-9) ? 0 : 1;
+}
@@ -1,69 +1,200 @@
-//======================================================================== 
-// Package		: QMath - Template Math Library
-// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
-// Compatibility	: GCC 2.95.3 and above, MSVS 2005
-// File                 : Transform.t.cpp
-// Description          : Example program for the Transform class.
-//========================================================================
-
-//========================================================================
-// Transform.t.cpp
-//------------------------------------------------------------------------
-// This program demonstrates how to find the values of the
-// components of a vector in a fixed reference frame after the 
-// vector undergoes a series of transformations about the frame.
-//========================================================================
-
-#include "Transform.hpp"
-#include <math.h>
-#ifndef M_PI
- #define M_PI 3.14159265358979323846
-#endif
-
-using namespace std;
-
-// If using GNUC makefile, just compile main function here. If using 
-// MS Visual C++, the main function is in examples_main.cpp
-#if defined(__GNUC__)
-    #define test_Transform(argc, argv) main(argc, argv)
-#endif
-
-int test_Transform(int argc, char **argv)
-
-{
- ColumnVector<4, double> initialVector;
- ColumnVector<4, double> finalVector;
- Transform firstRotation;
- Transform secondRotation;
- Transform transform;
-
- // The initial position is [1 0 0 1] in homogeneous coordinates
- initialVector = 1, 0, 0, 1;
-	
- // Finding the new co-ordinates. (Angles must be specified in radians.)
- transform = xRotation(0.5 * M_PI) * yRotation(0.5 * M_PI)  * translation(0,0,6);
-
- finalVector = transform * initialVector;
- cout << "* Position vector after transformation in fixed frame : " 
-      << transpose(finalVector) << endl;
- cout << "* Translation : " << transpose(transform.getTranslation()) << endl;
-
- // To get the roll/pitch/yaw angles of the new vector.
- double roll;
- double pitch;
- double yaw;
-	
- transform.getRollPitchYaw(roll, pitch, yaw);
- roll *= 180.0/M_PI; pitch *= 180.0/M_PI; yaw *= 180.0/M_PI;
- cout << "* (yaw, pitch, roll) angles of the new vector (degrees) : (" 
-      << yaw << "," << pitch << "," << roll << ")" << endl;
-	
- // You can get back the initial position vector by the inverse transformation..
- ColumnVector<4, double> initialVectorAgain;
- initialVectorAgain = inverse(transform) * finalVector;
-
- cout << "* After inverse transform : " << transpose(initialVectorAgain) << endl;
- cout << "* Should be the same as what we began with : " << transpose(initialVector) << endl;
-
- return 0;
-}
+//======================================================================== 
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Transform.t.cpp
+// Description          : Example program for the Transform class.
+//========================================================================
+
+//========================================================================
+// Transform.t.cpp
+//------------------------------------------------------------------------
+// This program demonstrates how to find the values of the
+// components of a vector in a fixed reference frame after the 
+// vector undergoes a series of transformations about the frame.
+//========================================================================
+
+#include "Transform.hpp"
+#include <math.h>
+#ifndef M_PI
+ #define M_PI 3.14159265358979323846
+#endif
+
+using namespace std;
+
+// If using GNUC makefile, just compile main function here. If using 
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_Transform(argc, argv) main(argc, argv)
+#endif
+
+int test_Transform(int argc, char **argv)
+
+{
+ ColumnVector<4, double> initialVector;
+ ColumnVector<4, double> finalVector;
+ Transform firstRotation;
+ Transform secondRotation;
+ Transform transform;
+
+ // The initial position is [1 0 0 1] in homogeneous coordinates
+ initialVector = 1, 0, 0, 1;
+	
+ // Finding the new co-ordinates. (Angles must be specified in radians.)
+ transform = xRotation(0.5 * M_PI) * yRotation(0.5 * M_PI)  * translation(0,0,6);
+
+ finalVector = transform * initialVector;
+ cout << "* Position vector after transformation in fixed frame : " 
+      << transpose(finalVector) << endl;
+ cout << "* Translation : " << transpose(transform.getTranslation()) << endl;
+
+ // To get the roll/pitch/yaw angles of the new vector.
+ double roll;
+ double pitch;
+ double yaw;
+	
+ transform.getRollPitchYaw(roll, pitch, yaw);
+ roll *= 180.0/M_PI; pitch *= 180.0/M_PI; yaw *= 180.0/M_PI;
+ cout << "* (yaw, pitch, roll) angles of the new vector (degrees) : (" 
+      << yaw << "," << pitch << "," << roll << ")" << endl;
+	
+ // You can get back the initial position vector by the inverse transformation..
+ ColumnVector<4, double> initialVectorAgain;
+ initialVectorAgain = inverse(transform) * finalVector;
+
+ cout << "* After inverse transform : " << transpose(initialVectorAgain) << endl;
+ cout << "* Should be the same as what we began with : " << transpose(initialVector) << endl;
+
+ // rpyRotation and vectorRotation are computed in closed form. Compare
+ // them with products of the elementary rotations, and the batched
+ // versions with the single ones.
+ int failures = 0;
+ int i, r, c;
+ double error = 0;
+ ColumnVector<3, double> axis;
+ axis = 2, -1, 2;
+ axis = axis / 3;
+ double axisYaw = atan2(axis(2), axis(1)), axisPitch = acos(axis(3));
+ Transform toAxis = zRotation(axisYaw) * yRotation(axisPitch);   // maps Z to the axis
+ double rolls[10], pitches[10], yaws[10], angles[10];
+ Transform rpy[10], vector[10];
+ for(i = 0; i < 10; ++i)
+ {
+  rolls[i] = 0.7 * i - 3;
+  pitches[i] = 0.3 * i - 1.4;
+  yaws[i] = 2.5 - 0.6 * i;
+  angles[i] = 0.9 * i - 4;
+ }
+ rpyRotation(rolls, pitches, yaws, rpy, 10);
+ vectorRotation(axis, angles, vector, 10);
+ for(i = 0; i < 10; ++i)
+ {
+  Transform p = zRotation(rolls[i]) * yRotation(pitches[i]) * xRotation(yaws[i]);
+  Transform q = toAxis * zRotation(angles[i]) * inverse(toAxis);
+  Transform a = rpyRotation(rolls[i], pitches[i], yaws[i]);
+  Transform b = vectorRotation(axis, angles[i]);
+  for(r = 1; r <= 4; ++r)
+   for(c = 1; c <= 4; ++c)
+   {
+    if(fabs(a(r, c) - p(r, c)) > error) error = fabs(a(r, c) - p(r, c));
+    if(fabs(b(r, c) - q(r, c)) > error) error = fabs(b(r, c) - q(r, c));
+    if(fabs(rpy[i](r, c) - a(r, c)) > error) error = fabs(rpy[i](r, c) - a(r, c));
+    if(fabs(vector[i](r, c) - b(r, c)) > error) error = fabs(vector[i](r, c) - b(r, c));
+   }
+ }
+ cout << "* Largest error of the closed form and batched rotations : " << error << endl;
+ if(error > 1e-14) ++failures;
+
+ // The fast trigonometry: rotations against the exact ones, the angles
+ // extracted back, and the batched extraction against the single one
+ double rotationError = 0, angleError = 0, batchError = 0;
+ double r2[10], p2[10], y2[10];
+ rpyRotation(rolls, pitches, yaws, rpy, 10, QMathTrig_fast);
+ vectorRotation(axis, angles, vector, 10, QMathTrig_fast);
+ for(i = 0; i < 10; ++i)
+ {
+  Transform a = rpyRotation(rolls[i], pitches[i], yaws[i], QMathTrig_exact);
+  Transform b = vectorRotation(axis, angles[i], QMathTrig_exact);
+  Transform fa = rpyRotation(rolls[i], pitches[i], yaws[i], QMathTrig_fast);
+  for(r = 1; r <= 4; ++r)
+   for(c = 1; c <= 4; ++c)
+   {
+    if(fabs(fa(r, c) - a(r, c)) > rotationError) rotationError = fabs(fa(r, c) - a(r, c));
+    if(fabs(rpy[i](r, c) - a(r, c)) > rotationError) rotationError = fabs(rpy[i](r, c) - a(r, c));
+    if(fabs(vector[i](r, c) - b(r, c)) > rotationError) rotationError = fabs(vector[i](r, c) - b(r, c));
+   }
+  a.getRollPitchYaw(roll, pitch, yaw, QMathTrig_exact);
+  rpy[i].getRollPitchYaw(r2[i], p2[i], y2[i], QMathTrig_fast);
+  if(fabs(r2[i] - roll) > angleError) angleError = fabs(r2[i] - roll);
+  if(fabs(p2[i] - pitch) > angleError) angleError = fabs(p2[i] - pitch);
+  if(fabs(y2[i] - yaw) > angleError) angleError = fabs(y2[i] - yaw);
+ }
+ // in gimbal lock only the difference of roll and yaw is known; the
+ // angles must still give back the rotation
+ rpy[3] = rpyRotation(0.4, 2 * atan(1.0), -0.3, QMathTrig_fast);
+ rpy[3].getRollPitchYaw(r2[3], p2[3], y2[3], QMathTrig_fast);
+ Transform locked = rpyRotation(r2[3], p2[3], y2[3], QMathTrig_fast);
+ for(r = 1; r <= 4; ++r)
+  for(c = 1; c <= 4; ++c)
+   if(fabs(locked(r, c) - rpy[3](r, c)) > rotationError) rotationError = fabs(locked(r, c) - rpy[3](r, c));
+ getRollPitchYaw(rpy, rolls, pitches, yaws, 10, QMathTrig_fast);
+ for(i = 0; i < 10; ++i)
+ {
+  if(fabs(rolls[i] - r2[i]) > batchError) batchError = fabs(rolls[i] - r2[i]);
+  if(fabs(pitches[i] - p2[i]) > batchError) batchError = fabs(pitches[i] - p2[i]);
+  if(fabs(yaws[i] - y2[i]) > batchError) batchError = fabs(yaws[i] - y2[i]);
+ }
+ cout << "* Largest error of the fast rotations : " << rotationError << endl;
+ cout << "* Largest error of the fast angles : " << angleError << endl;
+ cout << "* Largest difference of the batched fast angles : " << batchError << endl;
+ if(rotationError > 1e-14 || angleError > 1e-14 || batchError > 0) ++failures;
+
+ // Float transforms, built with the same functions, against the double
+ // ones, and the angles extracted back in float
+ TransformT<float> fa[10], fb[10];
+ float fr[10], fp[10], fy[10], fangles[10];
+ double floatError = 0, floatAngleError = 0;
+ for(i = 0; i < 10; ++i)
+ {
+  fr[i] = (float)(0.7 * i - 3);
+  fp[i] = (float)(0.3 * i - 1.4);
+  fy[i] = (float)(2.5 - 0.6 * i);
+  fangles[i] = (float)angles[i];
+ }
+ ColumnVector<3, float> faxis;
+ faxis = (float)axis(1), (float)axis(2), (float)axis(3);
+ rpyRotation(fr, fp, fy, fa, 10, QMathTrig_fast);
+ vectorRotation(faxis, fangles, fb, 10);
+ for(i = 0; i < 10; ++i)
+ {
+  TransformT<float> f = translation<float>(1, -2, 0.5) * rpyRotation<float>(fr[i], fp[i], fy[i])
+                        * inverse(xRotation<float>(fp[i]) * yRotation<float>(fy[i]) * zRotation<float>(fr[i]));
+  Transform d = translation(1, -2, 0.5) * rpyRotation(fr[i], fp[i], fy[i])
+                * inverse(xRotation(fp[i]) * yRotation(fy[i]) * zRotation(fr[i]));
+  Transform a = rpyRotation(fr[i], fp[i], fy[i]);
+  Transform b = vectorRotation(axis, fangles[i]);
+  for(r = 1; r <= 4; ++r)
+   for(c = 1; c <= 4; ++c)
+   {
+    if(fabs(f(r, c) - d(r, c)) > floatError) floatError = fabs(f(r, c) - d(r, c));
+    if(fabs(fa[i](r, c) - a(r, c)) > floatError) floatError = fabs(fa[i](r, c) - a(r, c));
+    if(fabs(fb[i](r, c) - b(r, c)) > floatError) floatError = fabs(fb[i](r, c) - b(r, c));
+   }
+ }
+ float br[10], bp[10], by[10], er, ep, ey;
+ getRollPitchYaw(fa, br, bp, by, 10, QMathTrig_fast);
+ for(i = 0; i < 10; ++i)
+ {
+  rpyRotation(fr[i], fp[i], fy[i]).getRollPitchYaw(roll, pitch, yaw);
+  fa[i].getRollPitchYaw(er, ep, ey, QMathTrig_exact);
+  double e = fabs(br[i] - roll) + fabs(bp[i] - pitch) + fabs(by[i] - yaw);
+  if(e > floatAngleError) floatAngleError = e;
+  e = fabs(er - roll) + fabs(ep - pitch) + fabs(ey - yaw);
+  if(e > floatAngleError) floatAngleError = e;
+ }
+ cout << "* Largest difference of the float transforms : " << floatError << endl;
+ cout << "* Largest difference of the float angles : " << floatAngleError << endl;
+ if(floatError > 1e-5 || floatAngleError > 1e-5) ++failures;
+
+ return failures;
+}
@@ -0,0 +1,87 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Vec3.t.cpp
+// Description          : Example program for the compact vector types.
+//========================================================================
+
+#include "Vec4.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example computes sums, dot and cross products and norms of Vec3
+// vectors, transforms points and homogeneous vectors, and compares the
+// results with the same operations on ColumnVector and Transform.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_Vec3(argc, argv) main(argc, argv)
+#endif
+
+int test_Vec3(int argc, char **argv)
+{
+ int failures = 0;
+ ColumnVector<3> u, v;
+ u = 1, -2, 0.5;
+ v = 0.25, 3, -1;
+
+ Vec3<> a(u), b(v);
+ cout << "a + b = " << a + b << ", 2 a - b = " << 2.0 * a - b << endl;
+ cout << "a . b = " << dotProduct(a, b) << ", a x b = " << crossProduct(a, b) << endl;
+ cout << "|a| = " << a.norm() << ", a / |a| = " << a.normalized() << endl;
+
+ // compare with ColumnVector
+ ColumnVector<3> c = crossProduct(u, v);
+ ColumnVector<3> d = crossProduct(a, b).toColumnVector() - c;
+ if( d.infNorm() != 0 ) ++failures;
+ if( dotProduct(a, b) != dotProduct(u, v) ) ++failures;
+ if( fabs(a.norm() - u.norm()) > 1e-15 ) ++failures;
+ if( ColumnVector<3>(a.normalized().toColumnVector() - u.normalized()).infNorm() > 1e-15 )
+  ++failures;
+ if( (a - a).squaredNorm() != 0 || (a + b).x() != 1.25 || (-b).z() != 1 ) ++failures;
+
+ // float vectors
+ Vec3<float> f(3, 0, 4);
+ f /= 5;
+ f.fastNormalize();
+ cout << "float: " << f << ", norm " << f.norm() << endl;
+ if( fabs(f.norm() - 1) > 5e-6 ) ++failures;
+
+ // points and directions transformed by a Transform
+ Transform T = translation(1, 2, 3) * rpyRotation(0.3, -0.2, 0.1);
+ ColumnVector<4> h;
+ h = u(1), u(2), u(3), 1;
+ ColumnVector<4> expected = T * h;
+ Vec3<> p = T * a;
+ Vec4<> q = T * Vec4<>(a, 1);
+ cout << "T a = " << p << endl;
+ double error = 0;
+ for(int i = 1; i <= 3; ++i)
+ {
+  error += fabs(p(i) - expected(i)) + fabs(q(i) - expected(i));
+  error += fabs(rotate(T, a)(i) - (expected(i) - T(i, 4)));
+ }
+ if( error > 1e-14 || q.w() != 1 ) ++failures;
+ if( translationOf(T).toColumnVector() != T.getTranslation() ) ++failures;
+ if( translation(translationOf(T)) != translation(1, 2, 3) ) ++failures;
+
+ // conversions of homogeneous vectors
+ Vec4<> g(h);
+ if( g.toColumnVector() != h || g.toVec3().z() != h(3) ) ++failures;
+
+ // division by zero
+ try
+ {
+  a /= 0.0;
+  ++failures;
+ }
+ catch(MathException &e)
+ {
+  cout << "a / 0: " << e.getErrorMessage() << endl;
+ }
+
+ return failures;
+}
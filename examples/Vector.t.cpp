@@ -1,40 +1,72 @@
-//======================================================================== 
-// Package		: QMath - Template Math Library
-// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
-// Compatibility	: GCC 2.95.3 and above, MSVS 2005
-// File                 : Vector.t.cpp
-// Description          : Example program for the vector classes.
-//========================================================================
-
-#include "Vector.hpp"
-#include "RowVector.hpp"
-
-using namespace std;
-
-// If using GNUC makefile, just compile main function here. If using 
-// MS Visual C++, the main function is in examples_main.cpp
-#if defined(__GNUC__)
-    #define test_Vector(argc, argv) main(argc, argv)
-#endif
-
-int test_Vector(int argc, char **argv)
-{
- Vector<3> v1, v2, v3;
- 
- v1 = 1, 1, 2;
- v2 = 2, 3, 4;
- double dp;
-  
- // dot product: component of v1 along v2
- dp = dotProduct(v1, v2);
- cout << "Dot product: v1 . v2 = " << dp << endl;
- 
- // cross product: v1 x v2
- v3 = crossProduct(v1, v2);
- cout << "Cross product: v1 x v2 = " << transpose(v3) << endl; 
-
- // 2-norm of a vector
- cout << "norm(v1): " << v1.norm() << endl;
- return 0;
-}
-
+//======================================================================== 
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : Vector.t.cpp
+// Description          : Example program for the vector classes.
+//========================================================================
+
+#include "Vector.hpp"
+#include "RowVector.hpp"
+
+using namespace std;
+
+// If using GNUC makefile, just compile main function here. If using 
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_Vector(argc, argv) main(argc, argv)
+#endif
+
+int test_Vector(int argc, char **argv)
+{
+ Vector<3> v1, v2, v3;
+ 
+ v1 = 1, 1, 2;
+ v2 = 2, 3, 4;
+ double dp;
+  
+ // dot product: component of v1 along v2
+ dp = dotProduct(v1, v2);
+ cout << "Dot product: v1 . v2 = " << dp << endl;
+ 
+ // cross product: v1 x v2
+ v3 = crossProduct(v1, v2);
+ cout << "Cross product: v1 x v2 = " << transpose(v3) << endl; 
+
+ // 2-norm of a vector
+ cout << "norm(v1): " << v1.norm() << endl;
+
+ // other norms, and scaling to unit length
+ int failures = 0;
+ RowVector<4> r;
+ r = 3, -4, 12, 0;
+ cout << "squared norm, 1-norm, 3-norm and infinity norm of r: " 
+      << r.squaredNorm() << ", " << r.lpNorm<1>() << ", " << r.lpNorm<3>() 
+      << ", " << r.infNorm() << endl;
+ if( r.squaredNorm() != 169 || r.norm() != 13 || r.lpNorm<2>() != 13 ) ++failures;
+ if( r.lpNorm<1>() != 19 || r.infNorm() != 12 ) ++failures;
+ if( fabs(r.lpNorm<3>() - pow(27.0 + 64.0 + 1728.0, 1.0/3)) > 1e-12 ) ++failures;
+
+ v3 = v2.normalized();
+ cout << "v2 scaled to unit length: " << transpose(v3) << endl;
+ if( fabs(v3.norm() - 1) > 1e-15 || fabs(v3(3) - 4 / sqrt(29.0)) > 1e-15 ) ++failures;
+ v3 = v2;
+ v3.fastNormalize();
+ if( fabs(v3.norm() - 1) > 1e-15 ) ++failures;
+ r.normalize();
+ if( fabs(r(3) - 12.0 / 13) > 1e-15 ) ++failures;
+
+ // zero vectors cannot be normalized
+ v3 = 0;
+ try
+ {
+  v3.normalize();
+  ++failures;
+ }
+ catch(MathException &e)
+ {
+  cout << "zero vector: " << e.getErrorMessage() << endl;
+ }
+ return failures;
+}
+
@@ -0,0 +1,87 @@
+//========================================================================
+// Package		: QMath - Template Math Library
+// Authors		: Vilas Kumar Chitrakaran (vilas@ieee.org)
+// Compatibility	: GCC 2.95.3 and above, MSVS 2005
+// File                 : VectorBatch.t.cpp
+// Description          : Example program for batched vector operations.
+//========================================================================
+
+#include "VectorBatch.hpp"
+
+using namespace std;
+
+//========================================================================
+// This example computes cross, dot and element products and norms of
+// arrays of 3-vectors, stored as component arrays and as arrays of
+// ColumnVector, and compares the results with the single-vector
+// functions. The arrays span several chunks of QMATH_BATCH_CHUNK
+// vectors, and their length is not a multiple of four, so that the last
+// incomplete group is exercised as well.
+//========================================================================
+// If using GNUC makefile, just compile main function here. If using
+// MS Visual C++, the main function is in examples_main.cpp
+#if defined(__GNUC__)
+    #define test_VectorBatch(argc, argv) main(argc, argv)
+#endif
+
+int test_VectorBatch(int argc, char **argv)
+{
+ const int count = 601;
+ int failures = 0;
+ int i, r;
+
+ ColumnVector<3> a[count], b[count], c[count], e[count];
+ double ax[count], ay[count], az[count], bx[count], by[count], bz[count];
+ double cx[count], cy[count], cz[count], d[count], n[count];
+ for(i = 0; i < count; ++i)
+ {
+  a[i] = sin(0.1 * i), cos(0.3 * i), 1 + i % 7;
+  b[i] = 0.5 - cos(0.2 * i), 2 * sin(0.7 * i), 0.1 * i;
+  ax[i] = a[i](1); ay[i] = a[i](2); az[i] = a[i](3);
+  bx[i] = b[i](1); by[i] = b[i](2); bz[i] = b[i](3);
+ }
+
+ // component arrays
+ double error = 0;
+ crossProduct(ax, ay, az, bx, by, bz, cx, cy, cz, count);
+ for(i = 0; i < count; ++i)
+ {
+  ColumnVector<3> ref = crossProduct(a[i], b[i]);
+  error += fabs(cx[i] - ref(1)) + fabs(cy[i] - ref(2)) + fabs(cz[i] - ref(3));
+ }
+ dotProduct(ax, ay, az, bx, by, bz, d, count);
+ norm(ax, ay, az, n, count);
+ for(i = 0; i < count; ++i)
+  error += fabs(d[i] - dotProduct(a[i], b[i])) + fabs(n[i] - a[i].norm());
+ elementProduct(ax, ay, az, bx, by, bz, cx, cy, cz, count);
+ for(i = 0; i < count; ++i)
+ {
+  ColumnVector<3> ref = elementProduct(a[i], b[i]);
+  error += fabs(cx[i] - ref(1)) + fabs(cy[i] - ref(2)) + fabs(cz[i] - ref(3));
+ }
+ cout << "component arrays, total difference: " << error << endl;
+ if(error > 1e-12) ++failures;
+
+ // arrays of ColumnVector, the cross product computed in place
+ error = 0;
+ for(i = 0; i < count; ++i)
+  c[i] = a[i];
+ crossProduct(c, b, c, count);
+ elementProduct(a, b, e, count);
+ dotProduct(a, b, d, count);
+ norm(a, n, count);
+ for(i = 0; i < count; ++i)
+ {
+  ColumnVector<3> ref1 = crossProduct(a[i], b[i]);
+  ColumnVector<3> ref2 = elementProduct(a[i], b[i]);
+  for(r = 1; r <= 3; ++r)
+   error += fabs(c[i](r) - ref1(r)) + fabs(e[i](r) - ref2(r));
+  error += fabs(d[i] - dotProduct(a[i], b[i])) + fabs(n[i] - a[i].norm());
+ }
+ cout << "ColumnVector arrays, total difference: " << error << endl;
+ if(error > 1e-12) ++failures;
+
+ cout << "a[0] x b[0] = " << c[0] << endl;
+
+ return failures;
+}
@@ -1,122 +1,290 @@
-//======================================================================== 
-// Package		: The Math Library - Ex
-// Authors		: Vilas Kumar Chitrakaran
-// Start Date	: Sun Oct 2 11:08:28 GMT 2005
-// Compiler		: GNU C++ 2.95.3 and above
-// ----------------------------------------------------------------------  
-// File: examples_main.cpp
-// Test programs for QMath in MSVC++
-//========================================================================  
-
-#include <stdio.h>
-#include "examples_main.hpp"
-#ifdef _MSC_VER
- #include <conio.h>
-#endif
-
-
-int main(int argc, char **argv)
-{
-	int ntests = 0;
-	int npass = 0;
-
-	if( test_Matrix(argc, argv) != 0 ) {
-		fprintf(stderr, "Matrix: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Matrix: passed\n\n");
-	}
-	++ntests;
-
-	if( test_MathException(argc, argv) != 0 ) {
-		fprintf(stderr, "MathException: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "MathException: passed\n\n");
-	}
-	++ntests;
-
-	if( test_Vector(argc, argv) != 0 ) {
-		fprintf(stderr, "Vector: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Vector: passed\n\n");
-	}
-	++ntests;
-
-	if( test_Transform(argc, argv) != 0 ) {
-		fprintf(stderr, "Transform: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Transform: passed\n\n");
-	}
-	++ntests;
-
-	if( test_Adams3Integrator(argc, argv) != 0 ) {
-		fprintf(stderr, "Adams3Integrator: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Adams3Integrator: passed\n\n");
-	}
-	++ntests;
-
-	if( test_Differentiator(argc, argv) != 0 ) {
-		fprintf(stderr, "Differentiator: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Differentiator: passed\n\n");
-	}
-	++ntests;
-
-	if( test_Differentiator4O(argc, argv) != 0 ) {
-		fprintf(stderr, "Differentiator4O: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Differentiator4O: passed\n\n");
-	}
-	++ntests;
-
-	if( test_HighpassFilter(argc, argv) != 0 ) {
-		fprintf(stderr, "HighpassFilter: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "HighpassFilter: passed\n\n");
-	}
-	++ntests;
-
-	if( test_Integrator(argc, argv) != 0 ) {
-		fprintf(stderr, "Integrator: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "Integrator: passed\n\n");
-	}
-	++ntests;
-
-	if( test_LowpassFilter(argc, argv) != 0 ) {
-		fprintf(stderr, "LowpassFilter: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "LowpassFilter: passed\n\n");
-	}
-	++ntests;
-
-	if( test_ODESolverRK4(argc, argv) != 0 ) {
-		fprintf(stderr, "ODESolverRK4: failed\n\n");
-	} else {
-		++npass;
-		fprintf(stderr, "ODESolverRK4: passed\n\n");
-	}
-	++ntests;
-
-	if( npass == ntests) {
-		fprintf(stderr, "ALL TESTS PASSED\n\n");
-	} else{
-		fprintf(stderr, "ONLY %d/%d OF ALL TESTS PASSED\n\n", npass, ntests);
-	}
-
-#ifdef _MSC_VER
-	_getch();
-#endif
-
-	return 0;
+//======================================================================== 
+// Package		: The Math Library - Ex
+// Authors		: Vilas Kumar Chitrakaran
+// Start Date	: Sun Oct 2 11:08:28 GMT 2005
+// Compiler		: GNU C++ 2.95.3 and above
+// ----------------------------------------------------------------------  
+// File: examples_main.cpp
+// Test programs for QMath in MSVC++
+//========================================================================  
+
+#include <stdio.h>
+#include "examples_main.hpp"
+#ifdef _MSC_VER
+ #include <conio.h>
+#endif
+
+
+int main(int argc, char **argv)
+{
+	int ntests = 0;
+	int npass = 0;
+
+	if( test_Matrix(argc, argv) != 0 ) {
+		fprintf(stderr, "Matrix: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Matrix: passed\n\n");
+	}
+	++ntests;
+
+	if( test_MathException(argc, argv) != 0 ) {
+		fprintf(stderr, "MathException: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "MathException: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Vector(argc, argv) != 0 ) {
+		fprintf(stderr, "Vector: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Vector: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Transform(argc, argv) != 0 ) {
+		fprintf(stderr, "Transform: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Transform: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Adams3Integrator(argc, argv) != 0 ) {
+		fprintf(stderr, "Adams3Integrator: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Adams3Integrator: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Differentiator(argc, argv) != 0 ) {
+		fprintf(stderr, "Differentiator: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Differentiator: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Differentiator4O(argc, argv) != 0 ) {
+		fprintf(stderr, "Differentiator4O: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Differentiator4O: passed\n\n");
+	}
+	++ntests;
+
+	if( test_HighpassFilter(argc, argv) != 0 ) {
+		fprintf(stderr, "HighpassFilter: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "HighpassFilter: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Integrator(argc, argv) != 0 ) {
+		fprintf(stderr, "Integrator: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Integrator: passed\n\n");
+	}
+	++ntests;
+
+	if( test_LowpassFilter(argc, argv) != 0 ) {
+		fprintf(stderr, "LowpassFilter: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "LowpassFilter: passed\n\n");
+	}
+	++ntests;
+
+	if( test_ODESolverRK4(argc, argv) != 0 ) {
+		fprintf(stderr, "ODESolverRK4: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "ODESolverRK4: passed\n\n");
+	}
+	++ntests;
+
+	if( test_SymmetricEigen(argc, argv) != 0 ) {
+		fprintf(stderr, "SymmetricEigen: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "SymmetricEigen: passed\n\n");
+	}
+	++ntests;
+
+	if( test_LUDecomposition(argc, argv) != 0 ) {
+		fprintf(stderr, "LUDecomposition: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "LUDecomposition: passed\n\n");
+	}
+	++ntests;
+
+	if( test_CholeskyDecomposition(argc, argv) != 0 ) {
+		fprintf(stderr, "CholeskyDecomposition: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "CholeskyDecomposition: passed\n\n");
+	}
+	++ntests;
+
+	if( test_MatrixExponential(argc, argv) != 0 ) {
+		fprintf(stderr, "MatrixExponential: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "MatrixExponential: passed\n\n");
+	}
+	++ntests;
+
+	if( test_NumericTraits(argc, argv) != 0 ) {
+		fprintf(stderr, "NumericTraits: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "NumericTraits: passed\n\n");
+	}
+	++ntests;
+
+	if( test_FixedPoint(argc, argv) != 0 ) {
+		fprintf(stderr, "FixedPoint: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "FixedPoint: passed\n\n");
+	}
+	++ntests;
+
+	if( test_MatrixBatch(argc, argv) != 0 ) {
+		fprintf(stderr, "MatrixBatch: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "MatrixBatch: passed\n\n");
+	}
+	++ntests;
+
+	if( test_FastMath(argc, argv) != 0 ) {
+		fprintf(stderr, "FastMath: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "FastMath: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Vec3(argc, argv) != 0 ) {
+		fprintf(stderr, "Vec3: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Vec3: passed\n\n");
+	}
+	++ntests;
+
+	if( test_VectorBatch(argc, argv) != 0 ) {
+		fprintf(stderr, "VectorBatch: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "VectorBatch: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Elementwise(argc, argv) != 0 ) {
+		fprintf(stderr, "Elementwise: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Elementwise: passed\n\n");
+	}
+	++ntests;
+
+	if( test_RigidTransform(argc, argv) != 0 ) {
+		fprintf(stderr, "RigidTransform: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "RigidTransform: passed\n\n");
+	}
+	++ntests;
+
+	if( test_Quaternion(argc, argv) != 0 ) {
+		fprintf(stderr, "Quaternion: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "Quaternion: passed\n\n");
+	}
+	++ntests;
+
+	if( test_PointBatch(argc, argv) != 0 ) {
+		fprintf(stderr, "PointBatch: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "PointBatch: passed\n\n");
+	}
+	++ntests;
+
+	if( test_KinematicChain(argc, argv) != 0 ) {
+		fprintf(stderr, "KinematicChain: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "KinematicChain: passed\n\n");
+	}
+	++ntests;
+
+	if( test_PoseTrajectory(argc, argv) != 0 ) {
+		fprintf(stderr, "PoseTrajectory: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "PoseTrajectory: passed\n\n");
+	}
+	++ntests;
+
+	if( test_FrameGraph(argc, argv) != 0 ) {
+		fprintf(stderr, "FrameGraph: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "FrameGraph: passed\n\n");
+	}
+	++ntests;
+
+	if( test_LieGroup(argc, argv) != 0 ) {
+		fprintf(stderr, "LieGroup: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "LieGroup: passed\n\n");
+	}
+	++ntests;
+
+	if( test_SE2(argc, argv) != 0 ) {
+		fprintf(stderr, "SE2: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "SE2: passed\n\n");
+	}
+	++ntests;
+
+	if( test_LaserScan(argc, argv) != 0 ) {
+		fprintf(stderr, "LaserScan: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "LaserScan: passed\n\n");
+	}
+	++ntests;
+
+	if( test_SimdLinkage(argc, argv) != 0 ) {
+		fprintf(stderr, "SimdLinkage: failed\n\n");
+	} else {
+		++npass;
+		fprintf(stderr, "SimdLinkage: passed\n\n");
+	}
+	++ntests;
+
+	if( npass == ntests) {
+		fprintf(stderr, "ALL TESTS PASSED\n\n");
+	} else{
+		fprintf(stderr, "ONLY %d/%d OF ALL TESTS PASSED\n\n", npass, ntests);
+	}
+
+#ifdef _MSC_VER
+	_getch();
+#endif
+
+	return 0;
 }
\ No newline at end of file
@@ -1,22 +1,43 @@
-//======================================================================== 
-// Package		: The Math Library - Ex
-// Authors		: Vilas Kumar Chitrakaran
-// Start Date	: Sun Oct 2 11:08:28 GMT 2005
-// Compiler		: GNU C++ 2.95.3 and above
-// ----------------------------------------------------------------------  
-// File: examples_main.hpp
-// Test programs for QMath in MSVC++
-//========================================================================  
-
-int test_Adams3Integrator(int argc, char **argv);
-int test_Differentiator(int argc, char **argv);
-int test_Differentiator4O(int argc, char **argv);
-int test_HighpassFilter(int argc, char **argv);
-int test_Integrator(int argc, char **argv);
-int test_LowpassFilter(int argc, char **argv);
-int test_MathException(int argc, char **argv);
-int test_Matrix(int argc, char **argv);
-int test_ODESolverRK4(int argc, char **argv);
-int test_Transform(int argc, char **argv);
-int test_Vector(int argc, char **argv);
-
+//======================================================================== 
+// Package		: The Math Library - Ex
+// Authors		: Vilas Kumar Chitrakaran
+// Start Date	: Sun Oct 2 11:08:28 GMT 2005
+// Compiler		: GNU C++ 2.95.3 and above
+// ----------------------------------------------------------------------  
+// File: examples_main.hpp
+// Test programs for QMath in MSVC++
+//========================================================================  
+
+int test_Adams3Integrator(int argc, char **argv);
+int test_CholeskyDecomposition(int argc, char **argv);
+int test_Differentiator(int argc, char **argv);
+int test_Differentiator4O(int argc, char **argv);
+int test_Elementwise(int argc, char **argv);
+int test_FastMath(int argc, char **argv);
+int test_FixedPoint(int argc, char **argv);
+int test_FrameGraph(int argc, char **argv);
+int test_HighpassFilter(int argc, char **argv);
+int test_Integrator(int argc, char **argv);
+int test_KinematicChain(int argc, char **argv);
+int test_LaserScan(int argc, char **argv);
+int test_LieGroup(int argc, char **argv);
+int test_LowpassFilter(int argc, char **argv);
+int test_LUDecomposition(int argc, char **argv);
+int test_MathException(int argc, char **argv);
+int test_Matrix(int argc, char **argv);
+int test_MatrixBatch(int argc, char **argv);
+int test_MatrixExponential(int argc, char **argv);
+int test_NumericTraits(int argc, char **argv);
+int test_ODESolverRK4(int argc, char **argv);
+int test_PointBatch(int argc, char **argv);
+int test_PoseTrajectory(int argc, char **argv);
+int test_Quaternion(int argc, char **argv);
+int test_RigidTransform(int argc, char **argv);
+int test_SE2(int argc, char **argv);
+int test_SimdLinkage(int argc, char **argv);
+int test_SymmetricEigen(int argc, char **argv);
+int test_Transform(int argc, char **argv);
+int test_Vec3(int argc, char **argv);
+int test_Vector(int argc, char **argv);
+int test_VectorBatch(int argc, char **argv);
+